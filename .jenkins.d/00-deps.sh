@@ -2,7 +2,8 @@
 set -eo pipefail
 
 APT_PKGS=(build-essential pkg-config python3-minimal
-          libboost-all-dev libssl-dev libsqlite3-dev)
+          libboost-all-dev libssl-dev libsqlite3-dev
+          systemtap-sdt-dev)
 FORMULAE=(boost openssl pkg-config)
 PIP_PKGS=()
 case $JOB_NAME in
@@ -30,7 +31,7 @@ elif [[ $ID_LIKE == *debian* ]]; then
     sudo apt-get -qy install "${APT_PKGS[@]}"
 elif [[ $ID_LIKE == *fedora* ]]; then
     sudo dnf -y install gcc-c++ libasan lld pkgconf-pkg-config python3 \
-                        boost-devel openssl-devel sqlite-devel
+                        boost-devel openssl-devel sqlite-devel systemtap-sdt-devel
 fi
 
 if (( ${#PIP_PKGS[@]} )); then
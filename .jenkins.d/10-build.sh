@@ -13,12 +13,16 @@ fi
 if [[ -n $DISABLE_PCH ]]; then
     PCH="--without-pch"
 fi
+if [[ $ID_LIKE == *linux* ]]; then
+    PROBES="--with-probes"
+fi
 
 set -x
 
 if [[ $JOB_NAME != *"code-coverage" && $JOB_NAME != *"limited-build" ]]; then
-    # Build static library in release mode with tests and without precompiled headers
-    ./waf --color=yes configure --enable-static --disable-shared --with-tests --without-pch
+    # Build static library in release mode with tests, static tracepoints (if supported),
+    # and without precompiled headers
+    ./waf --color=yes configure --enable-static --disable-shared --with-tests --without-pch $PROBES
     ./waf --color=yes build
 
     # Cleanup
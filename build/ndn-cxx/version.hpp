@@ -0,0 +1,70 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_VERSION_HPP
+#define NDN_CXX_VERSION_HPP
+
+// ndn-cxx version follows Semantic Versioning 2.0.0
+// https://semver.org/spec/v2.0.0.html
+
+/**
+ * \brief ndn-cxx version represented as an integer.
+ *
+ * Equivalent to: #NDN_CXX_VERSION_MAJOR*1000000 + #NDN_CXX_VERSION_MINOR*1000 + #NDN_CXX_VERSION_PATCH
+ */
+#define NDN_CXX_VERSION 8001
+
+/// The major version of ndn-cxx
+#define NDN_CXX_VERSION_MAJOR 0
+/// The minor version of ndn-cxx
+#define NDN_CXX_VERSION_MINOR 8
+/// The patch version of ndn-cxx
+#define NDN_CXX_VERSION_PATCH 1
+
+/**
+ * \brief ndn-cxx version represented as a string.
+ *
+ * Format:
+ * @code
+ * MAJOR.MINOR.PATCH
+ * @endcode
+ */
+#define NDN_CXX_VERSION_STRING "0.8.1"
+
+/**
+ * \brief ndn-cxx version string, including git commit information if ndn-cxx is built from a
+ *        specific git commit.
+ *
+ * #NDN_CXX_VERSION_BUILD_STRING is obtained using the following command (`ndn-cxx-` prefix is
+ * afterwards removed): ``git describe --match 'ndn-cxx-*'``
+ *
+ * When ndn-cxx is not built from git, #NDN_CXX_VERSION_BUILD_STRING equals #NDN_CXX_VERSION_STRING.
+ *
+ * Format:
+ * @code
+ * MAJOR.MINOR.PATCH(-release-candidate-tag)(-(number-of-commits-since-tag)-COMMIT-HASH)
+ * @endcode
+ *
+ * Example: 0.1.0-rc1-1-g5c86570
+ */
+#define NDN_CXX_VERSION_BUILD_STRING "0.8.1-commit-d804b27"
+
+#endif // NDN_CXX_VERSION_HPP
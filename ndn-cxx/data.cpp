@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/util/sha256.hpp"
 
 namespace ndn {
@@ -323,9 +324,10 @@ Data::extractSignedRanges() const
   bufs.reserve(1); // One range containing data value up to, but not including, SignatureValue
 
   wireEncode();
-  auto lastSignedIt = std::prev(m_wire.find(tlv::SignatureValue));
-  // Note: we assume that both iterators point to the same underlying buffer
-  bufs.emplace_back(m_wire.value_begin(), lastSignedIt->end());
+  BlockView view(m_wire);
+  auto sigValue = view.find(tlv::SignatureValue);
+  BOOST_ASSERT(sigValue != view.elements_end());
+  bufs.emplace_back(view.value_begin(), sigValue->begin());
 
   return bufs;
 }
@@ -205,6 +205,10 @@ public: // Data fields
    * @brief Set `Content` from a shared buffer.
    * @param value buffer with the TLV-VALUE of the content; must not be nullptr
    * @return A reference to this Data, to allow chaining.
+   *
+   * The buffer is shared rather than copied. It may refer to external memory, such as a
+   * mapped file, through makeExternalBuffer(); the bytes are then copied only once, when
+   * the Data packet is encoded.
    */
   Data&
   setContent(ConstBufferPtr value);
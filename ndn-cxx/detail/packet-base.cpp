@@ -27,22 +27,14 @@ namespace ndn {
 uint64_t
 PacketBase::getCongestionMark() const
 {
-  auto mark = this->getTag<lp::CongestionMarkTag>();
-
-  if (mark == nullptr) {
-    return 0;
-  }
-  else {
-    return *mark;
-  }
+  return this->getTagValue<lp::CongestionMarkTag>().value_or(0);
 }
 
 void
 PacketBase::setCongestionMark(uint64_t mark)
 {
   if (mark != 0) {
-    auto tag = make_shared<lp::CongestionMarkTag>(mark);
-    this->setTag(std::move(tag));
+    this->setTagValue<lp::CongestionMarkTag>(mark);
   }
   else {
     this->removeTag<lp::CongestionMarkTag>();
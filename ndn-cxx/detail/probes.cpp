@@ -0,0 +1,35 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/probes.hpp"
+
+#ifdef NDN_CXX_HAVE_PROBES
+
+// The semaphores are incremented by the tracer when it attaches to the corresponding probe.
+// sys/sdt.h expects them in the ".probes" section with C linkage.
+#define NDN_CXX_DEFINE_PROBE_SEMAPHORE(name) \
+  unsigned short ndn_cxx_##name##_semaphore __attribute__((used, section(".probes"))) = 0;
+
+extern "C" {
+NDN_CXX_FOR_EACH_PROBE(NDN_CXX_DEFINE_PROBE_SEMAPHORE)
+} // extern "C"
+
+#endif // NDN_CXX_HAVE_PROBES
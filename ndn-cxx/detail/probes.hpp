@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+/** \file
+ *  \brief Static tracepoints (USDT probes) on packet processing paths.
+ *
+ *  When ndn-cxx is configured with `--with-probes`, each NDN_CXX_PROBE() site becomes a
+ *  SystemTap-compatible static probe in the `ndn_cxx` provider, which can be attached to by
+ *  perf, bpftrace, SystemTap, etc. on a running process. Each probe is guarded by a semaphore
+ *  that is set by the tracer, so that probe arguments are computed only while a tracer is
+ *  attached. When configured without probes, NDN_CXX_PROBE() expands to nothing.
+ *
+ *  \code
+ *  bpftrace -e 'usdt:/usr/local/lib/libndn-cxx.so:ndn_cxx:face_satisfy_interest
+ *               { @latency_us = hist(arg1 / 1000); }'
+ *  \endcode
+ */
+
+#ifndef NDN_CXX_DETAIL_PROBES_HPP
+#define NDN_CXX_DETAIL_PROBES_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+/** \brief Invoke \p X on the name of every probe.
+ *
+ *  Probe arguments are listed next to each name; "nameHash" is the std::hash of the packet name.
+ */
+#define NDN_CXX_FOR_EACH_PROBE(X) \
+  X(face_express_interest)  /* nameHash, wireSize, lifetime in milliseconds */ \
+  X(face_put_data)          /* nameHash, wireSize */ \
+  X(face_satisfy_interest)  /* nameHash, latency in nanoseconds */ \
+  X(face_interest_timeout)  /* nameHash, lifetime in milliseconds */ \
+  X(face_drop_oversized)    /* packet type ('I', 'D', 'N'), wireSize */ \
+  X(transport_write)        /* number of packets, total bytes, send queue length */ \
+  X(transport_receive)      /* bytes received, bytes buffered */ \
+  X(validator_start)        /* nameHash, packet type ('I', 'D') */ \
+  X(validator_finish)       /* nameHash, packet type ('I', 'D'), 1 if valid, 0 if invalid */ \
+  X(keychain_sign)          /* nameHash, packet type ('I', 'D'), wireSize, duration in nanoseconds */ \
+  X(ims_insert)             /* nameHash, wireSize, number of packets after insertion */ \
+  X(ims_find)               /* nameHash, 1 if found, 0 if not found */ \
+  X(ims_evict)              /* nameHash, number of packets after removal (eviction, erase, or destruction) */
+
+#ifdef NDN_CXX_HAVE_PROBES
+
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+
+/** \cond */
+#define NDN_CXX_DECLARE_PROBE_SEMAPHORE(name) \
+  extern "C" unsigned short ndn_cxx_##name##_semaphore;
+NDN_CXX_FOR_EACH_PROBE(NDN_CXX_DECLARE_PROBE_SEMAPHORE)
+#undef NDN_CXX_DECLARE_PROBE_SEMAPHORE
+/** \endcond */
+
+/** \brief Whether a tracer is attached to probe \p name.
+ *
+ *  This can be used to skip computations, such as taking timestamps, that are needed only
+ *  for probe arguments.
+ */
+#define NDN_CXX_PROBE_ENABLED(name) (__builtin_expect(ndn_cxx_##name##_semaphore != 0, 0))
+
+/** \brief Fire probe \p name with the given arguments.
+ *
+ *  The arguments are evaluated only if a tracer is attached to the probe.
+ */
+#define NDN_CXX_PROBE(name, ...) \
+  do { \
+    if (NDN_CXX_PROBE_ENABLED(name)) { \
+      STAP_PROBEV(ndn_cxx, name, __VA_ARGS__); \
+    } \
+  } while (false)
+
+#else
+
+namespace ndn {
+namespace detail {
+
+template<typename... Args>
+constexpr void
+ignoreProbeArguments(const Args&...) noexcept
+{
+}
+
+} // namespace detail
+} // namespace ndn
+
+#define NDN_CXX_PROBE_ENABLED(name) false
+
+// The arguments are never evaluated, but they are still type-checked.
+#define NDN_CXX_PROBE(name, ...) \
+  do { \
+    if (false) { \
+      ::ndn::detail::ignoreProbeArguments(__VA_ARGS__); \
+    } \
+  } while (false)
+
+#endif // NDN_CXX_HAVE_PROBES
+
+#endif // NDN_CXX_DETAIL_PROBES_HPP
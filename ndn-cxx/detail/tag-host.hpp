@@ -24,13 +24,39 @@
 
 #include "ndn-cxx/detail/common.hpp"
 #include "ndn-cxx/tag.hpp"
+#include "ndn-cxx/util/optional.hpp"
 
-#include <map>
+#include <boost/container/small_vector.hpp>
 
 namespace ndn {
+namespace detail {
+
+/** \brief Determines whether the value of tag type \p T can be stored inline in a TagHost.
+ *
+ *  This holds for tags that declare a \c ValueType, such as SimpleTag, whose value is trivially
+ *  copyable and fits in eight bytes.
+ */
+template<typename T, typename = void>
+struct IsInlineTag : std::false_type
+{
+};
+
+template<typename T>
+struct IsInlineTag<T, decltype(void(std::declval<typename T::ValueType>()))>
+  : std::integral_constant<bool, std::is_trivially_copyable<typename T::ValueType>::value &&
+                                 sizeof(typename T::ValueType) <= sizeof(uint64_t) &&
+                                 alignof(typename T::ValueType) <= alignof(uint64_t)>
+{
+};
+
+} // namespace detail
 
 /**
  * \brief Base class to store tag information, e.g., inside Interest and Data packets.
+ *
+ * Tags are kept in a small flat array that holds up to two tags without allocating. The value
+ * of a small tag, such as a SimpleTag of an integer, can be stored directly in the array with
+ * setTagValue(), which avoids allocating a Tag object unless getTag() is called for it.
  */
 class TagHost
 {
@@ -38,6 +64,10 @@ public:
   /** \brief Get a tag item.
    *  \tparam T type of the tag, which must be a subclass of ndn::Tag
    *  \retval nullptr if no Tag of type T is stored
+   *  \warning If the tag was stored inline by setTagValue(), every call returns a new Tag
+   *           object holding a copy of the value, so the returned pointers cannot be compared
+   *           for identity and modifying the object does not affect the stored value.
+   *           Use getTagValue() to read such tags.
    */
   template<typename T>
   shared_ptr<T>
@@ -58,8 +88,103 @@ public:
   void
   removeTag() const;
 
+  /** \brief Get the value of a tag item.
+   *  \tparam T type of the tag, which must declare its \c ValueType and provide \c get(),
+   *            such as SimpleTag
+   *  \return a copy of the value, or nullopt if no Tag of type T is stored
+   */
+  template<typename T>
+  optional<typename T::ValueType>
+  getTagValue() const;
+
+  /** \brief Set (add or replace) a tag item from its value.
+   *  \tparam T type of the tag, which must declare its \c ValueType and be constructible from it,
+   *            such as SimpleTag
+   *
+   *  If the value is small and trivially copyable, it is stored without creating a Tag object;
+   *  getTag() then returns a new Tag object holding a copy of the value on every call.
+   *
+   *  \note Tag can be set even on a const tag host instance
+   */
+  template<typename T>
+  void
+  setTagValue(const typename T::ValueType& value) const;
+
+private:
+  struct Entry
+  {
+    int type;
+    /// the tag object, nullptr if the tag is only stored in #value
+    shared_ptr<Tag> tag;
+    alignas(uint64_t) unsigned char value[sizeof(uint64_t)];
+  };
+
+  Entry*
+  findEntry(int type) const noexcept
+  {
+    for (auto& entry : m_tags) {
+      if (entry.type == type) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  Entry&
+  findOrInsertEntry(int type) const
+  {
+    Entry* entry = findEntry(type);
+    if (entry != nullptr) {
+      return *entry;
+    }
+    m_tags.push_back(Entry{type, nullptr, {}});
+    return m_tags.back();
+  }
+
+  template<typename T>
+  static const typename T::ValueType&
+  getInlineValue(const Entry& entry) noexcept
+  {
+    return *reinterpret_cast<const typename T::ValueType*>(entry.value);
+  }
+
+  /** \brief Create a Tag object from an inline value.
+   *
+   *  The object is not stored in the entry: getTag() is const and may be called concurrently
+   *  on the same packet, like any other const accessor.
+   */
+  template<typename T>
+  static shared_ptr<T>
+  makeTag(const Entry& entry, std::true_type)
+  {
+    return make_shared<T>(getInlineValue<T>(entry));
+  }
+
+  template<typename T>
+  static shared_ptr<T>
+  makeTag(const Entry&, std::false_type) noexcept
+  {
+    // tags of this type are always stored as objects
+    return nullptr;
+  }
+
+  template<typename T>
+  static void
+  storeValue(Entry& entry, const typename T::ValueType& value, std::true_type) noexcept
+  {
+    entry.tag.reset();
+    new (entry.value) typename T::ValueType(value);
+  }
+
+  template<typename T>
+  static void
+  storeValue(Entry& entry, const typename T::ValueType& value, std::false_type)
+  {
+    entry.tag = make_shared<T>(value);
+  }
+
 private:
-  mutable std::map<int, shared_ptr<Tag>> m_tags;
+  mutable boost::container::small_vector<Entry, 2> m_tags;
 };
 
 template<typename T>
@@ -68,11 +193,14 @@ TagHost::getTag() const
 {
   static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
 
-  auto it = m_tags.find(T::getTypeId());
-  if (it == m_tags.end()) {
+  const Entry* entry = findEntry(T::getTypeId());
+  if (entry == nullptr) {
     return nullptr;
   }
-  return static_pointer_cast<T>(it->second);
+  if (entry->tag == nullptr) {
+    return makeTag<T>(*entry, detail::IsInlineTag<T>{});
+  }
+  return static_pointer_cast<T>(entry->tag);
 }
 
 template<typename T>
@@ -82,10 +210,10 @@ TagHost::setTag(shared_ptr<T> tag) const
   static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
 
   if (tag == nullptr) {
-    m_tags.erase(T::getTypeId());
+    removeTag<T>();
   }
   else {
-    m_tags[T::getTypeId()] = std::move(tag);
+    findOrInsertEntry(T::getTypeId()).tag = std::move(tag);
   }
 }
 
@@ -93,7 +221,35 @@ template<typename T>
 void
 TagHost::removeTag() const
 {
-  setTag<T>(nullptr);
+  Entry* entry = findEntry(T::getTypeId());
+  if (entry != nullptr) {
+    m_tags.erase(m_tags.begin() + (entry - m_tags.data()));
+  }
+}
+
+template<typename T>
+optional<typename T::ValueType>
+TagHost::getTagValue() const
+{
+  static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
+
+  const Entry* entry = findEntry(T::getTypeId());
+  if (entry == nullptr) {
+    return nullopt;
+  }
+  if (entry->tag == nullptr) {
+    return getInlineValue<T>(*entry);
+  }
+  return static_cast<const T&>(*entry->tag).get();
+}
+
+template<typename T>
+void
+TagHost::setTagValue(const typename T::ValueType& value) const
+{
+  static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
+
+  storeValue<T>(findOrInsertEntry(T::getTypeId()), value, detail::IsInlineTag<T>{});
 }
 
 } // namespace ndn
@@ -0,0 +1,525 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_DETAIL_TLV_SCHEMA_HPP
+#define NDN_CXX_DETAIL_TLV_SCHEMA_HPP
+
+#include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/name.hpp"
+#include "ndn-cxx/util/optional.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <array>
+#include <bitset>
+#include <tuple>
+
+/** \file
+ *  \brief Declarative TLV encoding of structures made of a sequence of fields.
+ *
+ *  A structure whose TLV-VALUE is a fixed sequence of fields, such as most NFD management
+ *  datasets, declares its schema in a class with a constexpr `describe()` function:
+ *  \code
+ *  struct CsInfo::Schema
+ *  {
+ *    static constexpr auto
+ *    describe()
+ *    {
+ *      return detail::tlvStruct(tlv::nfd::CsInfo, "CsInfo",
+ *        detail::tlvField(tlv::nfd::Capacity, "Capacity", &CsInfo::m_capacity),
+ *        detail::tlvField(tlv::nfd::Flags, "Flags", &CsInfo::m_flags),
+ *        ...);
+ *    }
+ *  };
+ *  \endcode
+ *  TlvCodec<CsInfo::Schema> then provides the encoding and decoding functions. The encoding of
+ *  each field is chosen from the type of its data member; a field is optional if and only if its
+ *  data member is an `optional`.
+ *
+ *  Fields are encoded in the order of declaration. When decoding, each field must appear in
+ *  that order; an absent optional field is reset, an absent required field is an error, and
+ *  elements after the last field are ignored. Since the next element is only compared with the
+ *  next field, the TLV-TYPEs of the fields must be distinct, which is checked at compile time.
+ */
+
+namespace ndn {
+namespace detail {
+
+/** \brief Describes a field of a TLV structure.
+ *  \tparam C class that holds the field
+ *  \tparam T type of the data member that holds the field
+ */
+template<typename C, typename T>
+struct TlvField
+{
+  using ValueType = T;
+
+  uint32_t type;
+  const char* name;
+  T C::*member;
+};
+
+/** \brief Describes a field of a TLV structure.
+ *  \param type TLV-TYPE of the field
+ *  \param name name of the field in error messages
+ *  \param member data member that holds the field
+ */
+template<typename C, typename T>
+constexpr TlvField<C, T>
+tlvField(uint32_t type, const char* name, T C::*member) noexcept
+{
+  return {type, name, member};
+}
+
+/** \brief Describes a TLV structure.
+ */
+template<typename... Fields>
+struct TlvStruct
+{
+  uint32_t type;
+  const char* name;
+  std::tuple<Fields...> fields;
+
+  /** \brief Whether the fields have distinct TLV-TYPEs.
+   */
+  constexpr bool
+  hasDistinctTypes() const noexcept
+  {
+    return hasDistinctTypes(std::index_sequence_for<Fields...>());
+  }
+
+private:
+  template<size_t... I>
+  constexpr bool
+  hasDistinctTypes(std::index_sequence<I...>) const noexcept
+  {
+    const std::array<uint32_t, sizeof...(Fields)> types{{std::get<I>(fields).type...}};
+    for (size_t i = 0; i < types.size(); ++i) {
+      for (size_t j = i + 1; j < types.size(); ++j) {
+        if (types[i] == types[j]) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+/** \brief Describes a TLV structure.
+ *  \param type TLV-TYPE of the structure
+ *  \param name name of the structure in error messages
+ *  \param fields fields of the structure, in the order of encoding
+ */
+template<typename... Fields>
+constexpr TlvStruct<Fields...>
+tlvStruct(uint32_t type, const char* name, Fields... fields) noexcept
+{
+  return {type, name, std::make_tuple(fields...)};
+}
+
+/** \brief Encoding of a field value of type \p T.
+ *
+ *  Each specialization provides:
+ *   - `size(type, value)`: size of the field's TLV, or zero if an optional field is absent
+ *   - `prepend(encoder, type, value)`: prepend the field's TLV, and return its size
+ *   - `decode<E>(wire, element, value)`: decode the field from \p element, a sub-element of
+ *     \p wire, throwing E if the value is invalid
+ *   - `decodeAbsent<E>(name, value)`: handle the absence of the field
+ */
+template<typename T, typename = void>
+struct TlvValueCodec;
+
+/** \brief Encoding of fields that are required.
+ */
+template<typename T>
+struct RequiredTlvValue
+{
+  template<typename E>
+  [[noreturn]] static void
+  decodeAbsent(const char* name, T&)
+  {
+    NDN_THROW(E("missing required "s + name + " field"));
+  }
+};
+
+/** \brief Encoding of a TLV-VALUE that is a NonNegativeInteger.
+ */
+template<typename T>
+struct NonNegativeIntegerTlvValue : RequiredTlvValue<T>
+{
+  static size_t
+  size(uint32_t type, uint64_t value) noexcept
+  {
+    size_t length = tlv::sizeOfNonNegativeInteger(value);
+    return tlv::sizeOfVarNumber(type) + tlv::sizeOfVarNumber(length) + length;
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, uint64_t value)
+  {
+    return prependNonNegativeIntegerBlock(encoder, type, value);
+  }
+};
+
+template<typename T>
+struct TlvValueCodec<T, std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value>>
+  : NonNegativeIntegerTlvValue<T>
+{
+  static size_t
+  size(uint32_t type, T value) noexcept
+  {
+    return NonNegativeIntegerTlvValue<T>::size(type, static_cast<uint64_t>(value));
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, T value)
+  {
+    return NonNegativeIntegerTlvValue<T>::prepend(encoder, type, static_cast<uint64_t>(value));
+  }
+
+  template<typename E>
+  static void
+  decode(const Block&, const BlockView& element, T& value)
+  {
+    value = readNonNegativeIntegerAs<T>(element);
+  }
+};
+
+template<typename Rep, typename Period>
+struct TlvValueCodec<time::duration<Rep, Period>> : NonNegativeIntegerTlvValue<time::duration<Rep, Period>>
+{
+  using Base = NonNegativeIntegerTlvValue<time::duration<Rep, Period>>;
+
+  static size_t
+  size(uint32_t type, time::duration<Rep, Period> value) noexcept
+  {
+    return Base::size(type, static_cast<uint64_t>(value.count()));
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, time::duration<Rep, Period> value)
+  {
+    return Base::prepend(encoder, type, static_cast<uint64_t>(value.count()));
+  }
+
+  template<typename E>
+  static void
+  decode(const Block&, const BlockView& element, time::duration<Rep, Period>& value)
+  {
+    value = time::duration<Rep, Period>(readNonNegativeInteger(element));
+  }
+};
+
+/** \brief Encoding of a point in time as milliseconds since the Unix epoch.
+ */
+template<>
+struct TlvValueCodec<time::system_clock::TimePoint>
+  : NonNegativeIntegerTlvValue<time::system_clock::TimePoint>
+{
+  using Base = NonNegativeIntegerTlvValue<time::system_clock::TimePoint>;
+
+  static size_t
+  size(uint32_t type, const time::system_clock::TimePoint& value) noexcept
+  {
+    return Base::size(type, static_cast<uint64_t>(time::toUnixTimestamp(value).count()));
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const time::system_clock::TimePoint& value)
+  {
+    return Base::prepend(encoder, type, static_cast<uint64_t>(time::toUnixTimestamp(value).count()));
+  }
+
+  template<typename E>
+  static void
+  decode(const Block&, const BlockView& element, time::system_clock::TimePoint& value)
+  {
+    value = time::fromUnixTimestamp(time::milliseconds(readNonNegativeInteger(element)));
+  }
+};
+
+template<size_t N>
+struct TlvValueCodec<std::bitset<N>> : NonNegativeIntegerTlvValue<std::bitset<N>>
+{
+  static_assert(N <= 64, "");
+  using Base = NonNegativeIntegerTlvValue<std::bitset<N>>;
+
+  static size_t
+  size(uint32_t type, const std::bitset<N>& value) noexcept
+  {
+    return Base::size(type, value.to_ullong());
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const std::bitset<N>& value)
+  {
+    return Base::prepend(encoder, type, value.to_ullong());
+  }
+
+  template<typename E>
+  static void
+  decode(const Block&, const BlockView& element, std::bitset<N>& value)
+  {
+    value = std::bitset<N>(static_cast<unsigned long long>(readNonNegativeInteger(element)));
+  }
+};
+
+template<>
+struct TlvValueCodec<std::string> : RequiredTlvValue<std::string>
+{
+  static size_t
+  size(uint32_t type, const std::string& value) noexcept
+  {
+    return tlv::sizeOfVarNumber(type) + tlv::sizeOfVarNumber(value.size()) + value.size();
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const std::string& value)
+  {
+    return prependStringBlock(encoder, type, value);
+  }
+
+  template<typename E>
+  static void
+  decode(const Block&, const BlockView& element, std::string& value)
+  {
+    value.assign(reinterpret_cast<const char*>(element.value_begin()), element.value_size());
+  }
+};
+
+/** \brief Encoding of a Name.
+ *
+ *  If the TLV-TYPE of the field is not tlv::Name, the Name is nested in an element of that type.
+ *  The decoded Name shares the buffer of the enclosing structure.
+ */
+template<>
+struct TlvValueCodec<Name> : RequiredTlvValue<Name>
+{
+  static size_t
+  size(uint32_t type, const Name& value)
+  {
+    EncodingEstimator estimator;
+    size_t length = value.wireEncode(estimator);
+    if (type == tlv::Name) {
+      return length;
+    }
+    return tlv::sizeOfVarNumber(type) + tlv::sizeOfVarNumber(length) + length;
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const Name& value)
+  {
+    size_t length = value.wireEncode(encoder);
+    if (type == tlv::Name) {
+      return length;
+    }
+    length += encoder.prependVarNumber(length);
+    length += encoder.prependVarNumber(type);
+    return length;
+  }
+
+  template<typename E>
+  static void
+  decode(const Block& wire, const BlockView& element, Name& value)
+  {
+    if (element.type() == tlv::Name) {
+      value.wireDecode(Block(wire, element));
+      return;
+    }
+
+    auto inner = element.elements_begin();
+    if (inner == element.elements_end() || inner->type() != tlv::Name) {
+      NDN_THROW(E("expecting Name in TLV-TYPE " + to_string(element.type())));
+    }
+    value.wireDecode(Block(wire, *inner));
+  }
+};
+
+/** \brief Encoding of an optional field, which is omitted when it has no value.
+ */
+template<typename T>
+struct TlvValueCodec<optional<T>>
+{
+  static size_t
+  size(uint32_t type, const optional<T>& value)
+  {
+    return value ? TlvValueCodec<T>::size(type, *value) : 0;
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, uint32_t type, const optional<T>& value)
+  {
+    return value ? TlvValueCodec<T>::prepend(encoder, type, *value) : 0;
+  }
+
+  template<typename E>
+  static void
+  decode(const Block& wire, const BlockView& element, optional<T>& value)
+  {
+    value.emplace();
+    TlvValueCodec<T>::template decode<E>(wire, element, *value);
+  }
+
+  template<typename E>
+  static void
+  decodeAbsent(const char*, optional<T>& value)
+  {
+    value = nullopt;
+  }
+};
+
+/** \brief Encodes and decodes a TLV structure.
+ *  \tparam Schema class with a constexpr `describe()` function that returns a TlvStruct
+ *  \tparam C class that holds the fields
+ *  \tparam E exception thrown when decoding fails
+ */
+template<typename Schema, typename C, typename E = typename C::Error>
+class TlvCodec
+{
+  static_assert(Schema::describe().hasDistinctTypes(),
+                "fields of a TLV structure must have distinct TLV-TYPEs");
+
+  static constexpr size_t N_FIELDS = std::tuple_size<decltype(Schema::describe().fields)>::value;
+
+  template<size_t I>
+  using Index = std::integral_constant<size_t, I>;
+
+public:
+  /** \brief Compute the size of the encoding of \p obj.
+   */
+  static size_t
+  size(const C& obj)
+  {
+    size_t length = valueSize(obj, Index<0>());
+    return tlv::sizeOfVarNumber(Schema::describe().type) + tlv::sizeOfVarNumber(length) + length;
+  }
+
+  /** \brief Prepend the encoding of \p obj to \p encoder.
+   *  \return size of the encoding
+   */
+  template<encoding::Tag TAG>
+  static size_t
+  prepend(EncodingImpl<TAG>& encoder, const C& obj)
+  {
+    size_t length = prependFields(encoder, obj, Index<N_FIELDS>());
+    length += encoder.prependVarNumber(length);
+    length += encoder.prependVarNumber(Schema::describe().type);
+    return length;
+  }
+
+  /** \brief Encode \p obj into a buffer of the exact size.
+   */
+  static Block
+  encode(const C& obj)
+  {
+    EncodingBuffer buffer(size(obj), 0);
+    prepend(buffer, obj);
+    return buffer.block();
+  }
+
+  /** \brief Decode \p wire into \p obj.
+   *  \throw E \p wire is not of the expected type, or a required field is absent
+   *  \throw tlv::Error a field cannot be decoded
+   */
+  static void
+  decode(const Block& wire, C& obj)
+  {
+    constexpr auto schema = Schema::describe();
+    if (wire.type() != schema.type) {
+      NDN_THROW(E(schema.name, wire.type()));
+    }
+
+    BlockView view(wire);
+    auto element = view.elements_begin();
+    decodeFields(wire, element, view.elements_end(), obj, Index<0>());
+  }
+
+private:
+  static size_t
+  valueSize(const C&, Index<N_FIELDS>) noexcept
+  {
+    return 0;
+  }
+
+  template<size_t I>
+  static size_t
+  valueSize(const C& obj, Index<I>)
+  {
+    constexpr auto field = std::get<I>(Schema::describe().fields);
+    using Codec = TlvValueCodec<typename decltype(field)::ValueType>;
+    return Codec::size(field.type, obj.*field.member) + valueSize(obj, Index<I + 1>());
+  }
+
+  template<encoding::Tag TAG>
+  static size_t
+  prependFields(EncodingImpl<TAG>&, const C&, Index<0>) noexcept
+  {
+    return 0;
+  }
+
+  template<encoding::Tag TAG, size_t I>
+  static size_t
+  prependFields(EncodingImpl<TAG>& encoder, const C& obj, Index<I>)
+  {
+    // fields are prepended in reverse order
+    constexpr auto field = std::get<I - 1>(Schema::describe().fields);
+    using Codec = TlvValueCodec<typename decltype(field)::ValueType>;
+    size_t length = Codec::prepend(encoder, field.type, obj.*field.member);
+    return length + prependFields(encoder, obj, Index<I - 1>());
+  }
+
+  static void
+  decodeFields(const Block&, BlockView::element_iterator&, const BlockView::element_iterator&,
+               C&, Index<N_FIELDS>) noexcept
+  {
+  }
+
+  template<size_t I>
+  static void
+  decodeFields(const Block& wire, BlockView::element_iterator& element,
+               const BlockView::element_iterator& end, C& obj, Index<I>)
+  {
+    constexpr auto field = std::get<I>(Schema::describe().fields);
+    using Codec = TlvValueCodec<typename decltype(field)::ValueType>;
+    if (element != end && element->type() == field.type) {
+      Codec::template decode<E>(wire, *element, obj.*field.member);
+      ++element;
+    }
+    else {
+      Codec::template decodeAbsent<E>(field.name, obj.*field.member);
+    }
+    decodeFields(wire, element, end, obj, Index<I + 1>());
+  }
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_DETAIL_TLV_SCHEMA_HPP
@@ -66,6 +66,13 @@ readNonNegativeInteger(const Block& block)
   return tlv::readNonNegativeInteger(block.value_size(), begin, block.value_end());
 }
 
+uint64_t
+readNonNegativeInteger(const BlockView& view)
+{
+  auto begin = view.value_begin();
+  return tlv::readNonNegativeInteger(view.value_size(), begin, view.value_end());
+}
+
 // ---- empty ----
 
 template<Tag TAG>
@@ -23,6 +23,7 @@
 #define NDN_CXX_ENCODING_BLOCK_HELPERS_HPP
 
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/util/concepts.hpp"
 
@@ -61,6 +62,13 @@ makeNonNegativeIntegerBlock(uint32_t type, uint64_t value);
 uint64_t
 readNonNegativeInteger(const Block& block);
 
+/** @brief Read a non-negative integer from a TLV element view.
+ *  @param view the TLV element
+ *  @throw tlv::Error the element does not contain a non-negative integer
+ */
+uint64_t
+readNonNegativeInteger(const BlockView& view);
+
 /** @brief Read a non-negative integer from a TLV element and cast to the specified type.
  *  @tparam R result type, must be an integral type
  *  @param block the TLV element
@@ -93,6 +101,38 @@ readNonNegativeIntegerAs(const Block& block)
   return static_cast<R>(readNonNegativeIntegerAs<std::underlying_type_t<R>>(block));
 }
 
+/** @brief Read a non-negative integer from a TLV element view and cast to the specified type.
+ *  @tparam R result type, must be an integral type
+ *  @param view the TLV element
+ *  @throw tlv::Error the element does not contain a valid non-negative integer or the number
+ *                    cannot be represented in R
+ */
+template<typename R>
+std::enable_if_t<std::is_integral<R>::value, R>
+readNonNegativeIntegerAs(const BlockView& view)
+{
+  uint64_t value = readNonNegativeInteger(view);
+  if (value > std::numeric_limits<R>::max()) {
+    NDN_THROW(tlv::Error("Value in TLV element of type " + to_string(view.type()) + " is too large"));
+  }
+  return static_cast<R>(value);
+}
+
+/** @brief Read a non-negative integer from a TLV element view and cast to the specified type.
+ *  @tparam R result type, must be an enumeration type
+ *  @param view the TLV element
+ *  @throw tlv::Error the element does not contain a valid non-negative integer or the number
+ *                    cannot be represented in R
+ *  @warning If R is an unscoped enum type, it must have a fixed underlying type. Otherwise, this
+ *           function may trigger unspecified behavior.
+ */
+template<typename R>
+std::enable_if_t<std::is_enum<R>::value, R>
+readNonNegativeIntegerAs(const BlockView& view)
+{
+  return static_cast<R>(readNonNegativeIntegerAs<std::underlying_type_t<R>>(view));
+}
+
 /** @brief Prepend an empty TLV element.
  *  @param encoder an EncodingBuffer or EncodingEstimator
  *  @param type TLV-TYPE number
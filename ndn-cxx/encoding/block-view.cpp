@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/block-view.hpp"
+
+#include <algorithm>
+
+namespace ndn {
+
+BlockView::BlockView(const Block& block) noexcept
+  : m_type(block.type())
+{
+  if (block.hasWire()) {
+    m_begin = block.data();
+    m_end = m_begin + block.size();
+  }
+  auto value = block.value_bytes();
+  m_valueBegin = value.data();
+  m_valueEnd = m_valueBegin + value.size();
+}
+
+BlockView::BlockView(span<const uint8_t> buffer)
+{
+  const uint8_t* end = buffer.data() + buffer.size();
+  uint64_t length = parseTypeLength(buffer.data(), end);
+  if (length > static_cast<uint64_t>(end - m_valueBegin)) {
+    NDN_THROW(Block::Error("Not enough bytes in the buffer to fully parse TLV"));
+  }
+  m_valueEnd = m_end = m_valueBegin + length;
+}
+
+uint64_t
+BlockView::parseTypeLength(const uint8_t* begin, const uint8_t* end)
+{
+  auto pos = begin;
+  m_type = tlv::readType(pos, end);
+  uint64_t length = tlv::readVarNumber(pos, end);
+  // pos now points to TLV-VALUE
+
+  m_begin = begin;
+  m_valueBegin = pos;
+  return length;
+}
+
+BlockView::element_iterator
+BlockView::find(uint32_t type) const
+{
+  return std::find_if(elements_begin(), elements_end(),
+                      [type] (const BlockView& element) { return element.type() == type; });
+}
+
+BlockView
+BlockView::get(uint32_t type) const
+{
+  auto it = find(type);
+  if (it != elements_end()) {
+    return *it;
+  }
+
+  NDN_THROW(Block::Error("No sub-element of type " + to_string(type) +
+                         " found in block of type " + to_string(m_type)));
+}
+
+void
+BlockView::element_iterator::parse()
+{
+  if (m_pos == m_end) {
+    m_element = {};
+    return;
+  }
+
+  uint64_t length = m_element.parseTypeLength(m_pos, m_end);
+  if (length > static_cast<uint64_t>(m_end - m_element.m_valueBegin)) {
+    NDN_THROW(Block::Error("TLV-LENGTH of sub-element of type " + to_string(m_element.m_type) +
+                           " exceeds TLV-VALUE boundary of parent block"));
+  }
+  m_element.m_valueEnd = m_element.m_end = m_element.m_valueBegin + length;
+}
+
+} // namespace ndn
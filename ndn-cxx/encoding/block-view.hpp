@@ -0,0 +1,308 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_ENCODING_BLOCK_VIEW_HPP
+#define NDN_CXX_ENCODING_BLOCK_VIEW_HPP
+
+#include "ndn-cxx/encoding/block.hpp"
+
+#include <boost/range/iterator_range_core.hpp>
+
+namespace ndn {
+
+/**
+ * @brief Read-only, non-owning view of a TLV element.
+ *
+ * A BlockView refers to the TLV-TYPE and the TLV-VALUE of an element stored in a buffer that is
+ * owned elsewhere, usually by a Block. Unlike Block, creating or copying a BlockView neither
+ * allocates memory nor touches a reference count, and iterating over its sub-elements does not
+ * materialize them. It is therefore suitable for traversing an element during decoding, where
+ * only those sub-elements that must outlive the decoding are converted to Block.
+ *
+ * @warning A BlockView becomes dangling as soon as the underlying buffer is released.
+ */
+class BlockView
+{
+public:
+  class element_iterator;
+  using element_range = boost::iterator_range<element_iterator>;
+
+public:
+  /** @brief Create an invalid view
+   *  @post `isValid() == false`
+   */
+  BlockView() noexcept = default;
+
+  /** @brief Create a view of @p block
+   *
+   *  The view reflects the TLV-TYPE and the TLV-VALUE of @p block. If @p block has sub-elements
+   *  that have not been encoded, they are not visible through the view.
+   */
+  BlockView(const Block& block) noexcept;
+
+  /** @brief Parse the TLV element found at the beginning of @p buffer
+   *  @param buffer sequence of bytes containing a TLV element; the element must be found at
+   *                the beginning of the buffer but does not need to span the entire buffer
+   *  @throw tlv::Error Type-Length parsing fails, or TLV-LENGTH exceeds the size of @p buffer
+   */
+  explicit
+  BlockView(span<const uint8_t> buffer);
+
+public: // wire format
+  bool
+  isValid() const noexcept
+  {
+    return m_type != tlv::Invalid;
+  }
+
+  /** @brief Check if the view refers to the complete Type-Length-Value of the element
+   *
+   *  This is false if the view was created from a Block without a fully encoded wire.
+   */
+  bool
+  hasWire() const noexcept
+  {
+    return m_begin != m_end;
+  }
+
+  /** @brief Return a pointer to the beginning of the encoded element
+   *  @pre `hasWire() == true`
+   */
+  const uint8_t*
+  begin() const noexcept
+  {
+    return m_begin;
+  }
+
+  /** @brief Return a pointer past the end of the encoded element
+   *  @pre `hasWire() == true`
+   */
+  const uint8_t*
+  end() const noexcept
+  {
+    return m_end;
+  }
+
+  /** @brief Return the size of the encoded element, i.e., of the whole TLV
+   *  @pre `hasWire() == true`
+   */
+  size_t
+  size() const noexcept
+  {
+    return static_cast<size_t>(m_end - m_begin);
+  }
+
+  /** @brief Return a read-only view of the encoded element
+   *  @pre `hasWire() == true`
+   */
+  span<const uint8_t>
+  wire() const noexcept
+  {
+    return {m_begin, m_end};
+  }
+
+public: // type and value
+  uint32_t
+  type() const noexcept
+  {
+    return m_type;
+  }
+
+  const uint8_t*
+  value_begin() const noexcept
+  {
+    return m_valueBegin;
+  }
+
+  const uint8_t*
+  value_end() const noexcept
+  {
+    return m_valueEnd;
+  }
+
+  size_t
+  value_size() const noexcept
+  {
+    return static_cast<size_t>(m_valueEnd - m_valueBegin);
+  }
+
+  span<const uint8_t>
+  value_bytes() const noexcept
+  {
+    return {m_valueBegin, m_valueEnd};
+  }
+
+  /** @brief Return a raw pointer to the beginning of TLV-VALUE, or nullptr if TLV-VALUE is empty
+   */
+  const uint8_t*
+  value() const noexcept
+  {
+    return value_size() > 0 ? m_valueBegin : nullptr;
+  }
+
+public: // sub-elements
+  /** @brief Return an iterator to the first sub-element found in TLV-VALUE
+   *  @throw tlv::Error the first sub-element cannot be parsed
+   */
+  element_iterator
+  elements_begin() const;
+
+  element_iterator
+  elements_end() const noexcept;
+
+  /** @brief Return the range of sub-elements found in TLV-VALUE
+   *  @throw tlv::Error the first sub-element cannot be parsed
+   *  @note Sub-elements are parsed lazily as the range is traversed; advancing an iterator
+   *        throws tlv::Error if TLV-VALUE is not a sequence of TLV elements.
+   */
+  element_range
+  elements() const;
+
+  /** @brief Find the first sub-element of the specified TLV-TYPE
+   *  @return iterator to the found sub-element, or elements_end() if no such sub-element exists
+   *  @throw tlv::Error TLV-VALUE is not a sequence of TLV elements
+   */
+  element_iterator
+  find(uint32_t type) const;
+
+  /** @brief Return the first sub-element of the specified TLV-TYPE
+   *  @throw tlv::Error TLV-VALUE is not a sequence of TLV elements, or a sub-element of the
+   *                    specified type does not exist
+   */
+  BlockView
+  get(uint32_t type) const;
+
+private:
+  /** @brief Parse TLV-TYPE and TLV-LENGTH found at @p begin
+   *  @return TLV-LENGTH, which has not been checked against @p end
+   *  @throw tlv::Error Type-Length parsing fails
+   */
+  uint64_t
+  parseTypeLength(const uint8_t* begin, const uint8_t* end);
+
+private:
+  const uint8_t* m_begin = nullptr;
+  const uint8_t* m_end = nullptr;
+  const uint8_t* m_valueBegin = nullptr;
+  const uint8_t* m_valueEnd = nullptr;
+  uint32_t m_type = tlv::Invalid;
+
+  friend class element_iterator;
+};
+
+/**
+ * @brief Forward iterator over the sub-elements of a BlockView.
+ */
+class BlockView::element_iterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type        = BlockView;
+  using difference_type   = std::ptrdiff_t;
+  using pointer           = const BlockView*;
+  using reference         = const BlockView&;
+
+  element_iterator() noexcept = default;
+
+  reference
+  operator*() const noexcept
+  {
+    return m_element;
+  }
+
+  pointer
+  operator->() const noexcept
+  {
+    return &m_element;
+  }
+
+  /** @throw tlv::Error the next sub-element cannot be parsed
+   */
+  element_iterator&
+  operator++()
+  {
+    m_pos = m_element.m_end;
+    parse();
+    return *this;
+  }
+
+  element_iterator
+  operator++(int)
+  {
+    element_iterator copy(*this);
+    ++*this;
+    return copy;
+  }
+
+  friend bool
+  operator==(const element_iterator& lhs, const element_iterator& rhs) noexcept
+  {
+    return lhs.m_pos == rhs.m_pos;
+  }
+
+  friend bool
+  operator!=(const element_iterator& lhs, const element_iterator& rhs) noexcept
+  {
+    return lhs.m_pos != rhs.m_pos;
+  }
+
+private:
+  element_iterator(const uint8_t* pos, const uint8_t* end)
+    : m_pos(pos)
+    , m_end(end)
+  {
+    parse();
+  }
+
+  void
+  parse();
+
+private:
+  const uint8_t* m_pos = nullptr; ///< beginning of the current sub-element
+  const uint8_t* m_end = nullptr; ///< end of parent TLV-VALUE
+  BlockView m_element;
+
+  friend BlockView;
+};
+
+inline BlockView::element_iterator
+BlockView::elements_begin() const
+{
+  return {m_valueBegin, m_valueEnd};
+}
+
+inline BlockView::element_iterator
+BlockView::elements_end() const noexcept
+{
+  element_iterator it;
+  it.m_pos = it.m_end = m_valueEnd;
+  return it;
+}
+
+inline BlockView::element_range
+BlockView::elements() const
+{
+  return {elements_begin(), elements_end()};
+}
+
+} // namespace ndn
+
+#endif // NDN_CXX_ENCODING_BLOCK_VIEW_HPP
@@ -22,6 +22,7 @@
  */
 
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv.hpp"
@@ -117,6 +118,25 @@ Block::Block(const Block& block, Block::const_iterator begin, Block::const_itera
 {
 }
 
+Block::Block(const Block& block, const BlockView& element)
+  : m_buffer(block.m_buffer)
+  , m_type(element.type())
+{
+  if (m_buffer == nullptr || !element.hasWire() ||
+      element.begin() < m_buffer->data() || element.end() > m_buffer->data() + m_buffer->size()) {
+    NDN_THROW(std::invalid_argument("Element is not within the buffer of the Block"));
+  }
+
+  auto toIterator = [this] (const uint8_t* pos) {
+    return m_buffer->begin() + (pos - m_buffer->data());
+  };
+  m_begin = toIterator(element.begin());
+  m_end = toIterator(element.end());
+  m_valueBegin = toIterator(element.value_begin());
+  m_valueEnd = toIterator(element.value_end());
+  m_size = element.size();
+}
+
 Block::Block(ConstBufferPtr buffer, uint32_t type,
              Buffer::const_iterator begin, Buffer::const_iterator end,
              Buffer::const_iterator valueBegin, Buffer::const_iterator valueEnd)
@@ -37,6 +37,8 @@ class const_buffer;
 
 namespace ndn {
 
+class BlockView;
+
 /**
  * @brief Represents a TLV element of the NDN packet format.
  * @sa https://named-data.net/doc/NDN-packet-spec/0.3/tlv.html
@@ -126,6 +128,15 @@ public: // construction, assignment
   Block(const Block& block, Block::const_iterator begin, Block::const_iterator end,
         bool verifyLength = true);
 
+  /** @brief Create a Block for a TLV element within the wire Buffer of an existing Block
+   *  @param block a Block whose buffer contains the element referred to by @p element
+   *  @param element a view of a TLV element within the buffer of @p block
+   *  @throw std::invalid_argument @p element is not within the buffer of @p block
+   *  @note This constructor does not parse the element; the new Block shares the underlying
+   *        buffer with @p block.
+   */
+  Block(const Block& block, const BlockView& element);
+
   /** @brief Create a Block from a wire Buffer without parsing
    *  @param buffer a Buffer containing a TLV element at [@p begin,@p end)
    *  @param type TLV-TYPE
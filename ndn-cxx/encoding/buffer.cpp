@@ -24,6 +24,86 @@
 
 namespace ndn {
 
+#ifdef NDN_CXX_BUFFER_HAS_STORAGE_ACCESS
+// libstdc++'s std::vector keeps its storage in _M_impl, a protected member of its base class.
+// A vector of trivially constructible bytes remains valid when its size is adjusted directly
+// within its capacity, or when it is pointed at memory that it never reallocates or frees.
+
+void
+Buffer::resize(size_type size, NoInit)
+{
+  if (size <= this->size()) {
+    std::vector<uint8_t>::resize(size);
+    return;
+  }
+  if (size > capacity()) {
+    reserve(std::max(size, 2 * this->size()));
+  }
+  this->_M_impl._M_finish = this->_M_impl._M_start + size;
+}
+
+/**
+ * @brief Releases a Buffer created by makeExternalBuffer(), after detaching it from the
+ *        external memory, and then releases the owner of that memory.
+ */
+struct Buffer::ExternalDeleter
+{
+  shared_ptr<const void> owner;
+
+  void
+  operator()(const Buffer* buffer) const noexcept
+  {
+    auto* mutableBuffer = const_cast<Buffer*>(buffer);
+    mutableBuffer->_M_impl._M_start = nullptr;
+    mutableBuffer->_M_impl._M_finish = nullptr;
+    mutableBuffer->_M_impl._M_end_of_storage = nullptr;
+    delete mutableBuffer;
+  }
+};
+
+shared_ptr<const Buffer>
+makeExternalBuffer(span<const uint8_t> memory, shared_ptr<const void> owner)
+{
+  if (memory.empty()) {
+    return std::make_shared<const Buffer>();
+  }
+
+  auto buffer = make_unique<Buffer>();
+  // the memory is never written through the Buffer, which is only handed out as const
+  auto begin = const_cast<uint8_t*>(memory.data());
+  buffer->_M_impl._M_start = begin;
+  buffer->_M_impl._M_finish = buffer->_M_impl._M_end_of_storage = begin + memory.size();
+  return shared_ptr<const Buffer>(buffer.release(), Buffer::ExternalDeleter{std::move(owner)});
+}
+
+bool
+isExternalBuffer(const shared_ptr<const Buffer>& buffer) noexcept
+{
+  return std::get_deleter<Buffer::ExternalDeleter>(buffer) != nullptr;
+}
+
+#else
+
+void
+Buffer::resize(size_type size, NoInit)
+{
+  std::vector<uint8_t>::resize(size);
+}
+
+shared_ptr<const Buffer>
+makeExternalBuffer(span<const uint8_t> memory, shared_ptr<const void>)
+{
+  return std::make_shared<const Buffer>(memory.begin(), memory.end());
+}
+
+bool
+isExternalBuffer(const shared_ptr<const Buffer>&) noexcept
+{
+  return false;
+}
+
+#endif // NDN_CXX_BUFFER_HAS_STORAGE_ACCESS
+
 std::ostream&
 boost_test_print_type(std::ostream& os, const Buffer& buf)
 {
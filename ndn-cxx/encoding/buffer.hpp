@@ -25,10 +25,17 @@
 #define NDN_CXX_ENCODING_BUFFER_HPP
 
 #include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/util/span.hpp"
 
 #include <initializer_list>
 #include <vector>
 
+// Buffer::NoInit and makeExternalBuffer() need access to the pointers of libstdc++'s std::vector.
+// With other standard libraries, they fall back to zero-filling and copying, respectively.
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_DEBUG)
+#define NDN_CXX_BUFFER_HAS_STORAGE_ACCESS
+#endif
+
 namespace ndn {
 
 /**
@@ -40,6 +47,13 @@ namespace ndn {
  */
 class Buffer : public std::vector<uint8_t>
 {
+public:
+  /** @brief Tag type selecting the overloads that leave new bytes uninitialized
+   */
+  struct NoInit
+  {
+  };
+
 public:
   /** @brief Creates an empty Buffer
    */
@@ -72,6 +86,17 @@ public:
   {
   }
 
+  /** @brief Creates a Buffer with pre-allocated size, without initializing its content
+   *  @param size size of the Buffer to be allocated
+   *
+   *  This avoids zero-filling a buffer that is about to be overwritten. The content is
+   *  indeterminate and must be written before it is read.
+   */
+  Buffer(size_t size, NoInit)
+  {
+    resize(size, NoInit{});
+  }
+
   /** @brief Creates a Buffer by copying contents from a raw buffer
    *  @param buf const pointer to buffer to copy
    *  @param length length of the buffer to copy
@@ -99,6 +124,15 @@ public:
   {
   }
 
+  using std::vector<uint8_t>::resize;
+
+  /** @brief Resizes the Buffer, leaving any bytes that are added uninitialized
+   *
+   *  Capacity grows geometrically, as with `resize(size_type)`.
+   */
+  void
+  resize(size_type size, NoInit);
+
   /** @return pointer to the first byte of the buffer, cast to the requested type T
    */
   template<class T>
@@ -116,6 +150,15 @@ public:
   {
     return reinterpret_cast<const T*>(data());
   }
+
+private:
+  struct ExternalDeleter;
+
+  friend shared_ptr<const Buffer>
+  makeExternalBuffer(span<const uint8_t> memory, shared_ptr<const void> owner);
+
+  friend bool
+  isExternalBuffer(const shared_ptr<const Buffer>& buffer) noexcept;
 };
 
 inline
@@ -138,6 +181,27 @@ boost_test_print_type(std::ostream&, const Buffer&);
 using BufferPtr = shared_ptr<Buffer>;
 using ConstBufferPtr = shared_ptr<const Buffer>;
 
+/**
+ * @brief Create a read-only Buffer that refers to externally owned memory, without copying it.
+ * @param memory the memory region, e.g., a file mapped into memory
+ * @param owner an object that keeps @p memory valid while it is alive, e.g., a `shared_ptr` with
+ *              a custom deleter that unmaps the region; it is released together with the last
+ *              reference to the returned Buffer
+ *
+ * The returned Buffer can be used wherever a ConstBufferPtr is accepted, such as Block and
+ * Data::setContent(). It must not be modified through `const_pointer_cast`; a copy of it is an
+ * ordinary Buffer that owns its bytes. If the standard library does not permit a `std::vector`
+ * to refer to external memory, the bytes are copied and @p owner is released immediately.
+ */
+shared_ptr<const Buffer>
+makeExternalBuffer(span<const uint8_t> memory, shared_ptr<const void> owner);
+
+/**
+ * @brief Return whether @p buffer was created by makeExternalBuffer() and refers to external memory.
+ */
+bool
+isExternalBuffer(const shared_ptr<const Buffer>& buffer) noexcept;
+
 } // namespace ndn
 
 #endif // NDN_CXX_ENCODING_BUFFER_HPP
@@ -29,15 +29,17 @@ namespace encoding {
 namespace endian = boost::endian;
 
 Encoder::Encoder(size_t totalReserve, size_t reserveFromBack)
-  : m_buffer(make_shared<Buffer>(totalReserve))
+  : m_buffer(make_shared<Buffer>(totalReserve, Buffer::NoInit{}))
 {
   m_begin = m_end = m_buffer->end() - (reserveFromBack < totalReserve ? reserveFromBack : 0);
 }
 
 Encoder::Encoder(const Block& block)
-  : m_buffer(const_pointer_cast<Buffer>(block.getBuffer()))
-  , m_begin(m_buffer->begin() + (block.begin() - m_buffer->begin()))
-  , m_end(m_buffer->begin()   + (block.end()   - m_buffer->begin()))
+  // external memory is read-only, so the encoder works on a copy of it
+  : m_buffer(isExternalBuffer(block.getBuffer()) ? make_shared<Buffer>(*block.getBuffer())
+                                                 : const_pointer_cast<Buffer>(block.getBuffer()))
+  , m_begin(m_buffer->begin() + (block.begin() - block.getBuffer()->begin()))
+  , m_end(m_buffer->begin()   + (block.end()   - block.getBuffer()->begin()))
 {
 }
 
@@ -72,7 +74,7 @@ Encoder::reserve(size_t size, bool addInFront)
     size_t diffEnd = m_buffer->end() - m_end;
     size_t diffBegin = m_buffer->end() - m_begin;
 
-    Buffer* buf = new Buffer(size);
+    Buffer* buf = new Buffer(size, Buffer::NoInit{});
     std::copy_backward(m_buffer->begin(), m_buffer->end(), buf->end());
 
     m_buffer.reset(buf);
@@ -84,7 +86,7 @@ Encoder::reserve(size_t size, bool addInFront)
     size_t diffEnd = m_end - m_buffer->begin();
     size_t diffBegin = m_begin - m_buffer->begin();
 
-    Buffer* buf = new Buffer(size);
+    Buffer* buf = new Buffer(size, Buffer::NoInit{});
     std::copy(m_buffer->begin(), m_buffer->end(), buf->begin());
 
     m_buffer.reset(buf);
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/face-metrics.hpp"
+#include "ndn-cxx/transport/transport.hpp"
+
+#include <cmath>
+
+namespace ndn {
+
+static_assert(LatencyHistogram::getBucketIndex(31) == 31, "");
+static_assert(LatencyHistogram::getBucketIndex(32) == 32, "");
+static_assert(LatencyHistogram::getBucketIndex(std::numeric_limits<uint64_t>::max()) ==
+              LatencyHistogram::BUCKET_COUNT - 1, "");
+static_assert(LatencyHistogram::getBucketLowerBound(LatencyHistogram::getBucketIndex(1000)) <= 1000, "");
+
+void
+LatencyHistogram::record(time::nanoseconds duration) noexcept
+{
+  auto ns = static_cast<uint64_t>(std::max<time::nanoseconds::rep>(duration.count(), 0));
+  m_buckets[getBucketIndex(ns)].add();
+  m_sum.add(ns);
+  if (ns > m_max.load(std::memory_order_relaxed)) {
+    m_max.store(ns, std::memory_order_relaxed);
+  }
+  m_count.add();
+}
+
+time::nanoseconds
+LatencyHistogram::getMean() const noexcept
+{
+  uint64_t count = getCount();
+  return time::nanoseconds(count == 0 ? 0 : m_sum.get() / count);
+}
+
+time::nanoseconds
+LatencyHistogram::getPercentile(double percentile) const noexcept
+{
+  uint64_t count = getCount();
+  if (count == 0) {
+    return 0_ns;
+  }
+
+  percentile = std::min(std::max(percentile, 0.0), 100.0);
+  auto rank = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile / 100.0 * count)), 1);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+    seen += getBucketCount(i);
+    if (seen >= rank) {
+      uint64_t upper = i + 1 < BUCKET_COUNT ? getBucketLowerBound(i + 1) - 1 :
+                                              std::numeric_limits<uint64_t>::max();
+      return time::nanoseconds(std::min(upper, m_max.load(std::memory_order_relaxed)));
+    }
+  }
+  return getMax();
+}
+
+size_t
+FaceMetrics::getSendQueueLength() const noexcept
+{
+  return m_transport == nullptr ? 0 : m_transport->getSendQueueLength();
+}
+
+} // namespace ndn
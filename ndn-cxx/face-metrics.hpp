@@ -0,0 +1,242 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_FACE_METRICS_HPP
+#define NDN_CXX_FACE_METRICS_HPP
+
+#include "ndn-cxx/util/time.hpp"
+
+#include <array>
+#include <atomic>
+
+namespace ndn {
+
+class Transport;
+
+/**
+ * @brief A monotonically increasing 64-bit counter.
+ *
+ * The counter is incremented by a single thread, without atomic read-modify-write operations,
+ * and can be read from any thread.
+ */
+class MetricsCounter : noncopyable
+{
+public:
+  uint64_t
+  get() const noexcept
+  {
+    return m_value.load(std::memory_order_relaxed);
+  }
+
+  operator uint64_t() const noexcept
+  {
+    return get();
+  }
+
+  /**
+   * @brief Increment the counter by @p n.
+   * @warning Concurrent increments from multiple threads are not supported.
+   */
+  void
+  add(uint64_t n = 1) noexcept
+  {
+    m_value.store(get() + n, std::memory_order_relaxed);
+  }
+
+  MetricsCounter&
+  operator++() noexcept
+  {
+    add();
+    return *this;
+  }
+
+private:
+  std::atomic<uint64_t> m_value{0};
+};
+
+/**
+ * @brief Histogram of durations with bounded relative error, in the style of HdrHistogram.
+ *
+ * Durations are recorded in nanoseconds into log-linear buckets: each power-of-two range is
+ * divided into 16 equal sub-buckets, so that the value reported for any percentile is within
+ * 1/16 (6.25%) of the recorded duration. Recording a duration costs a few arithmetic
+ * instructions and no memory allocation.
+ *
+ * Like MetricsCounter, the histogram is updated by a single thread and can be read from any
+ * thread. A reader may observe a recording that is only partially applied, e.g., the bucket
+ * has been incremented but the total count has not.
+ */
+class LatencyHistogram : noncopyable
+{
+public:
+  static constexpr size_t SUB_BUCKET_BITS = 4;
+  static constexpr size_t SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+  static constexpr size_t BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+  /**
+   * @brief Record a duration; negative durations are recorded as zero.
+   * @warning Concurrent recordings from multiple threads are not supported.
+   */
+  void
+  record(time::nanoseconds duration) noexcept;
+
+  /**
+   * @brief Return the number of recorded durations.
+   */
+  uint64_t
+  getCount() const noexcept
+  {
+    return m_count.get();
+  }
+
+  /**
+   * @brief Return the arithmetic mean of recorded durations, or zero if none has been recorded.
+   */
+  time::nanoseconds
+  getMean() const noexcept;
+
+  /**
+   * @brief Return the largest recorded duration.
+   */
+  time::nanoseconds
+  getMax() const noexcept
+  {
+    return time::nanoseconds(m_max.load(std::memory_order_relaxed));
+  }
+
+  /**
+   * @brief Return an upper bound of the duration at @p percentile.
+   * @param percentile a number between 0 and 100
+   * @return the upper end of the bucket that contains the requested percentile, which does not
+   *         exceed getMax(); zero if no duration has been recorded
+   */
+  time::nanoseconds
+  getPercentile(double percentile) const noexcept;
+
+  /**
+   * @brief Return the number of durations recorded in bucket @p index.
+   * @pre index < BUCKET_COUNT
+   */
+  uint64_t
+  getBucketCount(size_t index) const noexcept
+  {
+    return m_buckets[index].get();
+  }
+
+  /**
+   * @brief Return the bucket in which a duration of @p ns nanoseconds is recorded.
+   */
+  static constexpr size_t
+  getBucketIndex(uint64_t ns) noexcept
+  {
+    // durations shorter than 2*SUB_BUCKET_COUNT nanoseconds have a bucket each; beyond that,
+    // the bucket is determined by the position of the leading 1 bit and the next SUB_BUCKET_BITS
+    return ns < 2 * SUB_BUCKET_COUNT ?
+           static_cast<size_t>(ns) :
+           getBucketIndex(ns, static_cast<size_t>(63 - countLeadingZeros(ns)) - SUB_BUCKET_BITS);
+  }
+
+  /**
+   * @brief Return the smallest duration in nanoseconds recorded in bucket @p index.
+   */
+  static constexpr uint64_t
+  getBucketLowerBound(size_t index) noexcept
+  {
+    return index < 2 * SUB_BUCKET_COUNT ?
+           index :
+           (index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT) << (index / SUB_BUCKET_COUNT - 1);
+  }
+
+private:
+  static constexpr size_t
+  getBucketIndex(uint64_t ns, size_t shift) noexcept
+  {
+    return shift * SUB_BUCKET_COUNT + static_cast<size_t>(ns >> shift);
+  }
+
+  static constexpr int
+  countLeadingZeros(uint64_t x) noexcept
+  {
+    return __builtin_clzll(x);
+  }
+
+private:
+  MetricsCounter m_count;
+  MetricsCounter m_sum;
+  std::atomic<uint64_t> m_max{0};
+  std::array<MetricsCounter, BUCKET_COUNT> m_buckets;
+};
+
+/**
+ * @brief Packet counters and Interest latency statistics of a Face.
+ *
+ * The metrics are collected unconditionally. They are updated on the thread that runs the
+ * Face's io_service, and can be read from any thread without locking.
+ *
+ * @sa Face::getMetrics()
+ */
+class FaceMetrics : noncopyable
+{
+public:
+  explicit
+  FaceMetrics(const Transport* transport = nullptr) noexcept
+    : m_transport(transport)
+  {
+  }
+
+  /**
+   * @brief Return the number of packets queued in the transport and not yet fully written.
+   */
+  size_t
+  getSendQueueLength() const noexcept;
+
+public:
+  /// Interests received from the forwarder
+  MetricsCounter nInInterests;
+  /// Data received from the forwarder
+  MetricsCounter nInData;
+  /// Nacks received from the forwarder
+  MetricsCounter nInNacks;
+  /// Interests sent to the forwarder
+  MetricsCounter nOutInterests;
+  /// Data sent to the forwarder
+  MetricsCounter nOutData;
+  /// Nacks sent to the forwarder
+  MetricsCounter nOutNacks;
+  /// Interests expressed by the application that timed out
+  MetricsCounter nTimeouts;
+  /// bytes received from the forwarder, including link-layer headers
+  MetricsCounter nInBytes;
+  /// bytes sent to the forwarder, including link-layer headers
+  MetricsCounter nOutBytes;
+  /// outgoing packets dropped because they exceed MAX_NDN_PACKET_SIZE
+  MetricsCounter nOversizedDrops;
+
+  /// time from expressing an Interest to the invocation of its Data callback
+  LatencyHistogram interestDataLatency;
+
+private:
+  const Transport* m_transport;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_FACE_METRICS_HPP
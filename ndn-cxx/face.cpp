@@ -44,6 +44,15 @@
     }); \
   }
 
+// Operations submitted through these macros are queued in Face::Impl and executed in submission
+// order on the io_service thread. The callback runs only while Face::Impl is alive.
+#define SUBMIT_TO_IMPL \
+  { \
+    m_impl->submit(function<void()>([=, impl = m_impl.get()] {
+#define SUBMIT_TO_IMPL_END \
+    })); \
+  }
+
 namespace ndn {
 
 Face::OversizedPacketError::OversizedPacketError(char pktType, const Name& name, size_t wireSize)
@@ -145,7 +154,6 @@ void
 Face::construct(shared_ptr<Transport> transport, KeyChain& keyChain)
 {
   BOOST_ASSERT(m_impl == nullptr);
-  m_impl = make_shared<Impl>(*this, keyChain);
 
   if (transport == nullptr) {
     transport = makeDefaultTransport();
@@ -153,6 +161,9 @@ Face::construct(shared_ptr<Transport> transport, KeyChain& keyChain)
   }
   m_transport = std::move(transport);
 
+  // Impl refers to the transport, which must be set beforehand
+  m_impl = make_shared<Impl>(*this, keyChain);
+
   IO_CAPTURE_WEAK_IMPL(post) {
     impl->ensureConnected(false);
   } IO_CAPTURE_WEAK_IMPL_END
@@ -171,19 +182,45 @@ Face::expressInterest(const Interest& interest,
   auto interest2 = make_shared<Interest>(interest);
   interest2->getNonce();
 
-  IO_CAPTURE_WEAK_IMPL(post) {
-    impl->expressInterest(id, interest2, afterSatisfied, afterNacked, afterTimeout);
-  } IO_CAPTURE_WEAK_IMPL_END
+  // callbacks of a single Interest are stored in its PendingInterest record
+  PendingInterestCallbacks callbacks{afterSatisfied, afterNacked, afterTimeout};
+  m_impl->submit(Impl::InterestSubmission{id, std::move(interest2), std::move(callbacks)});
 
   return PendingInterestHandle(m_impl, id);
 }
 
+std::vector<PendingInterestHandle>
+Face::expressInterests(span<const Interest> interests,
+                       const DataCallback& afterSatisfied,
+                       const NackCallback& afterNacked,
+                       const TimeoutCallback& afterTimeout)
+{
+  std::vector<PendingInterestHandle> handles;
+  handles.reserve(interests.size());
+  // callbacks are stored once and shared by all PendingInterest records in the batch
+  auto callbacks = make_shared<const PendingInterestCallbacks>(
+                     PendingInterestCallbacks{afterSatisfied, afterNacked, afterTimeout});
+
+  for (const auto& interest : interests) {
+    auto id = m_impl->m_pendingInterestTable.allocateId();
+
+    auto interest2 = make_shared<Interest>(interest);
+    interest2->getNonce();
+
+    m_impl->enqueue(Impl::InterestSubmission{id, std::move(interest2), callbacks});
+    handles.push_back(PendingInterestHandle(m_impl, id));
+  }
+  m_impl->scheduleDrain();
+
+  return handles;
+}
+
 void
 Face::removeAllPendingInterests()
 {
-  IO_CAPTURE_WEAK_IMPL(post) {
+  SUBMIT_TO_IMPL {
     impl->removeAllPendingInterests();
-  } IO_CAPTURE_WEAK_IMPL_END
+  } SUBMIT_TO_IMPL_END
 }
 
 size_t
@@ -192,20 +229,31 @@ Face::getNPendingInterests() const
   return m_impl->m_pendingInterestTable.size();
 }
 
+const FaceMetrics&
+Face::getMetrics() const noexcept
+{
+  return m_impl->m_metrics;
+}
+
 void
 Face::put(Data data)
 {
-  IO_CAPTURE_WEAK_IMPL(post) {
-    impl->putData(data);
-  } IO_CAPTURE_WEAK_IMPL_END
+  m_impl->submit(std::move(data));
 }
 
 void
 Face::put(lp::Nack nack)
 {
-  IO_CAPTURE_WEAK_IMPL(post) {
-    impl->putNack(nack);
-  } IO_CAPTURE_WEAK_IMPL_END
+  m_impl->submit(std::move(nack));
+}
+
+void
+Face::put(span<const Data> data)
+{
+  for (const auto& d : data) {
+    m_impl->enqueue(Data(d));
+  }
+  m_impl->scheduleDrain();
 }
 
 RegisteredPrefixHandle
@@ -235,9 +283,9 @@ Face::setInterestFilter(const InterestFilter& filter, const InterestCallback& on
 {
   auto id = m_impl->m_interestFilterTable.allocateId();
 
-  IO_CAPTURE_WEAK_IMPL(post) {
+  SUBMIT_TO_IMPL {
     impl->setInterestFilter(id, filter, onInterest);
-  } IO_CAPTURE_WEAK_IMPL_END
+  } SUBMIT_TO_IMPL_END
 
   return InterestFilterHandle(m_impl, id);
 }
@@ -290,11 +338,11 @@ Face::doProcessEvents(time::milliseconds timeout, bool keepThread)
 void
 Face::shutdown()
 {
-  IO_CAPTURE_WEAK_IMPL(post) {
+  SUBMIT_TO_IMPL {
     impl->shutdown();
     if (m_transport->getState() != Transport::State::CLOSED)
       m_transport->close();
-  } IO_CAPTURE_WEAK_IMPL_END
+  } SUBMIT_TO_IMPL_END
 }
 
 /**
@@ -311,6 +359,7 @@ extractLpLocalFields(NetPkt& netPacket, const lp::Packet& lpPacket)
 void
 Face::onReceiveElement(const Block& blockFromDaemon)
 {
+  m_impl->m_metrics.nInBytes.add(blockFromDaemon.size());
   lp::Packet lpPacket(blockFromDaemon); // bare Interest/Data is a valid lp::Packet,
                                         // no need to distinguish
 
@@ -324,11 +373,13 @@ Face::onReceiveElement(const Block& blockFromDaemon)
         nack->setHeader(lpPacket.get<lp::NackField>());
         extractLpLocalFields(*nack, lpPacket);
         NDN_LOG_DEBUG(">N " << nack->getInterest() << '~' << nack->getHeader().getReason());
+        ++m_impl->m_metrics.nInNacks;
         m_impl->nackPendingInterests(*nack);
       }
       else {
         extractLpLocalFields(*interest, lpPacket);
         NDN_LOG_DEBUG(">I " << *interest);
+        ++m_impl->m_metrics.nInInterests;
         m_impl->processIncomingInterest(std::move(interest));
       }
       break;
@@ -337,6 +388,7 @@ Face::onReceiveElement(const Block& blockFromDaemon)
       auto data = make_shared<Data>(netPacket);
       extractLpLocalFields(*data, lpPacket);
       NDN_LOG_DEBUG(">D " << data->getName());
+      ++m_impl->m_metrics.nInData;
       m_impl->satisfyPendingInterests(*data);
       break;
     }
@@ -23,6 +23,7 @@
 #define NDN_CXX_FACE_HPP
 
 #include "ndn-cxx/data.hpp"
+#include "ndn-cxx/face-metrics.hpp"
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/interest-filter.hpp"
 #include "ndn-cxx/detail/asio-fwd.hpp"
@@ -31,6 +32,7 @@
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/security/key-chain.hpp"
 #include "ndn-cxx/security/signing-info.hpp"
+#include "ndn-cxx/util/span.hpp"
 
 namespace ndn {
 
@@ -230,6 +232,8 @@ public: // consumer
    *                     is returned within InterestLifetime
    * @throw OversizedPacketError encoded Interest size exceeds MAX_NDN_PACKET_SIZE
    * @return A handle for canceling the pending Interest.
+   * @note This method may be called from any thread. Packets submitted through expressInterest()
+   *       and put() are processed on the io_service thread, in the order they were submitted.
    */
   PendingInterestHandle
   expressInterest(const Interest& interest,
@@ -237,6 +241,30 @@ public: // consumer
                   const NackCallback& afterNacked,
                   const TimeoutCallback& afterTimeout);
 
+  /**
+   * @brief Express a batch of Interests.
+   * @param interests the Interests; copies will be made, so that the caller is not
+   *                  required to maintain the arguments unchanged
+   * @param afterSatisfied function to be invoked if Data is returned for any of the Interests
+   * @param afterNacked function to be invoked if Network NACK is returned for any of the Interests
+   * @param afterTimeout function to be invoked if neither Data nor Network NACK
+   *                     is returned for an Interest within its InterestLifetime
+   * @throw OversizedPacketError encoded Interest size exceeds MAX_NDN_PACKET_SIZE
+   * @return Handles for canceling the pending Interests, in the same order as @p interests.
+   *
+   * This is equivalent to calling expressInterest() on each Interest in turn, except that the
+   * whole batch is inserted into the pending Interest table, encoded, and handed to the transport
+   * together. The same callbacks are shared by all Interests in the batch; use the Interest passed
+   * to each callback to identify the request.
+   *
+   * @note This method may be called from any thread.
+   */
+  std::vector<PendingInterestHandle>
+  expressInterests(span<const Interest> interests,
+                   const DataCallback& afterSatisfied,
+                   const NackCallback& afterNacked,
+                   const TimeoutCallback& afterTimeout);
+
   /**
    * @brief Cancel all previously expressed Interests.
    */
@@ -249,6 +277,15 @@ public: // consumer
   size_t
   getNPendingInterests() const;
 
+  /**
+   * @brief Get packet counters and Interest latency statistics.
+   *
+   * The returned object remains valid for the lifetime of the Face. Its values can be read from
+   * any thread, while the Face is being used on its io_service thread.
+   */
+  const FaceMetrics&
+  getMetrics() const noexcept;
+
 public: // producer
   /**
    * @brief Set InterestFilter to dispatch incoming matching interest to onInterest
@@ -350,6 +387,7 @@ public: // producer
    * of the local NDN forwarder if forwarder is configured to accept unsolicited Data.
    *
    * @throw OversizedPacketError encoded Data size exceeds MAX_NDN_PACKET_SIZE
+   * @note This method may be called from any thread.
    */
   void
   put(Data data);
@@ -359,10 +397,25 @@ public: // producer
    * @param nack the Nack; a copy will be made, so that the caller is not required to
    *             maintain the argument unchanged
    * @throw OversizedPacketError encoded Nack size exceeds MAX_NDN_PACKET_SIZE
+   * @note This method may be called from any thread.
    */
   void
   put(lp::Nack nack);
 
+  /**
+   * @brief Publish a batch of Data packets.
+   * @param data the Data packets; copies will be made, so that the caller is not required to
+   *             maintain the arguments unchanged
+   *
+   * This is equivalent to calling put(Data) on each packet in turn, except that the whole batch
+   * is encoded and handed to the transport together.
+   *
+   * @throw OversizedPacketError encoded Data size exceeds MAX_NDN_PACKET_SIZE
+   * @note This method may be called from any thread.
+   */
+  void
+  put(span<const Data> data);
+
 public: // IO routine
   /**
    * @brief Process any data to receive or call timeout callbacks.
@@ -23,10 +23,12 @@
 #define NDN_CXX_IMPL_FACE_IMPL_HPP
 
 #include "ndn-cxx/face.hpp"
+#include "ndn-cxx/detail/probes.hpp"
 #include "ndn-cxx/impl/interest-filter-record.hpp"
 #include "ndn-cxx/impl/lp-field-tag.hpp"
 #include "ndn-cxx/impl/pending-interest.hpp"
 #include "ndn-cxx/impl/registered-prefix.hpp"
+#include "ndn-cxx/impl/submission-queue.hpp"
 #include "ndn-cxx/lp/packet.hpp"
 #include "ndn-cxx/lp/tags.hpp"
 #include "ndn-cxx/mgmt/nfd/command-options.hpp"
@@ -36,6 +38,11 @@
 #include "ndn-cxx/util/logger.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
 #include "ndn-cxx/util/signal.hpp"
+#include "ndn-cxx/util/variant.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
 
 NDN_LOG_INIT(ndn.Face);
 // INFO level: prefix registration, etc.
@@ -58,10 +65,31 @@ namespace ndn {
 class Face::Impl : public std::enable_shared_from_this<Face::Impl>
 {
 public:
+  /** @brief An Interest submitted through Face::expressInterest.
+   */
+  struct InterestSubmission
+  {
+    detail::RecordId id;
+    shared_ptr<const Interest> interest;
+    PendingInterestCallbackStorage callbacks;
+  };
+
+  /** @brief An operation submitted through Face's public API.
+   *
+   *  Packets are carried inline; other operations are carried as a function to be invoked on
+   *  the io_service thread.
+   */
+  using Submission = variant<function<void()>, InterestSubmission, Data, lp::Nack>;
+
+  /// maximum number of submissions processed in one io_service handler
+  static constexpr size_t MAX_SUBMISSION_BATCH = 256;
+
   Impl(Face& face, KeyChain& keyChain)
     : m_face(face)
     , m_scheduler(m_face.getIoService())
     , m_nfdController(m_face, keyChain)
+    , m_metrics(m_face.m_transport.get())
+    , m_pendingInterestTimer(m_scheduler, m_metrics.nTimeouts)
   {
     auto onEmptyPitOrNoRegisteredPrefixes = [this] {
       // Without this extra "post", transport can get paused (-async_read) and then resumed
@@ -78,43 +106,138 @@ public:
       });
     };
 
+    m_pendingInterestTable.onEmpty.connect([this] { m_pendingInterestTimer.cancel(); });
     m_pendingInterestTable.onEmpty.connect(onEmptyPitOrNoRegisteredPrefixes);
     m_registeredPrefixTable.onEmpty.connect(onEmptyPitOrNoRegisteredPrefixes);
   }
 
+public: // submission
+  /** @brief Enqueue an operation to be performed on the io_service thread.
+   *  @note This function may be called from any thread.
+   *
+   *  Submissions are processed in order, in batches of up to MAX_SUBMISSION_BATCH per
+   *  io_service handler, so that a burst of packets costs one handler invocation and
+   *  one transport write rather than one of each per packet.
+   */
+  void
+  submit(Submission&& item)
+  {
+    enqueue(std::move(item));
+    scheduleDrain();
+  }
+
+  /** @brief Enqueue an operation without scheduling its processing.
+   *
+   *  This allows a batch of submissions to be followed by a single scheduleDrain().
+   */
+  void
+  enqueue(Submission&& item)
+  {
+    m_submissionQueue.push(std::move(item));
+  }
+
+  /** @brief Ensure that the submission queue will be drained on the io_service thread.
+   *  @note This function may be called from any thread.
+   */
+  void
+  scheduleDrain()
+  {
+    if (m_isDrainScheduled.exchange(true)) {
+      return;
+    }
+
+    m_face.getIoService().post([w = weak_ptr<Impl>{shared_from_this()}] { // use weak_from_this() in C++17
+      auto impl = w.lock();
+      if (impl != nullptr) {
+        impl->drainSubmissions();
+      }
+    });
+  }
+
+  void
+  drainSubmissions()
+  {
+    // clear the flag before draining, so that any later submission schedules another drain
+    m_isDrainScheduled.store(false);
+
+    BOOST_ASSERT(!m_isBatchingSends);
+    m_isBatchingSends = true;
+    size_t nProcessed = 0;
+    try {
+      nProcessed = m_submissionQueue.drain(MAX_SUBMISSION_BATCH, [this] (Submission& item) {
+        processSubmission(item);
+      });
+    }
+    catch (...) {
+      flushSends();
+      scheduleDrain(); // continue with remaining submissions, if any
+      throw;
+    }
+    flushSends();
+
+    if (nProcessed == MAX_SUBMISSION_BATCH) {
+      scheduleDrain();
+    }
+  }
+
 public: // consumer
   void
   expressInterest(detail::RecordId id, shared_ptr<const Interest> interest,
-                  const DataCallback& afterSatisfied,
-                  const NackCallback& afterNacked,
-                  const TimeoutCallback& afterTimeout)
+                  PendingInterestCallbackStorage callbacks)
   {
     NDN_LOG_DEBUG("<I " << *interest);
     this->ensureConnected(true);
 
     const Interest& interest2 = *interest;
-    auto& entry = m_pendingInterestTable.put(id, std::move(interest), afterSatisfied,
-                                             afterNacked, afterTimeout, m_scheduler);
+    auto& entry = m_pendingInterestTable.put(id, std::move(interest), std::move(callbacks),
+                                             m_pendingInterestTimer);
 
     lp::Packet lpPacket;
     addFieldFromTag<lp::NextHopFaceIdField, lp::NextHopFaceIdTag>(lpPacket, interest2);
     addFieldFromTag<lp::CongestionMarkField, lp::CongestionMarkTag>(lpPacket, interest2);
 
     entry.recordForwarding();
-    m_face.m_transport->send(finishEncoding(std::move(lpPacket), interest2.wireEncode(),
-                                            'I', interest2.getName()));
+    send(finishEncoding(std::move(lpPacket), interest2.wireEncode(), 'I', interest2.getName()));
+    ++m_metrics.nOutInterests;
+    NDN_CXX_PROBE(face_express_interest, std::hash<Name>()(interest2.getName()),
+                  interest2.wireEncode().size(), interest2.getInterestLifetime().count());
     dispatchInterest(entry, interest2);
   }
 
   void
   asyncRemovePendingInterest(detail::RecordId id)
   {
-    m_face.getIoService().post([id, w = weak_ptr<Impl>{shared_from_this()}] { // use weak_from_this() in C++17
-      auto impl = w.lock();
-      if (impl != nullptr) {
-        impl->m_pendingInterestTable.erase(id);
-      }
-    });
+    {
+      std::lock_guard<std::mutex> lock(m_cancelMutex);
+      m_cancelledInterests.insert(id);
+      m_hasCancelledInterests.store(true);
+    }
+
+    // queued behind earlier submissions, so that it cannot overtake the Interest it cancels
+    submit(function<void()>([this, id] {
+      takeCancelledInterest(id);
+      m_pendingInterestTable.erase(id);
+    }));
+  }
+
+  /** @brief Check whether the Interest @p id has been cancelled, and forget the cancellation.
+   *
+   *  This allows an Interest that is cancelled while still in the submission queue to be
+   *  dropped without being sent.
+   */
+  bool
+  takeCancelledInterest(detail::RecordId id)
+  {
+    if (!m_hasCancelledInterests.load(std::memory_order_relaxed)) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_cancelMutex);
+    if (m_cancelledInterests.erase(id) == 0) {
+      return false;
+    }
+    m_hasCancelledInterests.store(!m_cancelledInterests.empty());
+    return true;
   }
 
   void
@@ -130,6 +253,7 @@ public: // consumer
   satisfyPendingInterests(const Data& data)
   {
     bool hasAppMatch = false, hasForwarderMatch = false;
+    optional<time::steady_clock::time_point> now;
     m_pendingInterestTable.removeIf([&] (PendingInterest& entry) {
       if (!entry.getInterest()->matchesData(data)) {
         return false;
@@ -138,6 +262,13 @@ public: // consumer
 
       if (entry.getOrigin() == PendingInterestOrigin::APP) {
         hasAppMatch = true;
+        if (!now) {
+          now = time::steady_clock::now();
+        }
+        auto latency = *now - entry.getCreationTime();
+        m_metrics.interestDataLatency.record(latency);
+        NDN_CXX_PROBE(face_satisfy_interest, std::hash<Name>()(entry.getInterest()->getName()),
+                      time::duration_cast<time::nanoseconds>(latency).count());
         entry.invokeDataCallback(data);
       }
       else {
@@ -195,19 +326,14 @@ public: // producer
   void
   asyncUnsetInterestFilter(detail::RecordId id)
   {
-    m_face.getIoService().post([id, w = weak_ptr<Impl>{shared_from_this()}] { // use weak_from_this() in C++17
-      auto impl = w.lock();
-      if (impl != nullptr) {
-        impl->unsetInterestFilter(id);
-      }
-    });
+    submit(function<void()>([this, id] { unsetInterestFilter(id); }));
   }
 
   void
   processIncomingInterest(shared_ptr<const Interest> interest)
   {
     const Interest& interest2 = *interest;
-    auto& entry = m_pendingInterestTable.insert(std::move(interest), m_scheduler);
+    auto& entry = m_pendingInterestTable.insert(std::move(interest), m_pendingInterestTimer);
     dispatchInterest(entry, interest2);
   }
 
@@ -226,8 +352,9 @@ public: // producer
     addFieldFromTag<lp::CachePolicyField, lp::CachePolicyTag>(lpPacket, data);
     addFieldFromTag<lp::CongestionMarkField, lp::CongestionMarkTag>(lpPacket, data);
 
-    m_face.m_transport->send(finishEncoding(std::move(lpPacket), data.wireEncode(),
-                                            'D', data.getName()));
+    send(finishEncoding(std::move(lpPacket), data.wireEncode(), 'D', data.getName()));
+    ++m_metrics.nOutData;
+    NDN_CXX_PROBE(face_put_data, std::hash<Name>()(data.getName()), data.wireEncode().size());
   }
 
   void
@@ -246,8 +373,8 @@ public: // producer
     addFieldFromTag<lp::CongestionMarkField, lp::CongestionMarkTag>(lpPacket, *outNack);
 
     const Interest& interest = outNack->getInterest();
-    m_face.m_transport->send(finishEncoding(std::move(lpPacket), interest.wireEncode(),
-                                            'N', interest.getName()));
+    send(finishEncoding(std::move(lpPacket), interest.wireEncode(), 'N', interest.getName()));
+    ++m_metrics.nOutNacks;
   }
 
 public: // prefix registration
@@ -292,12 +419,7 @@ public: // prefix registration
                         const UnregisterPrefixSuccessCallback& onSuccess,
                         const UnregisterPrefixFailureCallback& onFailure)
   {
-    m_face.getIoService().post([=, w = weak_ptr<Impl>{shared_from_this()}] { // use weak_from_this() in C++17
-      auto impl = w.lock();
-      if (impl != nullptr) {
-        impl->unregisterPrefix(id, onSuccess, onFailure);
-      }
-    });
+    submit(function<void()>([=] { unregisterPrefix(id, onSuccess, onFailure); }));
   }
 
 public: // IO routine
@@ -323,6 +445,61 @@ public: // IO routine
   }
 
 private:
+  void
+  processSubmission(Submission& item)
+  {
+    if (auto* interest = get_if<InterestSubmission>(&item)) {
+      if (takeCancelledInterest(interest->id)) {
+        NDN_LOG_TRACE("dropping cancelled Interest " << *interest->interest);
+        return;
+      }
+      expressInterest(interest->id, std::move(interest->interest), std::move(interest->callbacks));
+    }
+    else if (auto* data = get_if<Data>(&item)) {
+      putData(*data);
+    }
+    else if (auto* nack = get_if<lp::Nack>(&item)) {
+      putNack(*nack);
+    }
+    else {
+      get<function<void()>>(item)();
+    }
+  }
+
+  /** @brief Send a packet to the forwarder, or defer it until flushSends() while a batch of
+   *         submissions is being processed.
+   */
+  void
+  send(Block&& wire)
+  {
+    m_metrics.nOutBytes.add(wire.size());
+    if (m_isBatchingSends) {
+      m_pendingSends.push_back(std::move(wire));
+    }
+    else {
+      m_face.m_transport->send(wire);
+    }
+  }
+
+  /** @brief Hand all deferred packets to the transport in one operation.
+   */
+  void
+  flushSends()
+  {
+    m_isBatchingSends = false;
+    if (m_pendingSends.empty()) {
+      return;
+    }
+
+    if (m_pendingSends.size() == 1) {
+      m_face.m_transport->send(m_pendingSends.front());
+    }
+    else {
+      m_face.m_transport->sendBatch(m_pendingSends);
+    }
+    m_pendingSends.clear();
+  }
+
   /** @brief Finish packet encoding.
    *  @param lpPacket NDNLP packet without FragmentField
    *  @param wire wire encoding of Interest or Data
@@ -340,6 +517,8 @@ private:
     }
 
     if (wire.size() > MAX_NDN_PACKET_SIZE) {
+      ++m_metrics.nOversizedDrops;
+      NDN_CXX_PROBE(face_drop_oversized, pktType, wire.size());
       NDN_THROW(Face::OversizedPacketError(pktType, name, wire.size()));
     }
 
@@ -411,13 +590,24 @@ private:
   Scheduler m_scheduler;
   scheduler::ScopedEventId m_processEventsTimeoutEvent;
   nfd::Controller m_nfdController;
+  FaceMetrics m_metrics;
 
+  PendingInterestTimer m_pendingInterestTimer; // must be declared before m_pendingInterestTable
   detail::RecordContainer<PendingInterest> m_pendingInterestTable;
   detail::RecordContainer<InterestFilterRecord> m_interestFilterTable;
   detail::RecordContainer<RegisteredPrefix> m_registeredPrefixTable;
 
   unique_ptr<boost::asio::io_service::work> m_ioServiceWork; // if thread needs to be preserved
 
+  detail::SubmissionQueue<Submission> m_submissionQueue;
+  std::atomic<bool> m_isDrainScheduled{false};
+  bool m_isBatchingSends = false;
+  std::vector<Block> m_pendingSends;
+
+  std::mutex m_cancelMutex;
+  std::unordered_set<detail::RecordId> m_cancelledInterests; // guarded by m_cancelMutex
+  std::atomic<bool> m_hasCancelledInterests{false};
+
   friend Face;
 };
 
@@ -23,6 +23,7 @@
 #define NDN_CXX_IMPL_NAME_COMPONENT_TYPES_HPP
 
 #include "ndn-cxx/name-component.hpp"
+#include "ndn-cxx/impl/name-uri.hpp"
 #include "ndn-cxx/util/sha256.hpp"
 #include "ndn-cxx/util/string-helper.hpp"
 
@@ -33,6 +34,38 @@ namespace ndn {
 namespace name {
 namespace {
 
+using detail::UriWriter;
+
+enum class DecimalStatus {
+  OK,
+  INVALID,
+  OUT_OF_RANGE,
+};
+
+/** \brief Parse a NonNegativeInteger written as a decimal number without leading zeros.
+ */
+inline DecimalStatus
+parseDecimal(span<const char> input, uint64_t& n) noexcept
+{
+  if (input.empty() || (input[0] == '0' && input.size() > 1)) {
+    return DecimalStatus::INVALID;
+  }
+
+  n = 0;
+  bool isOverflow = false;
+  for (char c : input) {
+    if (c < '0' || c > '9') {
+      return DecimalStatus::INVALID;
+    }
+    auto digit = static_cast<uint64_t>(c - '0');
+    if (n > (std::numeric_limits<uint64_t>::max() - digit) / 10) {
+      isOverflow = true;
+    }
+    n = n * 10 + digit;
+  }
+  return isOverflow ? DecimalStatus::OUT_OF_RANGE : DecimalStatus::OK;
+}
+
 /** \brief Declare rules for a NameComponent type.
  */
 class ComponentType : noncopyable
@@ -43,10 +76,10 @@ public:
   virtual
   ~ComponentType() = default;
 
-  /** \brief Throw Component::Error if \p comp is invalid.
+  /** \brief Throw Component::Error if \p value is not a valid TLV-VALUE of this component type.
    */
   virtual void
-  check(const Component& comp) const
+  check(span<const uint8_t> value) const
   {
   }
 
@@ -87,25 +120,29 @@ public:
 
   /** \brief Parse component from alternate URI representation.
    *  \param input the `<value>` portion of the alternate URI representation.
+   *  \param output destination of the TLV encoding of the component, which has room for
+   *                `input.size() + detail::MAX_COMPONENT_HEADER_SIZE` octets
+   *  \return number of octets written
    *  \throw Component::Error
    *  \pre getAltUriPrefix() != nullptr
    */
-  virtual Component
-  parseAltUriValue(const std::string&) const
+  virtual size_t
+  parseAltUriValue(span<const char> input, uint8_t* output) const
   {
     NDN_CXX_UNREACHABLE;
   }
 
-  /** \brief Write URI representation of \p comp to \p os.
+  /** \brief Write URI representation of \p comp to \p out.
    *
    *  This base class implementation encodes the component using the plain
    *  `<type-number>=<escaped-value>` syntax (aka canonical format).
    */
   virtual void
-  writeUri(std::ostream& os, const Component& comp) const
+  writeUri(UriWriter& out, const Component& comp) const
   {
-    os << comp.type() << '=';
-    writeUriEscapedValue(os, comp);
+    out.writeDecimal(comp.type());
+    out.put('=');
+    writeUriEscapedValue(out, comp);
   }
 
 protected:
@@ -142,14 +179,14 @@ protected:
    * \brief Write TLV-VALUE as `<escaped-value>` of NDN URI syntax.
    */
   static void
-  writeUriEscapedValue(std::ostream& os, const Component& comp)
+  writeUriEscapedValue(UriWriter& out, const Component& comp)
   {
     bool isAllPeriods = std::all_of(comp.value_begin(), comp.value_end(),
                                     [] (uint8_t x) { return x == '.'; });
     if (isAllPeriods) {
-      os << "...";
+      out.write("...", 3);
     }
-    escape(os, reinterpret_cast<const char*>(comp.value()), comp.value_size());
+    out.writeEscaped(comp.value_bytes());
   }
 };
 
@@ -162,9 +199,9 @@ class GenericNameComponentType final : public ComponentType
 {
 public:
   void
-  writeUri(std::ostream& os, const Component& comp) const final
+  writeUri(UriWriter& out, const Component& comp) const final
   {
-    writeUriEscapedValue(os, comp);
+    writeUriEscapedValue(out, comp);
   }
 };
 
@@ -182,12 +219,9 @@ public:
   }
 
   void
-  check(const Component& comp) const final
+  check(span<const uint8_t> value) const final
   {
-    BOOST_ASSERT(comp.type() == m_type);
-    if (comp.value_size() != util::Sha256::DIGEST_SIZE) {
-      NDN_THROW(Error(m_typeName + " TLV-LENGTH must be " + to_string(util::Sha256::DIGEST_SIZE)));
-    }
+    checkLength(value.size());
   }
 
   std::tuple<bool, Component>
@@ -212,24 +246,45 @@ public:
     return m_uriPrefix.data();
   }
 
-  Component
-  parseAltUriValue(const std::string& input) const final
+  size_t
+  parseAltUriValue(span<const char> input, uint8_t* output) const final
   {
-    shared_ptr<Buffer> value;
+    if (input.size() % 2 == 0) {
+      checkLength(input.size() / 2);
+    }
+
+    size_t headerSize = detail::writeTypeLength(output, m_type, util::Sha256::DIGEST_SIZE);
     try {
-      value = fromHex(input);
+      fromHex(input, {output + headerSize, util::Sha256::DIGEST_SIZE});
     }
     catch (const StringHelperError&) {
       NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid hex encoding)"));
     }
-    return {m_type, std::move(value)};
+    return headerSize + util::Sha256::DIGEST_SIZE;
+  }
+
+  void
+  writeUri(UriWriter& out, const Component& comp) const final
+  {
+    out.write(m_uriPrefix.data(), m_uriPrefix.size());
+    out.put('=');
+
+    std::array<char, 2 * util::Sha256::DIGEST_SIZE> hex;
+    auto value = comp.value_bytes();
+    while (!value.empty()) {
+      auto chunk = value.first(std::min(value.size(), hex.size() / 2));
+      out.write(hex.data(), toHex(chunk, hex, false));
+      value = value.subspan(chunk.size());
+    }
   }
 
+private:
   void
-  writeUri(std::ostream& os, const Component& comp) const final
+  checkLength(size_t length) const
   {
-    os << m_uriPrefix << '=';
-    printHex(os, comp.value_bytes(), false);
+    if (length != util::Sha256::DIGEST_SIZE) {
+      NDN_THROW(Error(m_typeName + " TLV-LENGTH must be " + to_string(util::Sha256::DIGEST_SIZE)));
+    }
   }
 
 private:
@@ -262,33 +317,38 @@ public:
     return m_uriPrefix.data();
   }
 
-  Component
-  parseAltUriValue(const std::string& input) const final
+  size_t
+  parseAltUriValue(span<const char> input, uint8_t* output) const final
   {
     uint64_t n = 0;
-    try {
-      n = std::stoull(input);
+    switch (parseDecimal(input, n)) {
+      case DecimalStatus::OK:
+        break;
+      case DecimalStatus::INVALID:
+        NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid format)"));
+      case DecimalStatus::OUT_OF_RANGE:
+        NDN_THROW(Error("Cannot convert to " + m_typeName + " (out of range)"));
     }
-    catch (const std::invalid_argument&) {
-      NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid format)"));
-    }
-    catch (const std::out_of_range&) {
-      NDN_THROW(Error("Cannot convert to " + m_typeName + " (out of range)"));
-    }
-    if (to_string(n) != input) {
-      NDN_THROW(Error("Cannot convert to " + m_typeName + " (invalid format)"));
+
+    size_t valueSize = tlv::sizeOfNonNegativeInteger(n);
+    size_t headerSize = detail::writeTypeLength(output, m_type, valueSize);
+    for (size_t i = valueSize; i > 0; --i) {
+      output[headerSize + i - 1] = static_cast<uint8_t>(n);
+      n >>= 8;
     }
-    return Component::fromNumber(n, m_type);
+    return headerSize + valueSize;
   }
 
   void
-  writeUri(std::ostream& os, const Component& comp) const final
+  writeUri(UriWriter& out, const Component& comp) const final
   {
     if (comp.isNumber()) {
-      os << m_uriPrefix << '=' << comp.toNumber();
+      out.write(m_uriPrefix.data(), m_uriPrefix.size());
+      out.put('=');
+      out.writeDecimal(comp.toNumber());
     }
     else {
-      ComponentType::writeUri(os, comp);
+      ComponentType::writeUri(out, comp);
     }
   }
 
@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_NAME_URI_HPP
+#define NDN_CXX_IMPL_NAME_URI_HPP
+
+#include "ndn-cxx/name-component.hpp"
+#include "ndn-cxx/util/string-helper.hpp"
+
+#include <boost/endian/conversion.hpp>
+
+#include <cstring>
+
+namespace ndn {
+namespace name {
+namespace detail {
+
+/** \brief Maximum size of TLV-TYPE and TLV-LENGTH of a name component.
+ *
+ *  TLV-TYPE of a name component is at most 65535 (3 octets); TLV-LENGTH is allowed up to 9 octets.
+ */
+const size_t MAX_COMPONENT_HEADER_SIZE = 12;
+
+/** \brief Write TLV-TYPE and TLV-LENGTH to \p output.
+ *  \return number of octets written, at most 18
+ */
+inline size_t
+writeTypeLength(uint8_t* output, uint32_t type, uint64_t length) noexcept
+{
+  auto writeVarNumber = [] (uint8_t* out, uint64_t n) -> size_t {
+    if (n < 253) {
+      out[0] = static_cast<uint8_t>(n);
+      return 1;
+    }
+    else if (n <= std::numeric_limits<uint16_t>::max()) {
+      out[0] = 253;
+      boost::endian::store_big_u16(out + 1, static_cast<uint16_t>(n));
+      return 3;
+    }
+    else if (n <= std::numeric_limits<uint32_t>::max()) {
+      out[0] = 254;
+      boost::endian::store_big_u32(out + 1, static_cast<uint32_t>(n));
+      return 5;
+    }
+    else {
+      out[0] = 255;
+      boost::endian::store_big_u64(out + 1, n);
+      return 9;
+    }
+  };
+
+  size_t len = writeVarNumber(output, type);
+  return len + writeVarNumber(output + len, length);
+}
+
+/** \brief Parse a name component from its URI representation.
+ *  \param input URI component, without the '/' delimiters
+ *  \param output destination of the TLV encoding of the name component, which must have room
+ *                for at least `input.size() + MAX_COMPONENT_HEADER_SIZE` octets
+ *  \return number of octets written
+ *  \throw Component::Error \p input does not represent a valid name component
+ */
+size_t
+parseComponentUri(span<const char> input, uint8_t* output);
+
+/** \brief Destination of a URI representation.
+ *
+ *  The URI can be written to an output stream, appended to a string, or written into a
+ *  fixed-size character buffer. In the last case, characters that do not fit in the buffer
+ *  are discarded, but still counted by size().
+ */
+class UriWriter : noncopyable
+{
+public:
+  explicit
+  UriWriter(std::ostream& os) noexcept
+    : m_os(&os)
+  {
+  }
+
+  explicit
+  UriWriter(std::string& str) noexcept
+    : m_str(&str)
+  {
+  }
+
+  explicit
+  UriWriter(span<char> buffer) noexcept
+    : m_buffer(buffer)
+  {
+  }
+
+  /** \brief Return the number of characters written so far.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_size;
+  }
+
+  void
+  write(const char* str, size_t len)
+  {
+    if (m_os != nullptr) {
+      m_os->write(str, static_cast<std::streamsize>(len));
+    }
+    else if (m_str != nullptr) {
+      m_str->append(str, len);
+    }
+    else if (m_size < m_buffer.size()) {
+      std::memcpy(m_buffer.data() + m_size, str, std::min(len, m_buffer.size() - m_size));
+    }
+    m_size += len;
+  }
+
+  void
+  put(char c)
+  {
+    write(&c, 1);
+  }
+
+  void
+  writeDecimal(uint64_t n)
+  {
+    char digits[20];
+    char* pos = std::end(digits);
+    do {
+      *--pos = static_cast<char>('0' + n % 10);
+      n /= 10;
+    } while (n > 0);
+    write(pos, static_cast<size_t>(std::end(digits) - pos));
+  }
+
+  /** \brief Write \p value, percent-encoding all octets except unreserved characters.
+   */
+  void
+  writeEscaped(span<const uint8_t> value)
+  {
+    auto isUnreserved = [] (uint8_t c) {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+             c == '-' || c == '.' || c == '_' || c == '~';
+    };
+
+    auto it = value.begin();
+    while (it != value.end()) {
+      auto run = std::find_if_not(it, value.end(), isUnreserved);
+      if (run != it) {
+        write(reinterpret_cast<const char*>(&*it), static_cast<size_t>(run - it));
+        it = run;
+      }
+      if (it != value.end()) {
+        char escaped[] = {'%', toHexChar(*it >> 4), toHexChar(*it & 0xf)};
+        write(escaped, sizeof(escaped));
+        ++it;
+      }
+    }
+  }
+
+private:
+  std::ostream* m_os = nullptr;
+  std::string* m_str = nullptr;
+  span<char> m_buffer;
+  size_t m_size = 0;
+};
+
+/** \brief Write the URI representation of \p comp.
+ */
+void
+writeComponentUri(UriWriter& out, const Component& comp, UriFormat format);
+
+} // namespace detail
+} // namespace name
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_NAME_URI_HPP
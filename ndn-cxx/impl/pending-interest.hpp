@@ -24,13 +24,20 @@
 
 #include "ndn-cxx/data.hpp"
 #include "ndn-cxx/face.hpp"
+#include "ndn-cxx/detail/probes.hpp"
+#include "ndn-cxx/face-metrics.hpp"
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/impl/record-container.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/variant.hpp"
+
+#include <boost/intrusive/set.hpp>
 
 namespace ndn {
 
+class PendingInterestTimer;
+
 /**
  * @brief Indicates where a pending Interest came from.
  */
@@ -52,6 +59,25 @@ operator<<(std::ostream& os, PendingInterestOrigin origin)
   NDN_CXX_UNREACHABLE;
 }
 
+/**
+ * @brief Callbacks of an Interest expressed through Face::expressInterest.
+ */
+struct PendingInterestCallbacks
+{
+  DataCallback afterSatisfied;
+  NackCallback afterNacked;
+  TimeoutCallback afterTimeout;
+};
+
+/**
+ * @brief Callbacks as held by a PendingInterest record.
+ *
+ * The callbacks of a single Interest are stored in the record itself. The callbacks of a
+ * Face::expressInterests batch are stored once and shared by all records of the batch.
+ */
+using PendingInterestCallbackStorage = variant<PendingInterestCallbacks,
+                                               shared_ptr<const PendingInterestCallbacks>>;
+
 /**
  * @brief Stores a pending Interest and associated callbacks.
  */
@@ -64,26 +90,24 @@ public:
    * The timeout is set based on the current time and InterestLifetime.
    * This class will invoke the timeout callback unless the record is deleted before timeout.
    */
-  PendingInterest(shared_ptr<const Interest> interest, const DataCallback& dataCallback,
-                  const NackCallback& nackCallback, const TimeoutCallback& timeoutCallback,
-                  Scheduler& scheduler)
+  PendingInterest(shared_ptr<const Interest> interest,
+                  PendingInterestCallbackStorage callbacks,
+                  PendingInterestTimer& timer)
     : m_interest(std::move(interest))
+    , m_callbacks(std::move(callbacks))
     , m_origin(PendingInterestOrigin::APP)
-    , m_dataCallback(dataCallback)
-    , m_nackCallback(nackCallback)
-    , m_timeoutCallback(timeoutCallback)
   {
-    scheduleTimeoutEvent(scheduler);
+    scheduleTimeout(timer);
   }
 
   /**
    * @brief Construct a pending Interest record for an Interest from the forwarder.
    */
-  PendingInterest(shared_ptr<const Interest> interest, Scheduler& scheduler)
+  PendingInterest(shared_ptr<const Interest> interest, PendingInterestTimer& timer)
     : m_interest(std::move(interest))
     , m_origin(PendingInterestOrigin::FORWARDER)
   {
-    scheduleTimeoutEvent(scheduler);
+    scheduleTimeout(timer);
   }
 
   shared_ptr<const Interest>
@@ -98,6 +122,16 @@ public:
     return m_origin;
   }
 
+  /**
+   * @brief Return the time when this record was created.
+   */
+  time::steady_clock::time_point
+  getCreationTime() const
+  {
+    // derived from the expiry time, so that it does not occupy space in every record
+    return m_expiry - m_interest->getInterestLifetime();
+  }
+
   /**
    * @brief Record that the Interest has been forwarded to one destination.
    *
@@ -120,11 +154,17 @@ public:
     --m_nNotNacked;
     BOOST_ASSERT(m_nNotNacked >= 0);
 
-    if (!m_leastSevereNack || lp::isLessSevere(nack.getReason(), m_leastSevereNack->getReason())) {
-      m_leastSevereNack = nack;
+    if (!m_leastSevereNack) {
+      m_leastSevereNack = make_unique<lp::Nack>(nack);
+    }
+    else if (lp::isLessSevere(nack.getReason(), m_leastSevereNack->getReason())) {
+      *m_leastSevereNack = nack;
     }
 
-    return m_nNotNacked > 0 ? nullopt : m_leastSevereNack;
+    if (m_nNotNacked > 0) {
+      return nullopt;
+    }
+    return *m_leastSevereNack;
   }
 
   /**
@@ -134,8 +174,9 @@ public:
   void
   invokeDataCallback(const Data& data)
   {
-    if (m_dataCallback) {
-      m_dataCallback(*m_interest, data);
+    const auto& callbacks = getCallbacks();
+    if (callbacks.afterSatisfied) {
+      callbacks.afterSatisfied(*m_interest, data);
     }
   }
 
@@ -146,27 +187,34 @@ public:
   void
   invokeNackCallback(const lp::Nack& nack)
   {
-    if (m_nackCallback) {
-      m_nackCallback(*m_interest, nack);
+    const auto& callbacks = getCallbacks();
+    if (callbacks.afterNacked) {
+      callbacks.afterNacked(*m_interest, nack);
     }
   }
 
 private:
-  void
-  scheduleTimeoutEvent(Scheduler& scheduler)
+  const PendingInterestCallbacks&
+  getCallbacks() const
   {
-    m_timeoutEvent = scheduler.schedule(m_interest->getInterestLifetime(),
-                                        [=] { this->invokeTimeoutCallback(); });
+    if (auto* shared = get_if<shared_ptr<const PendingInterestCallbacks>>(&m_callbacks)) {
+      return **shared;
+    }
+    return get<PendingInterestCallbacks>(m_callbacks);
   }
 
+  void
+  scheduleTimeout(PendingInterestTimer& timer);
+
   /**
    * @brief Invoke the timeout callback (if non-empty) and the deleter
    */
   void
   invokeTimeoutCallback()
   {
-    if (m_timeoutCallback) {
-      m_timeoutCallback(*m_interest);
+    const auto& callbacks = getCallbacks();
+    if (callbacks.afterTimeout) {
+      callbacks.afterTimeout(*m_interest);
     }
 
     deleteSelf();
@@ -174,15 +222,132 @@ private:
 
 private:
   shared_ptr<const Interest> m_interest;
+  PendingInterestCallbackStorage m_callbacks; ///< empty callbacks if origin is FORWARDER
+  time::steady_clock::time_point m_expiry;
+  /// links this record into PendingInterestTimer; unlinked automatically upon destruction
+  boost::intrusive::set_member_hook<boost::intrusive::link_mode<boost::intrusive::auto_unlink>> m_timerHook;
   PendingInterestOrigin m_origin;
-  DataCallback m_dataCallback;
-  NackCallback m_nackCallback;
-  TimeoutCallback m_timeoutCallback;
-  scheduler::ScopedEventId m_timeoutEvent;
   int m_nNotNacked = 0; ///< number of Interest destinations that have not Nacked
-  optional<lp::Nack> m_leastSevereNack;
+  unique_ptr<lp::Nack> m_leastSevereNack; ///< allocated upon first Nack, which is uncommon
+
+  friend PendingInterestTimer;
+};
+
+/**
+ * @brief Invokes timeout callbacks of PendingInterest records.
+ *
+ * Instead of scheduling one Scheduler event per record, records are linked into an intrusive
+ * queue ordered by expiry time, and a single Scheduler event is kept for the earliest expiry.
+ * A record leaves the queue automatically when it is destructed, so that erasing a record
+ * costs no Scheduler operation.
+ */
+class PendingInterestTimer : noncopyable
+{
+public:
+  /**
+   * @param scheduler Scheduler for the expiry event
+   * @param nTimeouts counter of timed out Interests expressed by the application
+   */
+  PendingInterestTimer(Scheduler& scheduler, MetricsCounter& nTimeouts)
+    : m_scheduler(scheduler)
+    , m_nTimeouts(nTimeouts)
+  {
+  }
+
+  /**
+   * @brief Cancel the Scheduler event.
+   * @pre All records have been removed.
+   *
+   * Without this, a Scheduler event for an already removed record would keep the io_service busy
+   * until its original expiry time.
+   */
+  void
+  cancel()
+  {
+    BOOST_ASSERT(m_queue.empty());
+    m_nextEvent.cancel();
+  }
+
+  /**
+   * @brief Add a record whose expiry time has been set.
+   */
+  void
+  add(PendingInterest& entry)
+  {
+    m_queue.insert(entry);
+    if (!m_nextEvent || entry.m_expiry < m_nextEventTime) {
+      scheduleNext();
+    }
+  }
+
+private:
+  void
+  scheduleNext()
+  {
+    if (m_queue.empty()) {
+      m_nextEvent.cancel();
+      return;
+    }
+
+    m_nextEventTime = m_queue.begin()->m_expiry;
+    auto delay = std::max<time::nanoseconds>(m_nextEventTime - time::steady_clock::now(), 0_ns);
+    m_nextEvent = m_scheduler.schedule(delay, [this] { processExpired(); });
+  }
+
+  void
+  processExpired()
+  {
+    m_nextEvent.release(); // the event has fired
+    auto now = time::steady_clock::now();
+    try {
+      while (!m_queue.empty() && m_queue.begin()->m_expiry <= now) {
+        PendingInterest& entry = *m_queue.begin();
+        m_queue.erase(m_queue.begin());
+        if (entry.getOrigin() == PendingInterestOrigin::APP) {
+          ++m_nTimeouts;
+          NDN_CXX_PROBE(face_interest_timeout, std::hash<Name>()(entry.getInterest()->getName()),
+                        entry.getInterest()->getInterestLifetime().count());
+        }
+        entry.invokeTimeoutCallback();
+      }
+    }
+    catch (...) {
+      scheduleNext();
+      throw;
+    }
+    scheduleNext();
+  }
+
+private:
+  struct ExpiryCompare
+  {
+    bool
+    operator()(const PendingInterest& a, const PendingInterest& b) const noexcept
+    {
+      return a.m_expiry < b.m_expiry;
+    }
+  };
+
+  using Queue = boost::intrusive::multiset<PendingInterest,
+    boost::intrusive::member_hook<PendingInterest, decltype(PendingInterest::m_timerHook),
+                                  &PendingInterest::m_timerHook>,
+    boost::intrusive::compare<ExpiryCompare>,
+    boost::intrusive::constant_time_size<false>>;
+
+  Scheduler& m_scheduler;
+  MetricsCounter& m_nTimeouts;
+  Queue m_queue;
+  scheduler::ScopedEventId m_nextEvent;
+  time::steady_clock::time_point m_nextEventTime;
 };
 
+inline void
+PendingInterest::scheduleTimeout(PendingInterestTimer& timer)
+{
+  m_expiry = time::steady_clock::now() + m_interest->getInterestLifetime();
+  timer.add(*this);
+}
+
 } // namespace ndn
 
 #endif // NDN_CXX_IMPL_PENDING_INTEREST_HPP
@@ -23,9 +23,11 @@
 #define NDN_CXX_IMPL_RECORD_CONTAINER_HPP
 
 #include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/impl/slab-allocator.hpp"
 #include "ndn-cxx/util/signal.hpp"
 
 #include <atomic>
+#include <map>
 
 namespace ndn {
 namespace detail {
@@ -75,7 +77,13 @@ class RecordContainer
 {
 public:
   using Record = T;
-  using Container = std::map<RecordId, Record>;
+  using Allocator = SlabAllocator<std::pair<const RecordId, Record>>;
+  using Container = std::map<RecordId, Record, std::less<RecordId>, Allocator>;
+
+  RecordContainer()
+    : m_container(Allocator(m_arena))
+  {
+  }
 
   /** \brief Retrieve record by ID.
    */
@@ -191,6 +199,7 @@ public:
   util::Signal<RecordContainer<T>> onEmpty;
 
 private:
+  SlabArena m_arena; // must be declared before m_container
   Container m_container;
   std::atomic<RecordId> m_lastId{0};
 };
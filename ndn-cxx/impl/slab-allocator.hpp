@@ -0,0 +1,207 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_SLAB_ALLOCATOR_HPP
+#define NDN_CXX_IMPL_SLAB_ALLOCATOR_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <vector>
+
+namespace ndn {
+namespace detail {
+
+/** \brief Pool of fixed-size memory blocks, carved from large slabs.
+ *
+ *  Freed blocks are kept in a per-size free list and reused by later allocations of the same
+ *  size; slabs are released only when the arena is destructed. This is suitable for node-based
+ *  containers whose nodes are allocated and freed at a high rate.
+ *
+ *  The memory held by the arena therefore follows the high-water mark of its container, not its
+ *  current size: e.g., a Face that once had 10000 pending Interests keeps the blocks for 10000
+ *  records until it is destructed. Returning empty slabs would require tracking the live blocks
+ *  of every slab on each allocation and deallocation, which this class avoids.
+ *  \warning This class is not thread-safe.
+ */
+class SlabArena : noncopyable
+{
+public:
+  /** \param nBlocksPerSlab number of blocks carved from each slab
+   */
+  explicit
+  SlabArena(size_t nBlocksPerSlab = 64)
+    : m_nBlocksPerSlab(nBlocksPerSlab)
+  {
+    BOOST_ASSERT(nBlocksPerSlab > 0);
+  }
+
+  void*
+  allocate(size_t size)
+  {
+    Pool& pool = getPool(size);
+    if (pool.freeList == nullptr) {
+      grow(pool);
+    }
+    FreeBlock* block = pool.freeList;
+    pool.freeList = block->next;
+    return block;
+  }
+
+  void
+  deallocate(void* p, size_t size)
+  {
+    Pool& pool = getPool(size);
+    auto block = static_cast<FreeBlock*>(p);
+    block->next = pool.freeList;
+    pool.freeList = block;
+  }
+
+  /** \brief Return the number of slabs allocated so far, which are all held until destruction.
+   */
+  size_t
+  getNSlabs() const noexcept
+  {
+    return m_slabs.size();
+  }
+
+private:
+  struct FreeBlock
+  {
+    FreeBlock* next;
+  };
+
+  struct Pool
+  {
+    size_t blockSize;
+    FreeBlock* freeList;
+  };
+
+  static size_t
+  roundUp(size_t size) noexcept
+  {
+    constexpr size_t align = alignof(std::max_align_t);
+    size = std::max(size, sizeof(FreeBlock));
+    return (size + align - 1) / align * align;
+  }
+
+  Pool&
+  getPool(size_t size)
+  {
+    size = roundUp(size);
+    // a container allocates only a few distinct node sizes, so linear search is the fastest
+    for (auto& pool : m_pools) {
+      if (pool.blockSize == size) {
+        return pool;
+      }
+    }
+    m_pools.push_back({size, nullptr});
+    return m_pools.back();
+  }
+
+  void
+  grow(Pool& pool)
+  {
+    m_slabs.push_back(make_unique<char[]>(pool.blockSize * m_nBlocksPerSlab));
+    char* slab = m_slabs.back().get();
+    for (size_t i = m_nBlocksPerSlab; i > 0; --i) {
+      auto block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * pool.blockSize);
+      block->next = pool.freeList;
+      pool.freeList = block;
+    }
+  }
+
+private:
+  const size_t m_nBlocksPerSlab;
+  std::vector<Pool> m_pools;
+  std::vector<unique_ptr<char[]>> m_slabs;
+};
+
+/** \brief Standard-conforming allocator backed by a SlabArena.
+ *
+ *  Single-object allocations are served from the arena; array allocations (which node-based
+ *  containers do not perform) fall back to the global operator new.
+ */
+template<typename T>
+class SlabAllocator
+{
+public:
+  using value_type = T;
+
+  explicit
+  SlabAllocator(SlabArena& arena) noexcept
+    : m_arena(&arena)
+  {
+  }
+
+  template<typename U>
+  SlabAllocator(const SlabAllocator<U>& other) noexcept
+    : m_arena(&other.getArena())
+  {
+  }
+
+  SlabArena&
+  getArena() const noexcept
+  {
+    return *m_arena;
+  }
+
+  T*
+  allocate(size_t n)
+  {
+    if (n == 1) {
+      return static_cast<T*>(m_arena->allocate(sizeof(T)));
+    }
+    return static_cast<T*>(::operator new(n * sizeof(T)));
+  }
+
+  void
+  deallocate(T* p, size_t n) noexcept
+  {
+    if (n == 1) {
+      m_arena->deallocate(p, sizeof(T));
+    }
+    else {
+      ::operator delete(p);
+    }
+  }
+
+private:
+  SlabArena* m_arena;
+};
+
+template<typename T, typename U>
+bool
+operator==(const SlabAllocator<T>& lhs, const SlabAllocator<U>& rhs) noexcept
+{
+  return &lhs.getArena() == &rhs.getArena();
+}
+
+template<typename T, typename U>
+bool
+operator!=(const SlabAllocator<T>& lhs, const SlabAllocator<U>& rhs) noexcept
+{
+  return !(lhs == rhs);
+}
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_SLAB_ALLOCATOR_HPP
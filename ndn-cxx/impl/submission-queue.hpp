@@ -0,0 +1,214 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_IMPL_SUBMISSION_QUEUE_HPP
+#define NDN_CXX_IMPL_SUBMISSION_QUEUE_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+namespace ndn {
+namespace detail {
+
+/** \brief Multi-producer single-consumer FIFO queue with a lock-free fast path.
+ *
+ *  Items are normally stored in a bounded lock-free ring (D. Vyukov's bounded queue, restricted
+ *  to a single consumer), so that producers neither allocate nor take a lock. If the ring is
+ *  full, items spill into a mutex-protected overflow list. Once spilling has started, subsequent
+ *  items are also appended to the overflow list until the consumer catches up, so that the items
+ *  submitted by any one thread are always consumed in submission order.
+ *
+ *  \tparam T item type, must be default constructible and move assignable
+ */
+template<typename T>
+class SubmissionQueue : noncopyable
+{
+public:
+  /** \param capacity capacity of the lock-free ring, must be a power of two
+   */
+  explicit
+  SubmissionQueue(size_t capacity = 256)
+    : m_cells(new Cell[capacity])
+    , m_mask(capacity - 1)
+  {
+    BOOST_ASSERT(capacity >= 2 && (capacity & m_mask) == 0);
+    for (size_t i = 0; i < capacity; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /** \brief Append an item to the queue.
+   *  \note This function may be called from any thread.
+   */
+  void
+  push(T&& item)
+  {
+    if (!m_isSpilling.load(std::memory_order_acquire) && tryPushRing(item)) {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    if (!m_isSpilling.load(std::memory_order_relaxed) && tryPushRing(item)) {
+      return;
+    }
+    m_isSpilling.store(true, std::memory_order_release);
+    m_overflow.push_back(std::move(item));
+  }
+
+  /** \brief Remove up to \p maxItems items from the front of the queue and pass each to \p f.
+   *  \tparam F function of type `void f(T& item)`
+   *  \return number of items consumed
+   *  \note This function must be called from the consumer thread only.
+   *        \p f may push new items; they may be consumed by the same invocation.
+   *  \note If the item at the front of the ring has been claimed by a producer that has not yet
+   *        finished writing it, draining stops there, even if other items are available. The
+   *        producer should therefore arrange for another drain after its push() returns.
+   */
+  template<typename F>
+  size_t
+  drain(size_t maxItems, F&& f)
+  {
+    size_t nConsumed = 0;
+    T item;
+    while (nConsumed < maxItems) {
+      if (!m_takenOverflow.empty()) {
+        item = std::move(m_takenOverflow.front());
+        m_takenOverflow.pop_front();
+      }
+      else {
+        PopResult result = tryPopRing(item);
+        if (result == PopResult::BUSY ||
+            (result == PopResult::EMPTY && !takeOverflow(item))) {
+          break;
+        }
+      }
+      ++nConsumed;
+      f(item);
+    }
+    return nConsumed;
+  }
+
+private:
+  enum class PopResult {
+    OK,
+    EMPTY, ///< no producer has claimed the cell at the front of the ring
+    BUSY,  ///< a producer has claimed the cell at the front of the ring but not yet written it
+  };
+
+  bool
+  tryPushRing(T& item)
+  {
+    size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+    while (true) {
+      Cell& cell = m_cells[pos & m_mask];
+      size_t seq = cell.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+      if (diff == 0) {
+        if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          cell.item = std::move(item);
+          cell.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      }
+      else if (diff < 0) {
+        return false; // full
+      }
+      else {
+        pos = m_enqueuePos.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /** \brief Take the overflow list after the ring has been found empty.
+   *  \return whether an item was found, either in the ring or in the overflow list
+   */
+  bool
+  takeOverflow(T& item)
+  {
+    if (!m_isSpilling.load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    // An item may have entered the ring before the lock was taken, which must be consumed first.
+    // If its cell is still being written, the overflow list must not be taken either, because
+    // it can hold later items of a producer whose earlier items are behind that cell.
+    switch (tryPopRing(item)) {
+      case PopResult::OK:
+        return true;
+      case PopResult::BUSY:
+        return false;
+      case PopResult::EMPTY:
+        break;
+    }
+    m_takenOverflow.swap(m_overflow);
+    m_isSpilling.store(false, std::memory_order_release);
+
+    if (m_takenOverflow.empty()) {
+      return false;
+    }
+    item = std::move(m_takenOverflow.front());
+    m_takenOverflow.pop_front();
+    return true;
+  }
+
+  PopResult
+  tryPopRing(T& item)
+  {
+    Cell& cell = m_cells[m_dequeuePos & m_mask];
+    size_t seq = cell.sequence.load(std::memory_order_acquire);
+    if (seq != m_dequeuePos + 1) {
+      // a cell is claimed by advancing m_enqueuePos before it is written
+      return m_enqueuePos.load(std::memory_order_acquire) == m_dequeuePos ? PopResult::EMPTY
+                                                                          : PopResult::BUSY;
+    }
+    item = std::move(cell.item);
+    cell.item = T();
+    cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+    ++m_dequeuePos;
+    return PopResult::OK;
+  }
+
+private:
+  struct Cell
+  {
+    std::atomic<size_t> sequence;
+    T item;
+  };
+
+  unique_ptr<Cell[]> m_cells;
+  const size_t m_mask;
+  std::atomic<size_t> m_enqueuePos{0};
+  size_t m_dequeuePos = 0; ///< accessed by consumer only
+
+  std::atomic<bool> m_isSpilling{false};
+  std::mutex m_overflowMutex;
+  std::deque<T> m_overflow; ///< guarded by m_overflowMutex
+  std::deque<T> m_takenOverflow; ///< accessed by consumer only
+};
+
+} // namespace detail
+} // namespace ndn
+
+#endif // NDN_CXX_IMPL_SUBMISSION_QUEUE_HPP
@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/ims/in-memory-storage.hpp"
 #include "ndn-cxx/ims/in-memory-storage-entry.hpp"
+#include "ndn-cxx/detail/probes.hpp"
 
 namespace ndn {
 
@@ -189,6 +190,7 @@ InMemoryStorage::insert(const Data& data, const time::milliseconds& mustBeFreshP
     entry->scheduleMarkStale(*m_scheduler, mustBeFreshProcessingWindow);
   }
   m_cache.insert(entry);
+  NDN_CXX_PROBE(ims_insert, std::hash<Name>()(data.getName()), data.wireEncode().size(), m_nPackets);
 
   //let derived class do something with the entry
   afterInsert(entry);
@@ -199,17 +201,14 @@ InMemoryStorage::find(const Name& name)
 {
   auto it = m_cache.get<byFullName>().lower_bound(name);
 
-  // if not found, return null
-  if (it == m_cache.get<byFullName>().end()) {
-    return nullptr;
-  }
-
-  // if the given name is not the prefix of the lower_bound, return null
-  if (!name.isPrefixOf((*it)->getFullName())) {
+  // if not found, or the given name is not the prefix of the lower_bound, return null
+  if (it == m_cache.get<byFullName>().end() || !name.isPrefixOf((*it)->getFullName())) {
+    NDN_CXX_PROBE(ims_find, std::hash<Name>()(name), 0);
     return nullptr;
   }
 
   afterAccess(*it);
+  NDN_CXX_PROBE(ims_find, std::hash<Name>()(name), 1);
   return ((*it)->getData()).shared_from_this();
 }
 
@@ -221,6 +220,7 @@ InMemoryStorage::find(const Interest& interest)
 
   // if a packet is located by its full name, it must be the packet to return.
   if (it != m_cache.get<byFullName>().end()) {
+    NDN_CXX_PROBE(ims_find, std::hash<Name>()(interest.getName()), 1);
     return ((*it)->getData()).shared_from_this();
   }
 
@@ -229,6 +229,7 @@ InMemoryStorage::find(const Interest& interest)
   it = m_cache.get<byFullName>().lower_bound(interest.getName());
 
   if (it == m_cache.get<byFullName>().end()) {
+    NDN_CXX_PROBE(ims_find, std::hash<Name>()(interest.getName()), 0);
     return nullptr;
   }
 
@@ -239,11 +240,13 @@ InMemoryStorage::find(const Interest& interest)
 
   InMemoryStorageEntry* ret = selectChild(interest, it);
   if (ret == nullptr) {
+    NDN_CXX_PROBE(ims_find, std::hash<Name>()(interest.getName()), 0);
     return nullptr;
   }
 
   // let derived class do something with the entry
   afterAccess(ret);
+  NDN_CXX_PROBE(ims_find, std::hash<Name>()(interest.getName()), 1);
   return ret->getData().shared_from_this();
 }
 
@@ -310,6 +313,9 @@ InMemoryStorage::selectChild(const Interest& interest,
 InMemoryStorage::Cache::iterator
 InMemoryStorage::freeEntry(Cache::iterator it)
 {
+  // every removal from the cache goes through here, so that ims_evict covers all of them
+  NDN_CXX_PROBE(ims_evict, std::hash<Name>()((*it)->getName()), m_nPackets - 1);
+
   // push the *empty* entry into mem pool
   (*it)->release();
   m_freeEntries.push(*it);
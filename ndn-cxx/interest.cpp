@@ -21,6 +21,7 @@
 
 #include "ndn-cxx/interest.hpp"
 #include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/step-source.hpp"
@@ -153,6 +154,12 @@ Interest::wireDecode(const Block& wire)
     NDN_THROW(Error("Interest", wire.type()));
   }
   m_wire = wire;
+  if (!m_wire.hasValue()) {
+    // the Block may have been built from sub-elements that are not encoded yet
+    m_wire.encode();
+  }
+  // the wire is kept parsed for users of wireEncode().elements(), but decoding reads the fields
+  // through views, and creates Blocks only for those that are stored as Blocks
   m_wire.parse();
 
   // Interest = INTEREST-TYPE TLV-LENGTH
@@ -165,13 +172,15 @@ Interest::wireDecode(const Block& wire)
   //              [HopLimit]
   //              [ApplicationParameters [InterestSignature]]
 
-  auto element = m_wire.elements_begin();
-  if (element == m_wire.elements_end() || element->type() != tlv::Name) {
+  BlockView view(m_wire);
+  auto element = view.elements_begin();
+  const auto end = view.elements_end();
+  if (element == end || element->type() != tlv::Name) {
     NDN_THROW(Error("Name element is missing or out of order"));
   }
   // decode into a temporary object until we determine that the name is valid, in order
   // to maintain class invariants and thus provide a basic form of exception safety
-  Name tempName(*element);
+  Name tempName(Block(m_wire, *element));
   if (tempName.empty()) {
     NDN_THROW(Error("Name has zero name components"));
   }
@@ -189,7 +198,7 @@ Interest::wireDecode(const Block& wire)
   m_parameters.clear();
 
   int lastElement = 1; // last recognized element index, in spec order
-  for (++element; element != m_wire.elements_end(); ++element) {
+  for (++element; element != end; ++element) {
     switch (element->type()) {
       case tlv::CanBePrefix: {
         if (lastElement >= 2) {
@@ -222,12 +231,11 @@ Interest::wireDecode(const Block& wire)
         // Previous format, partially supported for backward compatibility:
         //   ForwardingHint = FORWARDING-HINT-TYPE TLV-LENGTH 1*Delegation
         //   Delegation = DELEGATION-TYPE TLV-LENGTH Preference Name
-        element->parse();
-        for (const auto& del : element->elements()) {
+        for (const BlockView& del : element->elements()) {
           switch (del.type()) {
             case tlv::Name:
               try {
-                m_forwardingHint.emplace_back(del);
+                m_forwardingHint.emplace_back(Block(m_wire, del));
               }
               catch (const tlv::Error&) {
                 NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint"));
@@ -236,8 +244,7 @@ Interest::wireDecode(const Block& wire)
             case 31: // Delegation
               // old ForwardingHint format, try to parse the nested Name for compatibility
               try {
-                del.parse();
-                m_forwardingHint.emplace_back(del.get(tlv::Name));
+                m_forwardingHint.emplace_back(Block(m_wire, del.get(tlv::Name)));
               }
               catch (const tlv::Error&) {
                 NDN_THROW_NESTED(Error("Invalid Name in ForwardingHint.Delegation"));
@@ -289,7 +296,7 @@ Interest::wireDecode(const Block& wire)
           break; // ApplicationParameters is non-critical, ignore out-of-order appearance
         }
         BOOST_ASSERT(!hasApplicationParameters());
-        m_parameters.push_back(*element);
+        m_parameters.push_back(Block(m_wire, *element));
         lastElement = 8;
         break;
       }
@@ -300,7 +307,7 @@ Interest::wireDecode(const Block& wire)
         }
         // if we already encountered ApplicationParameters, store this element as parameter
         if (hasApplicationParameters()) {
-          m_parameters.push_back(*element);
+          m_parameters.push_back(Block(m_wire, *element));
         }
         // otherwise, ignore it
         break;
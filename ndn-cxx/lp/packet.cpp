@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/lp/packet.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/lp/fields.hpp"
 
 #include <boost/bind/bind.hpp>
@@ -119,10 +120,10 @@ Block
 Packet::wireEncode() const
 {
   // If no header or trailer, return bare network packet
-  Block::element_container elements = m_wire.elements();
+  const auto& elements = m_wire.elements();
   if (elements.size() == 1 && elements.front().type() == FragmentField::TlvType::value) {
-    elements.front().parse();
-    return elements.front().elements().front();
+    const Block& fragment = elements.front();
+    return Block(fragment, *BlockView(fragment).elements_begin());
   }
 
   m_wire.encode();
@@ -181,7 +181,10 @@ void
 MetaInfo::wireDecode(const Block& wire)
 {
   m_wire = wire;
-  m_wire.parse();
+  if (m_wire.isValid() && !m_wire.hasValue()) {
+    // the Block may have been built from sub-elements that are not encoded yet
+    m_wire.encode();
+  }
 
   // MetaInfo = META-INFO-TYPE TLV-LENGTH
   //              [ContentType]
@@ -189,10 +192,13 @@ MetaInfo::wireDecode(const Block& wire)
   //              [FinalBlockId]
   //              *AppMetaInfo
 
-  auto val = m_wire.elements_begin();
+  // the sub-elements are read through a view; only those that are kept are turned into Blocks
+  BlockView view(m_wire);
+  auto val = view.elements_begin();
+  const auto end = view.elements_end();
 
   // ContentType
-  if (val != m_wire.elements_end() && val->type() == tlv::ContentType) {
+  if (val != end && val->type() == tlv::ContentType) {
     m_type = readNonNegativeIntegerAs<uint32_t>(*val);
     ++val;
   }
@@ -201,7 +207,7 @@ MetaInfo::wireDecode(const Block& wire)
   }
 
   // FreshnessPeriod
-  if (val != m_wire.elements_end() && val->type() == tlv::FreshnessPeriod) {
+  if (val != end && val->type() == tlv::FreshnessPeriod) {
     m_freshnessPeriod = time::milliseconds(readNonNegativeInteger(*val));
     ++val;
   }
@@ -210,8 +216,8 @@ MetaInfo::wireDecode(const Block& wire)
   }
 
   // FinalBlockId
-  if (val != m_wire.elements_end() && val->type() == tlv::FinalBlockId) {
-    m_finalBlockId.emplace(val->blockFromValue());
+  if (val != end && val->type() == tlv::FinalBlockId) {
+    m_finalBlockId.emplace(Block(m_wire, *val).blockFromValue());
     ++val;
   }
   else {
@@ -219,8 +225,8 @@ MetaInfo::wireDecode(const Block& wire)
   }
 
   // AppMetaInfo (if any)
-  for (; val != m_wire.elements().end(); ++val) {
-    m_appMetaInfo.push_back(*val);
+  for (; val != end; ++val) {
+    m_appMetaInfo.push_back(Block(m_wire, *val));
   }
 }
 
@@ -144,7 +144,7 @@ Dispatcher::sendData(const Name& dataName, const Block& content, const MetaInfo&
   if (option == SendDestination::IMS || option == SendDestination::FACE_AND_IMS) {
     lp::CachePolicy policy;
     policy.setPolicy(lp::CachePolicyType::NO_CACHE);
-    data->setTag(make_shared<lp::CachePolicyTag>(policy));
+    data->setTagValue<lp::CachePolicyTag>(policy);
     m_storage.insert(*data, 1_s);
   }
 
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/channel-status.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
 #include "ndn-cxx/util/concepts.hpp"
@@ -36,15 +37,21 @@ ChannelStatus::ChannelStatus(const Block& payload)
   this->wireDecode(payload);
 }
 
+struct ChannelStatus::Schema
+{
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::nfd::ChannelStatus, "ChannelStatus",
+      detail::tlvField(tlv::nfd::LocalUri, "LocalUri", &ChannelStatus::m_localUri));
+  }
+};
+
 template<encoding::Tag TAG>
 size_t
 ChannelStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-  totalLength += prependStringBlock(encoder, tlv::nfd::LocalUri, m_localUri);
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::ChannelStatus);
-  return totalLength;
+  return detail::TlvCodec<Schema, ChannelStatus>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(ChannelStatus);
@@ -55,34 +62,15 @@ ChannelStatus::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, ChannelStatus>::encode(*this);
   return m_wire;
 }
 
 void
 ChannelStatus::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::ChannelStatus) {
-    NDN_THROW(Error("ChannelStatus", block.type()));
-  }
-
+  detail::TlvCodec<Schema, ChannelStatus>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LocalUri) {
-    m_localUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("Missing required LocalUri field"));
-  }
 }
 
 ChannelStatus&
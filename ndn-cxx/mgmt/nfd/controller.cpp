@@ -165,6 +165,57 @@ Controller::fetchDataset(const Name& prefix,
   fetcher->onError.connect([this, it] (auto&&...) { m_fetchers.erase(it); });
 }
 
+void
+Controller::fetchDatasetEntries(const Name& prefix,
+                                shared_ptr<StatusDatasetParser> parser,
+                                const std::function<void()>& onSuccess,
+                                const DatasetFailCallback& onFailure,
+                                const CommandOptions& options)
+{
+  SegmentFetcher::Options fetcherOptions;
+  fetcherOptions.maxTimeout = options.getTimeout();
+  fetcherOptions.inOrder = true;
+
+  auto fetcher = SegmentFetcher::start(m_face, Interest(prefix), m_validator, fetcherOptions);
+  auto it = m_fetchers.insert(fetcher).first;
+
+  fetcher->onInOrderData.connect([=] (ConstBufferPtr segment) {
+    try {
+      if (parser->parse(std::move(segment))) {
+        return;
+      }
+    }
+    catch (const tlv::Error& e) {
+      (*it)->stop();
+      m_fetchers.erase(it);
+      if (onFailure)
+        onFailure(ERROR_SERVER, e.what());
+      return;
+    }
+    // stopped by the entry callback
+    (*it)->stop();
+    m_fetchers.erase(it);
+  });
+  fetcher->onInOrderComplete.connect([=] {
+    m_fetchers.erase(it);
+    try {
+      parser->finish();
+    }
+    catch (const tlv::Error& e) {
+      if (onFailure)
+        onFailure(ERROR_SERVER, e.what());
+      return;
+    }
+    if (onSuccess)
+      onSuccess();
+  });
+  fetcher->onError.connect([=] (uint32_t code, const std::string& msg) {
+    m_fetchers.erase(it);
+    if (onFailure)
+      processDatasetFetchError(onFailure, code, msg);
+  });
+}
+
 void
 Controller::processDatasetFetchError(const DatasetFailCallback& onFailure,
                                      uint32_t code, std::string msg)
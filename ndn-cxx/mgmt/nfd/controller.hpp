@@ -109,6 +109,36 @@ public:
     fetchDataset(make_shared<Dataset>(param), onSuccess, onFailure, options);
   }
 
+  /** \brief Start dataset fetching, delivering the entries one by one as they arrive.
+   *
+   *  Each entry is decoded as soon as the segment that completes it has been received, and is
+   *  passed to \p onEntry. If \p onEntry returns false, the fetching stops, and neither
+   *  \p onSuccess nor \p onFailure is invoked. Otherwise, \p onSuccess is invoked after the
+   *  last entry.
+   */
+  template<typename Dataset>
+  std::enable_if_t<std::is_default_constructible<Dataset>::value>
+  fetch(const std::function<bool(const typename Dataset::EntryType&)>& onEntry,
+        const std::function<void()>& onSuccess,
+        const DatasetFailCallback& onFailure,
+        const CommandOptions& options = CommandOptions())
+  {
+    fetchDatasetEntries(Dataset(), onEntry, onSuccess, onFailure, options);
+  }
+
+  /** \brief Start dataset fetching, delivering the entries one by one as they arrive.
+   */
+  template<typename Dataset, typename ParamType = typename Dataset::ParamType>
+  void
+  fetch(const ParamType& param,
+        const std::function<bool(const typename Dataset::EntryType&)>& onEntry,
+        const std::function<void()>& onSuccess,
+        const DatasetFailCallback& onFailure,
+        const CommandOptions& options = CommandOptions())
+  {
+    fetchDatasetEntries(Dataset(param), onEntry, onSuccess, onFailure, options);
+  }
+
 private:
   void
   startCommand(const shared_ptr<ControlCommand>& command,
@@ -142,6 +172,21 @@ private:
                const DatasetFailCallback& onFailure,
                const CommandOptions& options);
 
+  template<typename Dataset>
+  void
+  fetchDatasetEntries(const Dataset& dataset,
+                      const std::function<bool(const typename Dataset::EntryType&)>& onEntry,
+                      const std::function<void()>& onSuccess,
+                      const DatasetFailCallback& onFailure,
+                      const CommandOptions& options);
+
+  void
+  fetchDatasetEntries(const Name& prefix,
+                      shared_ptr<StatusDatasetParser> parser,
+                      const std::function<void()>& onSuccess,
+                      const DatasetFailCallback& onFailure,
+                      const CommandOptions& options);
+
   template<typename Dataset>
   void
   processDatasetResponse(shared_ptr<Dataset> dataset,
@@ -193,6 +238,22 @@ Controller::fetchDataset(shared_ptr<Dataset> dataset,
     onFailure, options);
 }
 
+template<typename Dataset>
+void
+Controller::fetchDatasetEntries(const Dataset& dataset,
+                                const std::function<bool(const typename Dataset::EntryType&)>& onEntry,
+                                const std::function<void()>& onSuccess,
+                                const DatasetFailCallback& onFailure,
+                                const CommandOptions& options)
+{
+  BOOST_ASSERT(onEntry);
+  auto parser = make_shared<StatusDatasetParser>([onEntry] (const Block& entry) {
+    return onEntry(typename Dataset::EntryType(entry));
+  });
+  fetchDatasetEntries(dataset.getDatasetPrefix(options.getPrefix()), std::move(parser),
+                      onSuccess, onFailure, options);
+}
+
 template<typename Dataset>
 void
 Controller::processDatasetResponse(shared_ptr<Dataset> dataset,
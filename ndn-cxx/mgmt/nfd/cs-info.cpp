@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/cs-info.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
@@ -43,21 +44,25 @@ CsInfo::CsInfo(const Block& block)
   this->wireDecode(block);
 }
 
+struct CsInfo::Schema
+{
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::nfd::CsInfo, "CsInfo",
+      detail::tlvField(tlv::nfd::Capacity, "Capacity", &CsInfo::m_capacity),
+      detail::tlvField(tlv::nfd::Flags, "Flags", &CsInfo::m_flags),
+      detail::tlvField(tlv::nfd::NCsEntries, "NCsEntries", &CsInfo::m_nEntries),
+      detail::tlvField(tlv::nfd::NHits, "NHits", &CsInfo::m_nHits),
+      detail::tlvField(tlv::nfd::NMisses, "NMisses", &CsInfo::m_nMisses));
+  }
+};
+
 template<encoding::Tag TAG>
 size_t
 CsInfo::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NMisses, m_nMisses);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NHits, m_nHits);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NCsEntries, m_nEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Flags, m_flags.to_ullong());
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Capacity, m_capacity);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::CsInfo);
-  return totalLength;
+  return detail::TlvCodec<Schema, CsInfo>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(CsInfo);
@@ -68,65 +73,15 @@ CsInfo::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, CsInfo>::encode(*this);
   return m_wire;
 }
 
 void
 CsInfo::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::CsInfo) {
-    NDN_THROW(Error("CsInfo", block.type()));
-  }
+  detail::TlvCodec<Schema, CsInfo>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Capacity) {
-    m_capacity = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Capacity field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Flags) {
-    m_flags = FlagsBitSet(static_cast<unsigned long long>(readNonNegativeInteger(*val)));
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Flags field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NCsEntries) {
-    m_nEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NCsEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NHits) {
-    m_nHits = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NHits field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NMisses) {
-    m_nMisses = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NMisses field"));
-  }
 }
 
 CsInfo&
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/face-event-notification.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
@@ -41,24 +42,28 @@ FaceEventNotification::FaceEventNotification(const Block& block)
   this->wireDecode(block);
 }
 
+struct FaceEventNotification::Schema
+{
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::nfd::FaceEventNotification, "FaceEventNotification",
+      detail::tlvField(tlv::nfd::FaceEventKind, "FaceEventKind", &FaceEventNotification::m_kind),
+      detail::tlvField(tlv::nfd::FaceId, "FaceId", &FaceEventNotification::m_faceId),
+      detail::tlvField(tlv::nfd::Uri, "Uri", &FaceEventNotification::m_remoteUri),
+      detail::tlvField(tlv::nfd::LocalUri, "LocalUri", &FaceEventNotification::m_localUri),
+      detail::tlvField(tlv::nfd::FaceScope, "FaceScope", &FaceEventNotification::m_faceScope),
+      detail::tlvField(tlv::nfd::FacePersistency, "FacePersistency", &FaceEventNotification::m_facePersistency),
+      detail::tlvField(tlv::nfd::LinkType, "LinkType", &FaceEventNotification::m_linkType),
+      detail::tlvField(tlv::nfd::Flags, "Flags", &FaceEventNotification::m_flags));
+  }
+};
+
 template<encoding::Tag TAG>
 size_t
 FaceEventNotification::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Flags, m_flags);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::LinkType, m_linkType);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FacePersistency, m_facePersistency);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceScope, m_faceScope);
-  totalLength += prependStringBlock(encoder, tlv::nfd::LocalUri, m_localUri);
-  totalLength += prependStringBlock(encoder, tlv::nfd::Uri, m_remoteUri);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceId, m_faceId);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceEventKind, m_kind);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::FaceEventNotification);
-  return totalLength;
+  return detail::TlvCodec<Schema, FaceEventNotification>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(FaceEventNotification);
@@ -69,90 +74,15 @@ FaceEventNotification::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, FaceEventNotification>::encode(*this);
   return m_wire;
 }
 
 void
 FaceEventNotification::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::FaceEventNotification) {
-    NDN_THROW(Error("FaceEventNotification", block.type()));
-  }
-
+  detail::TlvCodec<Schema, FaceEventNotification>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceEventKind) {
-    m_kind = readNonNegativeIntegerAs<FaceEventKind>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceEventKind field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceId) {
-    m_faceId = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceId field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Uri) {
-    m_remoteUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Uri field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LocalUri) {
-    m_localUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required LocalUri field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceScope) {
-    m_faceScope = readNonNegativeIntegerAs<FaceScope>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceScope field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FacePersistency) {
-    m_facePersistency = readNonNegativeIntegerAs<FacePersistency>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FacePersistency field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LinkType) {
-    m_linkType = readNonNegativeIntegerAs<LinkType>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required LinkType field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Flags) {
-    m_flags = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Flags field"));
-  }
 }
 
 FaceEventNotification&
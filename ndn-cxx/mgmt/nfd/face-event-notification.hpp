@@ -67,6 +67,8 @@ public: // getters & setters
   setKind(FaceEventKind kind);
 
 private:
+  struct Schema;
+
   FaceEventKind m_kind;
 };
 
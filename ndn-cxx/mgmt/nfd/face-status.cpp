@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/face-status.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
@@ -48,46 +49,39 @@ FaceStatus::FaceStatus(const Block& block)
   this->wireDecode(block);
 }
 
+struct FaceStatus::Schema
+{
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::nfd::FaceStatus, "FaceStatus",
+      detail::tlvField(tlv::nfd::FaceId, "FaceId", &FaceStatus::m_faceId),
+      detail::tlvField(tlv::nfd::Uri, "Uri", &FaceStatus::m_remoteUri),
+      detail::tlvField(tlv::nfd::LocalUri, "LocalUri", &FaceStatus::m_localUri),
+      detail::tlvField(tlv::nfd::ExpirationPeriod, "ExpirationPeriod", &FaceStatus::m_expirationPeriod),
+      detail::tlvField(tlv::nfd::FaceScope, "FaceScope", &FaceStatus::m_faceScope),
+      detail::tlvField(tlv::nfd::FacePersistency, "FacePersistency", &FaceStatus::m_facePersistency),
+      detail::tlvField(tlv::nfd::LinkType, "LinkType", &FaceStatus::m_linkType),
+      detail::tlvField(tlv::nfd::BaseCongestionMarkingInterval, "BaseCongestionMarkingInterval", &FaceStatus::m_baseCongestionMarkingInterval),
+      detail::tlvField(tlv::nfd::DefaultCongestionThreshold, "DefaultCongestionThreshold", &FaceStatus::m_defaultCongestionThreshold),
+      detail::tlvField(tlv::nfd::Mtu, "Mtu", &FaceStatus::m_mtu),
+      detail::tlvField(tlv::nfd::NInInterests, "NInInterests", &FaceStatus::m_nInInterests),
+      detail::tlvField(tlv::nfd::NInData, "NInData", &FaceStatus::m_nInData),
+      detail::tlvField(tlv::nfd::NInNacks, "NInNacks", &FaceStatus::m_nInNacks),
+      detail::tlvField(tlv::nfd::NOutInterests, "NOutInterests", &FaceStatus::m_nOutInterests),
+      detail::tlvField(tlv::nfd::NOutData, "NOutData", &FaceStatus::m_nOutData),
+      detail::tlvField(tlv::nfd::NOutNacks, "NOutNacks", &FaceStatus::m_nOutNacks),
+      detail::tlvField(tlv::nfd::NInBytes, "NInBytes", &FaceStatus::m_nInBytes),
+      detail::tlvField(tlv::nfd::NOutBytes, "NOutBytes", &FaceStatus::m_nOutBytes),
+      detail::tlvField(tlv::nfd::Flags, "Flags", &FaceStatus::m_flags));
+  }
+};
+
 template<encoding::Tag TAG>
 size_t
 FaceStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Flags, m_flags);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutBytes, m_nOutBytes);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInBytes, m_nInBytes);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutNacks, m_nOutNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutData, m_nOutData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutInterests, m_nOutInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInNacks, m_nInNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInData, m_nInData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInInterests, m_nInInterests);
-  if (m_mtu) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::Mtu, *m_mtu);
-  }
-  if (m_defaultCongestionThreshold) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::DefaultCongestionThreshold,
-                                                  *m_defaultCongestionThreshold);
-  }
-  if (m_baseCongestionMarkingInterval) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::BaseCongestionMarkingInterval,
-                                                  m_baseCongestionMarkingInterval->count());
-  }
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::LinkType, m_linkType);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FacePersistency, m_facePersistency);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceScope, m_faceScope);
-  if (m_expirationPeriod) {
-    totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::ExpirationPeriod,
-                                                  m_expirationPeriod->count());
-  }
-  totalLength += prependStringBlock(encoder, tlv::nfd::LocalUri, m_localUri);
-  totalLength += prependStringBlock(encoder, tlv::nfd::Uri, m_remoteUri);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::FaceId, m_faceId);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::FaceStatus);
-  return totalLength;
+  return detail::TlvCodec<Schema, FaceStatus>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(FaceStatus);
@@ -98,178 +92,15 @@ FaceStatus::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, FaceStatus>::encode(*this);
   return m_wire;
 }
 
 void
 FaceStatus::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::FaceStatus) {
-    NDN_THROW(Error("FaceStatus", block.type()));
-  }
-
+  detail::TlvCodec<Schema, FaceStatus>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceId) {
-    m_faceId = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceId field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Uri) {
-    m_remoteUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Uri field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LocalUri) {
-    m_localUri = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required LocalUri field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::ExpirationPeriod) {
-    m_expirationPeriod.emplace(readNonNegativeInteger(*val));
-    ++val;
-  }
-  else {
-    m_expirationPeriod = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceScope) {
-    m_faceScope = readNonNegativeIntegerAs<FaceScope>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceScope field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FacePersistency) {
-    m_facePersistency = readNonNegativeIntegerAs<FacePersistency>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FacePersistency field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::LinkType) {
-    m_linkType = readNonNegativeIntegerAs<LinkType>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required LinkType field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::BaseCongestionMarkingInterval) {
-    m_baseCongestionMarkingInterval.emplace(readNonNegativeInteger(*val));
-    ++val;
-  }
-  else {
-    m_baseCongestionMarkingInterval = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::DefaultCongestionThreshold) {
-    m_defaultCongestionThreshold = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    m_defaultCongestionThreshold = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Mtu) {
-    m_mtu = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    m_mtu = nullopt;
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInInterests) {
-    m_nInInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInData) {
-    m_nInData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInNacks) {
-    m_nInNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutInterests) {
-    m_nOutInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutData) {
-    m_nOutData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutNacks) {
-    m_nOutNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInBytes) {
-    m_nInBytes = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInBytes field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutBytes) {
-    m_nOutBytes = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutBytes field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Flags) {
-    m_flags = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Flags field"));
-  }
 }
 
 FaceStatus&
@@ -220,6 +220,8 @@ public: // getters & setters
   setNOutBytes(uint64_t nOutBytes);
 
 private:
+  struct Schema;
+
   optional<time::milliseconds> m_expirationPeriod;
   optional<time::nanoseconds> m_baseCongestionMarkingInterval;
   optional<uint64_t> m_defaultCongestionThreshold;
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/fib-entry.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
@@ -61,18 +62,22 @@ NextHopRecord::setCost(uint64_t cost)
   return *this;
 }
 
+struct NextHopRecord::Schema
+{
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::nfd::NextHopRecord, "NextHopRecord",
+      detail::tlvField(tlv::nfd::FaceId, "FaceId", &NextHopRecord::m_faceId),
+      detail::tlvField(tlv::nfd::Cost, "Cost", &NextHopRecord::m_cost));
+  }
+};
+
 template<encoding::Tag TAG>
 size_t
-NextHopRecord::wireEncode(EncodingImpl<TAG>& block) const
+NextHopRecord::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Cost, m_cost);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::FaceId, m_faceId);
-
-  totalLength += block.prependVarNumber(totalLength);
-  totalLength += block.prependVarNumber(ndn::tlv::nfd::NextHopRecord);
-  return totalLength;
+  return detail::TlvCodec<Schema, NextHopRecord>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(NextHopRecord);
@@ -83,44 +88,15 @@ NextHopRecord::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, NextHopRecord>::encode(*this);
   return m_wire;
 }
 
 void
 NextHopRecord::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::NextHopRecord) {
-    NDN_THROW(Error("NextHopRecord", block.type()));
-  }
-
+  detail::TlvCodec<Schema, NextHopRecord>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val == m_wire.elements_end()) {
-    NDN_THROW(Error("unexpected end of NextHopRecord"));
-  }
-  else if (val->type() != tlv::nfd::FaceId) {
-    NDN_THROW(Error("FaceId", val->type()));
-  }
-  m_faceId = readNonNegativeInteger(*val);
-  ++val;
-
-  if (val == m_wire.elements_end()) {
-    NDN_THROW(Error("unexpected end of NextHopRecord"));
-  }
-  else if (val->type() != tlv::nfd::Cost) {
-    NDN_THROW(Error("Cost", val->type()));
-  }
-  m_cost = readNonNegativeInteger(*val);
-  ++val;
 }
 
 bool
@@ -272,5 +248,59 @@ operator<<(std::ostream& os, const FibEntry& entry)
   return os << "         )";
 }
 
+////////////////////
+
+FibEntryView::FibEntryView(const Block& wire)
+  : m_wire(wire)
+{
+  if (m_wire.type() != tlv::nfd::FibEntry) {
+    NDN_THROW(FibEntry::Error("FibEntry", m_wire.type()));
+  }
+
+  BlockView view(m_wire);
+  auto val = view.elements_begin();
+  if (val == view.elements_end()) {
+    NDN_THROW(FibEntry::Error("unexpected end of FibEntry"));
+  }
+  else if (val->type() != tlv::Name) {
+    NDN_THROW(FibEntry::Error("Name", val->type()));
+  }
+  m_prefix = *val;
+}
+
+Name
+FibEntryView::getPrefix() const
+{
+  return Name(Block(m_wire, m_prefix));
+}
+
+void
+FibEntryView::forEachNextHop(const std::function<void(const NextHopRecord&)>& visitor) const
+{
+  BlockView view(m_wire);
+  NextHopRecord nh;
+  // skip the prefix, which has been checked by the constructor
+  auto val = view.elements_begin();
+  for (++val; val != view.elements_end(); ++val) {
+    if (val->type() != tlv::nfd::NextHopRecord) {
+      NDN_THROW(FibEntry::Error("NextHopRecord", val->type()));
+    }
+
+    auto field = val->elements_begin();
+    if (field == val->elements_end() || field->type() != tlv::nfd::FaceId) {
+      NDN_THROW(NextHopRecord::Error("missing required FaceId field"));
+    }
+    nh.setFaceId(readNonNegativeInteger(*field));
+    ++field;
+
+    if (field == val->elements_end() || field->type() != tlv::nfd::Cost) {
+      NDN_THROW(NextHopRecord::Error("missing required Cost field"));
+    }
+    nh.setCost(readNonNegativeInteger(*field));
+
+    visitor(nh);
+  }
+}
+
 } // namespace nfd
 } // namespace ndn
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 
 namespace ndn {
 namespace nfd {
@@ -74,6 +75,8 @@ public:
   wireDecode(const Block& block);
 
 private:
+  struct Schema;
+
   uint64_t m_faceId;
   uint64_t m_cost;
 
@@ -173,6 +176,68 @@ operator!=(const FibEntry& a, const FibEntry& b)
 std::ostream&
 operator<<(std::ostream& os, const FibEntry& entry);
 
+/**
+ * \ingroup management
+ * \brief Read-only view of an encoded FibEntry.
+ *
+ * Unlike FibEntry, a FibEntryView does not decode the next hop records into a vector. Fields
+ * are read from the wire encoding on access, which is shared with the buffer it was received in.
+ *
+ * \sa FibDataset, Controller::fetch
+ */
+class FibEntryView
+{
+public:
+  /**
+   * \throw FibEntry::Error \p wire is not a FibEntry, or does not start with a Name
+   */
+  explicit
+  FibEntryView(const Block& wire);
+
+  /**
+   * \brief Return the prefix.
+   * \note The returned Name shares the underlying buffer.
+   */
+  Name
+  getPrefix() const;
+
+  /**
+   * \brief Return the encoded prefix, without decoding it.
+   * \note The view is valid as long as this FibEntryView exists.
+   */
+  BlockView
+  getPrefixWire() const noexcept
+  {
+    return m_prefix;
+  }
+
+  /**
+   * \brief Invoke \p visitor on each next hop record, in order.
+   * \throw tlv::Error a next hop record cannot be decoded
+   */
+  void
+  forEachNextHop(const std::function<void(const NextHopRecord&)>& visitor) const;
+
+  /**
+   * \brief Decode the whole entry.
+   */
+  FibEntry
+  decode() const
+  {
+    return FibEntry(m_wire);
+  }
+
+  const Block&
+  wireEncode() const noexcept
+  {
+    return m_wire;
+  }
+
+private:
+  Block m_wire;
+  BlockView m_prefix;
+};
+
 } // namespace nfd
 } // namespace ndn
 
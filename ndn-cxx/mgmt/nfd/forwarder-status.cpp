@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/forwarder-status.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
@@ -52,34 +53,36 @@ ForwarderStatus::ForwarderStatus(const Block& payload)
   this->wireDecode(payload);
 }
 
+struct ForwarderStatus::Schema
+{
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::Content, "Content",
+      detail::tlvField(tlv::nfd::NfdVersion, "NfdVersion", &ForwarderStatus::m_nfdVersion),
+      detail::tlvField(tlv::nfd::StartTimestamp, "StartTimestamp", &ForwarderStatus::m_startTimestamp),
+      detail::tlvField(tlv::nfd::CurrentTimestamp, "CurrentTimestamp", &ForwarderStatus::m_currentTimestamp),
+      detail::tlvField(tlv::nfd::NNameTreeEntries, "NNameTreeEntries", &ForwarderStatus::m_nNameTreeEntries),
+      detail::tlvField(tlv::nfd::NFibEntries, "NFibEntries", &ForwarderStatus::m_nFibEntries),
+      detail::tlvField(tlv::nfd::NPitEntries, "NPitEntries", &ForwarderStatus::m_nPitEntries),
+      detail::tlvField(tlv::nfd::NMeasurementsEntries, "NMeasurementsEntries", &ForwarderStatus::m_nMeasurementsEntries),
+      detail::tlvField(tlv::nfd::NCsEntries, "NCsEntries", &ForwarderStatus::m_nCsEntries),
+      detail::tlvField(tlv::nfd::NInInterests, "NInInterests", &ForwarderStatus::m_nInInterests),
+      detail::tlvField(tlv::nfd::NInData, "NInData", &ForwarderStatus::m_nInData),
+      detail::tlvField(tlv::nfd::NInNacks, "NInNacks", &ForwarderStatus::m_nInNacks),
+      detail::tlvField(tlv::nfd::NOutInterests, "NOutInterests", &ForwarderStatus::m_nOutInterests),
+      detail::tlvField(tlv::nfd::NOutData, "NOutData", &ForwarderStatus::m_nOutData),
+      detail::tlvField(tlv::nfd::NOutNacks, "NOutNacks", &ForwarderStatus::m_nOutNacks),
+      detail::tlvField(tlv::nfd::NSatisfiedInterests, "NSatisfiedInterests", &ForwarderStatus::m_nSatisfiedInterests),
+      detail::tlvField(tlv::nfd::NUnsatisfiedInterests, "NUnsatisfiedInterests", &ForwarderStatus::m_nUnsatisfiedInterests));
+  }
+};
+
 template<encoding::Tag TAG>
 size_t
 ForwarderStatus::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NUnsatisfiedInterests, m_nUnsatisfiedInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NSatisfiedInterests, m_nSatisfiedInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutNacks, m_nOutNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutData, m_nOutData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NOutInterests, m_nOutInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInNacks, m_nInNacks);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInData, m_nInData);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NInInterests, m_nInInterests);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NCsEntries, m_nCsEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NMeasurementsEntries, m_nMeasurementsEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NPitEntries, m_nPitEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NFibEntries, m_nFibEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::NNameTreeEntries, m_nNameTreeEntries);
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::CurrentTimestamp,
-                                                time::toUnixTimestamp(m_currentTimestamp).count());
-  totalLength += prependNonNegativeIntegerBlock(encoder, tlv::nfd::StartTimestamp,
-                                                time::toUnixTimestamp(m_startTimestamp).count());
-  totalLength += prependStringBlock(encoder, tlv::nfd::NfdVersion, m_nfdVersion);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::Content);
-  return totalLength;
+  return detail::TlvCodec<Schema, ForwarderStatus>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(ForwarderStatus);
@@ -90,154 +93,15 @@ ForwarderStatus::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, ForwarderStatus>::encode(*this);
   return m_wire;
 }
 
 void
 ForwarderStatus::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::Content) {
-    NDN_THROW(Error("Content", block.type()));
-  }
-
+  detail::TlvCodec<Schema, ForwarderStatus>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NfdVersion) {
-    m_nfdVersion = readString(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NfdVersion field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::StartTimestamp) {
-    m_startTimestamp = time::fromUnixTimestamp(time::milliseconds(readNonNegativeInteger(*val)));
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required StartTimestamp field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::CurrentTimestamp) {
-    m_currentTimestamp = time::fromUnixTimestamp(time::milliseconds(readNonNegativeInteger(*val)));
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required CurrentTimestamp field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NNameTreeEntries) {
-    m_nNameTreeEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NNameTreeEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NFibEntries) {
-    m_nFibEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NFibEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NPitEntries) {
-    m_nPitEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NPitEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NMeasurementsEntries) {
-    m_nMeasurementsEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NMeasurementsEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NCsEntries) {
-    m_nCsEntries = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NCsEntries field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInInterests) {
-    m_nInInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInData) {
-    m_nInData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NInNacks) {
-    m_nInNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NInNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutInterests) {
-    m_nOutInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutData) {
-    m_nOutData = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutData field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NOutNacks) {
-    m_nOutNacks = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NOutNacks field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NSatisfiedInterests) {
-    m_nSatisfiedInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NSatisfiedInterests field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::NUnsatisfiedInterests) {
-    m_nUnsatisfiedInterests = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required NUnsatisfiedInterests field"));
-  }
 }
 
 ForwarderStatus&
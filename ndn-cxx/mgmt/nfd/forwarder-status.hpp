@@ -215,6 +215,8 @@ public: // getters & setters
   setNUnsatisfiedInterests(uint64_t nUnsatisfiedInterests);
 
 private:
+  struct Schema;
+
   std::string m_nfdVersion;
   time::system_clock::TimePoint m_startTimestamp;
   time::system_clock::TimePoint m_currentTimestamp;
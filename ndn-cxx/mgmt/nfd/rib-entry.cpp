@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/rib-entry.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
@@ -99,24 +100,25 @@ Route::unsetExpirationPeriod()
   return *this;
 }
 
-template<encoding::Tag TAG>
-size_t
-Route::wireEncode(EncodingImpl<TAG>& block) const
+struct Route::Schema
 {
-  size_t totalLength = 0;
-
-  if (m_expirationPeriod) {
-    totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::ExpirationPeriod,
-                                                  static_cast<uint64_t>(m_expirationPeriod->count()));
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::nfd::Route, "Route",
+      detail::tlvField(tlv::nfd::FaceId, "FaceId", &Route::m_faceId),
+      detail::tlvField(tlv::nfd::Origin, "Origin", &Route::m_origin),
+      detail::tlvField(tlv::nfd::Cost, "Cost", &Route::m_cost),
+      detail::tlvField(tlv::nfd::Flags, "Flags", &Route::m_flags),
+      detail::tlvField(tlv::nfd::ExpirationPeriod, "ExpirationPeriod", &Route::m_expirationPeriod));
   }
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Flags, m_flags);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Cost, m_cost);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::Origin, m_origin);
-  totalLength += prependNonNegativeIntegerBlock(block, ndn::tlv::nfd::FaceId, m_faceId);
+};
 
-  totalLength += block.prependVarNumber(totalLength);
-  totalLength += block.prependVarNumber(ndn::tlv::nfd::Route);
-  return totalLength;
+template<encoding::Tag TAG>
+size_t
+Route::wireEncode(EncodingImpl<TAG>& encoder) const
+{
+  return detail::TlvCodec<Schema, Route>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(Route);
@@ -127,66 +129,15 @@ Route::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, Route>::encode(*this);
   return m_wire;
 }
 
 void
 Route::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::Route) {
-    NDN_THROW(Error("Route", block.type()));
-  }
-
+  detail::TlvCodec<Schema, Route>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::FaceId) {
-    m_faceId = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required FaceId field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Origin) {
-    m_origin = readNonNegativeIntegerAs<RouteOrigin>(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Origin field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Cost) {
-    m_cost = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Cost field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Flags) {
-    m_flags = readNonNegativeInteger(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Flags field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::ExpirationPeriod) {
-    m_expirationPeriod.emplace(readNonNegativeInteger(*val));
-    ++val;
-  }
-  else {
-    m_expirationPeriod = nullopt;
-  }
 }
 
 bool
@@ -351,5 +302,79 @@ operator<<(std::ostream& os, const RibEntry& entry)
   return os << "         )";
 }
 
+////////////////////
+
+RibEntryView::RibEntryView(const Block& wire)
+  : m_wire(wire)
+{
+  if (m_wire.type() != tlv::nfd::RibEntry) {
+    NDN_THROW(RibEntry::Error("RibEntry", m_wire.type()));
+  }
+
+  BlockView view(m_wire);
+  auto val = view.elements_begin();
+  if (val == view.elements_end()) {
+    NDN_THROW(RibEntry::Error("unexpected end of RibEntry"));
+  }
+  else if (val->type() != tlv::Name) {
+    NDN_THROW(RibEntry::Error("Name", val->type()));
+  }
+  m_prefix = *val;
+}
+
+Name
+RibEntryView::getName() const
+{
+  return Name(Block(m_wire, m_prefix));
+}
+
+void
+RibEntryView::forEachRoute(const std::function<void(const Route&)>& visitor) const
+{
+  BlockView view(m_wire);
+  Route route;
+  // skip the prefix, which has been checked by the constructor
+  auto val = view.elements_begin();
+  for (++val; val != view.elements_end(); ++val) {
+    if (val->type() != tlv::nfd::Route) {
+      NDN_THROW(RibEntry::Error("Route", val->type()));
+    }
+
+    auto field = val->elements_begin();
+    if (field == val->elements_end() || field->type() != tlv::nfd::FaceId) {
+      NDN_THROW(Route::Error("missing required FaceId field"));
+    }
+    route.setFaceId(readNonNegativeInteger(*field));
+    ++field;
+
+    if (field == val->elements_end() || field->type() != tlv::nfd::Origin) {
+      NDN_THROW(Route::Error("missing required Origin field"));
+    }
+    route.setOrigin(readNonNegativeIntegerAs<RouteOrigin>(*field));
+    ++field;
+
+    if (field == val->elements_end() || field->type() != tlv::nfd::Cost) {
+      NDN_THROW(Route::Error("missing required Cost field"));
+    }
+    route.setCost(readNonNegativeInteger(*field));
+    ++field;
+
+    if (field == val->elements_end() || field->type() != tlv::nfd::Flags) {
+      NDN_THROW(Route::Error("missing required Flags field"));
+    }
+    route.setFlags(readNonNegativeInteger(*field));
+    ++field;
+
+    if (field != val->elements_end() && field->type() == tlv::nfd::ExpirationPeriod) {
+      route.setExpirationPeriod(time::milliseconds(readNonNegativeInteger(*field)));
+    }
+    else {
+      route.unsetExpirationPeriod();
+    }
+
+    visitor(route);
+  }
+}
+
 } // namespace nfd
 } // namespace ndn
@@ -24,6 +24,7 @@
 
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/encoding/block-view.hpp"
 #include "ndn-cxx/mgmt/nfd/route-flags-traits.hpp"
 #include "ndn-cxx/util/time.hpp"
 
@@ -118,6 +119,8 @@ public:
   wireDecode(const Block& block);
 
 private:
+  struct Schema;
+
   uint64_t m_faceId;
   RouteOrigin m_origin;
   uint64_t m_cost;
@@ -225,6 +228,68 @@ operator!=(const RibEntry& a, const RibEntry& b)
 std::ostream&
 operator<<(std::ostream& os, const RibEntry& entry);
 
+/**
+ * \ingroup management
+ * \brief Read-only view of an encoded RibEntry.
+ *
+ * Unlike RibEntry, a RibEntryView does not decode the routes into a vector. Fields are read
+ * from the wire encoding on access, which is shared with the buffer it was received in.
+ *
+ * \sa RibDataset, Controller::fetch
+ */
+class RibEntryView
+{
+public:
+  /**
+   * \throw RibEntry::Error \p wire is not a RibEntry, or does not start with a Name
+   */
+  explicit
+  RibEntryView(const Block& wire);
+
+  /**
+   * \brief Return the prefix.
+   * \note The returned Name shares the underlying buffer.
+   */
+  Name
+  getName() const;
+
+  /**
+   * \brief Return the encoded prefix, without decoding it.
+   * \note The view is valid as long as this RibEntryView exists.
+   */
+  BlockView
+  getNameWire() const noexcept
+  {
+    return m_prefix;
+  }
+
+  /**
+   * \brief Invoke \p visitor on each route, in order.
+   * \throw tlv::Error a route cannot be decoded
+   */
+  void
+  forEachRoute(const std::function<void(const Route&)>& visitor) const;
+
+  /**
+   * \brief Decode the whole entry.
+   */
+  RibEntry
+  decode() const
+  {
+    return RibEntry(m_wire);
+  }
+
+  const Block&
+  wireEncode() const noexcept
+  {
+    return m_wire;
+  }
+
+private:
+  Block m_wire;
+  BlockView m_prefix;
+};
+
 } // namespace nfd
 } // namespace ndn
 
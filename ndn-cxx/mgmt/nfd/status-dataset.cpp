@@ -171,5 +171,109 @@ RibDataset::parseResult(ConstBufferPtr payload) const
   return parseDatasetVector<RibEntry>(payload);
 }
 
+/**
+ * \brief Determines the total size of the TLV element that starts at \p begin.
+ * \return size of the element, or 0 if [\p begin, \p end) does not contain its whole TLV-TYPE
+ *         and TLV-LENGTH
+ * \throw StatusDataset::ParseResultError TLV-TYPE or TLV-LENGTH is invalid
+ */
+static size_t
+getElementSize(const uint8_t* begin, const uint8_t* end)
+{
+  const uint8_t* pos = begin;
+  uint64_t type = 0;
+  uint64_t length = 0;
+  if (!tlv::readVarNumber(pos, end, type) || !tlv::readVarNumber(pos, end, length)) {
+    return 0;
+  }
+
+  if (type == tlv::Invalid || type > std::numeric_limits<uint32_t>::max()) {
+    NDN_THROW(StatusDataset::ParseResultError("Invalid TLV-TYPE " + to_string(type)));
+  }
+  size_t headerSize = static_cast<size_t>(pos - begin);
+  if (length > std::numeric_limits<size_t>::max() - headerSize) {
+    NDN_THROW(StatusDataset::ParseResultError("TLV-LENGTH " + to_string(length) + " is too large"));
+  }
+  return headerSize + static_cast<size_t>(length);
+}
+
+StatusDatasetParser::StatusDatasetParser(EntryCallback onEntry)
+  : m_onEntry(std::move(onEntry))
+{
+  BOOST_ASSERT(m_onEntry != nullptr);
+}
+
+bool
+StatusDatasetParser::parse(ConstBufferPtr piece)
+{
+  BOOST_ASSERT(piece != nullptr);
+  if (m_isStopped) {
+    return false;
+  }
+
+  const uint8_t* pos = piece->data();
+  const uint8_t* const end = pos + piece->size();
+
+  if (!m_partial.empty()) {
+    // the header of the pending entry may itself have been split
+    size_t entrySize = getElementSize(m_partial.data(), m_partial.data() + m_partial.size());
+    while (entrySize == 0 && pos != end) {
+      m_partial.push_back(*pos++);
+      entrySize = getElementSize(m_partial.data(), m_partial.data() + m_partial.size());
+    }
+    if (entrySize == 0) {
+      return true;
+    }
+
+    size_t nBytes = std::min(entrySize - m_partial.size(), static_cast<size_t>(end - pos));
+    m_partial.insert(m_partial.end(), pos, pos + nBytes);
+    pos += nBytes;
+    if (m_partial.size() < entrySize) {
+      return true;
+    }
+
+    Block entry(std::make_shared<const Buffer>(std::move(m_partial)));
+    m_partial.clear();
+    if (!deliver(entry)) {
+      return false;
+    }
+  }
+
+  while (pos != end) {
+    size_t entrySize = getElementSize(pos, end);
+    if (entrySize == 0 || entrySize > static_cast<size_t>(end - pos)) {
+      m_partial.assign(pos, end);
+      return true;
+    }
+
+    auto entryBegin = piece->begin() + (pos - piece->data());
+    Block entry(piece, entryBegin, entryBegin + entrySize);
+    pos += entrySize;
+    if (!deliver(entry)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool
+StatusDatasetParser::deliver(const Block& entry)
+{
+  if (!m_onEntry(entry)) {
+    m_isStopped = true;
+    m_partial.clear();
+    return false;
+  }
+  return true;
+}
+
+void
+StatusDatasetParser::finish() const
+{
+  if (!m_isStopped && !m_partial.empty()) {
+    NDN_THROW(StatusDataset::ParseResultError("Dataset ends in the middle of an entry"));
+  }
+}
+
 } // namespace nfd
 } // namespace ndn
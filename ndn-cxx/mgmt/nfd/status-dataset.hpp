@@ -79,6 +79,13 @@ public:
   };
 
 #ifdef DOXYGEN
+  /**
+   * \brief If defined, specifies the type of each entry of a dataset that is a sequence;
+   *        the type is constructible from the Block of an entry.
+   * \sa Controller::fetch
+   */
+  using EntryType = int;
+
   /**
    * \brief Parses a result from reassembled payload.
    * \param payload reassembled payload
@@ -133,6 +140,8 @@ class FaceDatasetBase : public StatusDataset
 public:
   using ResultType = std::vector<FaceStatus>;
 
+  using EntryType = FaceStatus;
+
   ResultType
   parseResult(ConstBufferPtr payload) const;
 
@@ -185,6 +194,8 @@ public:
 
   using ResultType = std::vector<ChannelStatus>;
 
+  using EntryType = ChannelStatus;
+
   ResultType
   parseResult(ConstBufferPtr payload) const;
 };
@@ -201,6 +212,8 @@ public:
 
   using ResultType = std::vector<FibEntry>;
 
+  using EntryType = FibEntryView;
+
   ResultType
   parseResult(ConstBufferPtr payload) const;
 };
@@ -233,6 +246,8 @@ public:
 
   using ResultType = std::vector<StrategyChoice>;
 
+  using EntryType = StrategyChoice;
+
   ResultType
   parseResult(ConstBufferPtr payload) const;
 };
@@ -249,10 +264,56 @@ public:
 
   using ResultType = std::vector<RibEntry>;
 
+  using EntryType = RibEntryView;
+
   ResultType
   parseResult(ConstBufferPtr payload) const;
 };
 
+/**
+ * \ingroup management
+ * \brief Splits the payload of a dataset into its entries, as the payload arrives.
+ *
+ * The payload is passed in pieces, such as the contents of consecutive segments. An entry that
+ * lies within a single piece is delivered as a Block that shares the buffer of that piece; an
+ * entry that spans several pieces is reassembled into a buffer of its own.
+ */
+class StatusDatasetParser : noncopyable
+{
+public:
+  /**
+   * \brief Callback invoked on each entry; returning false stops the parsing.
+   */
+  using EntryCallback = std::function<bool(const Block&)>;
+
+  explicit
+  StatusDatasetParser(EntryCallback onEntry);
+
+  /**
+   * \brief Parse the next piece of the payload.
+   * \return false if the parsing has been stopped by the callback, true otherwise
+   * \throw tlv::Error an entry is malformed, or the callback could not decode it
+   */
+  bool
+  parse(ConstBufferPtr piece);
+
+  /**
+   * \brief Check that the payload does not end in the middle of an entry.
+   * \throw StatusDataset::ParseResultError the last entry is incomplete
+   */
+  void
+  finish() const;
+
+private:
+  bool
+  deliver(const Block& entry);
+
+private:
+  EntryCallback m_onEntry;
+  Buffer m_partial; ///< beginning of an entry that continues in the next piece
+  bool m_isStopped = false;
+};
+
 } // namespace nfd
 } // namespace ndn
 
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/nfd/strategy-choice.hpp"
+#include "ndn-cxx/detail/tlv-schema.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
 #include "ndn-cxx/encoding/tlv-nfd.hpp"
@@ -37,18 +38,22 @@ StrategyChoice::StrategyChoice(const Block& payload)
   this->wireDecode(payload);
 }
 
+struct StrategyChoice::Schema
+{
+  static constexpr auto
+  describe()
+  {
+    return detail::tlvStruct(tlv::nfd::StrategyChoice, "StrategyChoice",
+      detail::tlvField(tlv::Name, "Name", &StrategyChoice::m_name),
+      detail::tlvField(tlv::nfd::Strategy, "Strategy", &StrategyChoice::m_strategy));
+  }
+};
+
 template<encoding::Tag TAG>
 size_t
 StrategyChoice::wireEncode(EncodingImpl<TAG>& encoder) const
 {
-  size_t totalLength = 0;
-
-  totalLength += prependNestedBlock(encoder, tlv::nfd::Strategy, m_strategy);
-  totalLength += m_name.wireEncode(encoder);
-
-  totalLength += encoder.prependVarNumber(totalLength);
-  totalLength += encoder.prependVarNumber(tlv::nfd::StrategyChoice);
-  return totalLength;
+  return detail::TlvCodec<Schema, StrategyChoice>::prepend(encoder, *this);
 }
 
 NDN_CXX_DEFINE_WIRE_ENCODE_INSTANTIATIONS(StrategyChoice);
@@ -59,48 +64,15 @@ StrategyChoice::wireEncode() const
   if (m_wire.hasWire())
     return m_wire;
 
-  EncodingEstimator estimator;
-  size_t estimatedSize = wireEncode(estimator);
-
-  EncodingBuffer buffer(estimatedSize, 0);
-  wireEncode(buffer);
-
-  m_wire = buffer.block();
+  m_wire = detail::TlvCodec<Schema, StrategyChoice>::encode(*this);
   return m_wire;
 }
 
 void
 StrategyChoice::wireDecode(const Block& block)
 {
-  if (block.type() != tlv::nfd::StrategyChoice) {
-    NDN_THROW(Error("StrategyChoice", block.type()));
-  }
-
+  detail::TlvCodec<Schema, StrategyChoice>::decode(block, *this);
   m_wire = block;
-  m_wire.parse();
-  auto val = m_wire.elements_begin();
-
-  if (val != m_wire.elements_end() && val->type() == tlv::Name) {
-    m_name.wireDecode(*val);
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Name field"));
-  }
-
-  if (val != m_wire.elements_end() && val->type() == tlv::nfd::Strategy) {
-    val->parse();
-    if (val->elements().empty()) {
-      NDN_THROW(Error("expecting Strategy/Name"));
-    }
-    else {
-      m_strategy.wireDecode(*val->elements_begin());
-    }
-    ++val;
-  }
-  else {
-    NDN_THROW(Error("missing required Strategy field"));
-  }
 }
 
 StrategyChoice&
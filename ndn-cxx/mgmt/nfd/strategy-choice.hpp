@@ -77,6 +77,8 @@ public: // getters & setters
   setStrategy(const Name& strategy);
 
 private:
+  struct Schema;
+
   Name m_name; // namespace
   Name m_strategy; // strategy for the namespace
 
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/mgmt/status-dataset-context.hpp"
+#include "ndn-cxx/name-builder.hpp"
 
 namespace ndn {
 namespace mgmt {
@@ -70,7 +71,7 @@ StatusDatasetContext::append(span<const uint8_t> bytes)
 
   while (!bytes.empty()) {
     if (m_buffer.size() == MAX_PAYLOAD_LENGTH) {
-      m_dataSender(Name(m_prefix).appendSegment(m_segmentNo++),
+      m_dataSender(NameBuilder(m_prefix).appendSegment(m_segmentNo++).build(),
                    makeBinaryBlock(tlv::Content, m_buffer), false);
       m_buffer.clear();
     }
@@ -91,7 +92,7 @@ StatusDatasetContext::end()
   m_state = State::FINALIZED;
 
   BOOST_ASSERT(m_buffer.size() <= MAX_PAYLOAD_LENGTH);
-  m_dataSender(Name(m_prefix).appendSegment(m_segmentNo),
+  m_dataSender(NameBuilder(m_prefix).appendSegment(m_segmentNo).build(),
                makeBinaryBlock(tlv::Content, m_buffer), true);
 }
 
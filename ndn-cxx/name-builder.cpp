@@ -0,0 +1,203 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/name-builder.hpp"
+#include "ndn-cxx/impl/name-component-types.hpp"
+
+#include <cstring>
+
+namespace ndn {
+
+// TLV-TYPE of Name (1 octet) and the largest possible TLV-LENGTH (9 octets)
+const size_t HEADROOM = 10;
+
+NameBuilder::NameBuilder(const Name& prefix, size_t extraCapacity)
+  : m_capacity(prefix.wireEncode().value_size() + extraCapacity)
+{
+  append(prefix);
+}
+
+Name
+NameBuilder::build() const
+{
+  if (m_buffer == nullptr) {
+    return Name();
+  }
+
+  auto begin = m_buffer->cbegin() + (HEADROOM - m_headerSize);
+  auto end = m_buffer->cbegin() + m_end;
+  return Name(Block(m_buffer, begin, end, false));
+}
+
+uint8_t*
+NameBuilder::prepareAppend(size_t size)
+{
+  size_t required = std::max(m_end, HEADROOM) + size;
+  if (m_buffer == nullptr) {
+    m_buffer = make_shared<Buffer>(std::max(required, HEADROOM + m_capacity), Buffer::NoInit{});
+    m_end = HEADROOM;
+  }
+  else if (m_buffer.use_count() > 1) {
+    // copy on write; the copy is often the last append before build(), so don't over-allocate
+    auto buffer = make_shared<Buffer>(required, Buffer::NoInit{});
+    std::memcpy(buffer->data() + HEADROOM, m_buffer->data() + HEADROOM, m_end - HEADROOM);
+    m_buffer = std::move(buffer);
+  }
+  else if (required > m_buffer->size()) {
+    m_buffer->resize(std::max(required, 2 * m_buffer->size()), Buffer::NoInit{});
+  }
+  return m_buffer->data() + m_end;
+}
+
+void
+NameBuilder::commitAppend(size_t size, size_t nComponents)
+{
+  m_end += size;
+  m_nComponents += nComponents;
+
+  size_t valueSize = m_end - HEADROOM;
+  m_headerSize = tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(valueSize);
+  name::detail::writeTypeLength(m_buffer->data() + HEADROOM - m_headerSize, tlv::Name, valueSize);
+}
+
+NameBuilder&
+NameBuilder::appendComponent(uint32_t type, span<const uint8_t> value)
+{
+  uint8_t* out = prepareAppend(tlv::sizeOfVarNumber(type) + tlv::sizeOfVarNumber(value.size()) +
+                               value.size());
+  size_t headerSize = name::detail::writeTypeLength(out, type, value.size());
+  std::memcpy(out + headerSize, value.data(), value.size());
+  commitAppend(headerSize + value.size());
+  return *this;
+}
+
+NameBuilder&
+NameBuilder::appendNumberComponent(uint32_t type, optional<uint8_t> marker, uint64_t number)
+{
+  size_t numberSize = tlv::sizeOfNonNegativeInteger(number);
+  size_t valueSize = numberSize + (marker ? 1 : 0);
+
+  uint8_t* out = prepareAppend(tlv::sizeOfVarNumber(type) + 1 + valueSize);
+  uint8_t* pos = out + name::detail::writeTypeLength(out, type, valueSize);
+  if (marker) {
+    *pos++ = *marker;
+  }
+  for (size_t i = numberSize; i > 0; --i) {
+    pos[i - 1] = static_cast<uint8_t>(number);
+    number >>= 8;
+  }
+  commitAppend(static_cast<size_t>(pos + numberSize - out));
+  return *this;
+}
+
+NameBuilder&
+NameBuilder::appendConventionNumber(uint32_t type, uint8_t marker, uint64_t number)
+{
+  if (name::getConventionEncoding() == name::Convention::MARKER) {
+    return appendNumberComponent(tlv::GenericNameComponent, marker, number);
+  }
+  return appendNumberComponent(type, nullopt, number);
+}
+
+NameBuilder&
+NameBuilder::append(uint32_t type, span<const uint8_t> value)
+{
+  if (type < tlv::NameComponentMin || type > tlv::NameComponentMax) {
+    NDN_THROW(name::Component::Error("TLV-TYPE " + to_string(type) + " is not a valid NameComponent"));
+  }
+  name::getComponentTypeTable().get(type).check(value);
+  return appendComponent(type, value);
+}
+
+NameBuilder&
+NameBuilder::append(const char* str)
+{
+  return appendComponent(tlv::GenericNameComponent,
+                         {reinterpret_cast<const uint8_t*>(str), std::strlen(str)});
+}
+
+NameBuilder&
+NameBuilder::append(const name::Component& component)
+{
+  // a Component is always valid
+  return appendComponent(component.type(), component.value_bytes());
+}
+
+NameBuilder&
+NameBuilder::append(const PartialName& name)
+{
+  if (name.empty()) {
+    return *this;
+  }
+
+  auto components = name.wireEncode().value_bytes();
+  uint8_t* out = prepareAppend(components.size());
+  std::memcpy(out, components.data(), components.size());
+  commitAppend(components.size(), name.size());
+  return *this;
+}
+
+NameBuilder&
+NameBuilder::appendNumber(uint64_t number)
+{
+  return appendNumberComponent(tlv::GenericNameComponent, nullopt, number);
+}
+
+NameBuilder&
+NameBuilder::appendNumberWithMarker(uint8_t marker, uint64_t number)
+{
+  return appendNumberComponent(tlv::GenericNameComponent, marker, number);
+}
+
+NameBuilder&
+NameBuilder::appendSegment(uint64_t segmentNo)
+{
+  return appendConventionNumber(tlv::SegmentNameComponent, name::SEGMENT_MARKER, segmentNo);
+}
+
+NameBuilder&
+NameBuilder::appendByteOffset(uint64_t offset)
+{
+  return appendConventionNumber(tlv::ByteOffsetNameComponent, name::SEGMENT_OFFSET_MARKER, offset);
+}
+
+NameBuilder&
+NameBuilder::appendVersion(const optional<uint64_t>& version)
+{
+  return appendConventionNumber(tlv::VersionNameComponent, name::VERSION_MARKER,
+                                version.value_or(time::toUnixTimestamp(time::system_clock::now()).count()));
+}
+
+NameBuilder&
+NameBuilder::appendTimestamp(const optional<time::system_clock::time_point>& timestamp)
+{
+  auto tp = timestamp.value_or(time::system_clock::now());
+  uint64_t value = time::duration_cast<time::microseconds>(tp - time::getUnixEpoch()).count();
+  return appendConventionNumber(tlv::TimestampNameComponent, name::TIMESTAMP_MARKER, value);
+}
+
+NameBuilder&
+NameBuilder::appendSequenceNumber(uint64_t seqNo)
+{
+  return appendConventionNumber(tlv::SequenceNumNameComponent, name::SEQUENCE_NUMBER_MARKER, seqNo);
+}
+
+} // namespace ndn
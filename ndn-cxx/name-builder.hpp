@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_NAME_BUILDER_HPP
+#define NDN_CXX_NAME_BUILDER_HPP
+
+#include "ndn-cxx/name.hpp"
+
+namespace ndn {
+
+/**
+ * @brief Builds a Name by encoding its components directly into a single buffer.
+ *
+ * Appending a component to a Name creates a separately allocated name::Component, and the
+ * Name must later be re-encoded into yet another buffer. NameBuilder instead writes each
+ * component into one buffer that already has the layout of the Name TLV, so that build()
+ * returns a Name whose wire encoding is set and refers to that buffer.
+ *
+ * Copying a NameBuilder is cheap: the copy shares the encoded components with the original
+ * until either of them is modified, and the first modification copies the components into a
+ * buffer of exactly the required size. This makes the common "prefix plus one component"
+ * pattern efficient:
+ * @code
+ * NameBuilder prefix(dataName);
+ * for (uint64_t segment = 0; segment < nSegments; ++segment) {
+ *   Name segmentName = NameBuilder(prefix).appendSegment(segment).build();
+ *   // ...
+ * }
+ * @endcode
+ *
+ * Names returned by build() are never affected by modifications made to the builder afterwards.
+ */
+class NameBuilder
+{
+public:
+  /**
+   * @brief Create a builder for an empty name.
+   * @param capacity expected total size of the encoded components, to be reserved
+   *                 on the first append
+   */
+  explicit
+  NameBuilder(size_t capacity = 0) noexcept
+    : m_capacity(capacity)
+  {
+  }
+
+  /**
+   * @brief Create a builder whose first components are those of @p prefix.
+   * @param prefix the components to start with
+   * @param extraCapacity additional room to reserve for components appended later
+   */
+  explicit
+  NameBuilder(const Name& prefix, size_t extraCapacity = 16);
+
+  /**
+   * @brief Return the number of components appended so far.
+   */
+  size_t
+  size() const noexcept
+  {
+    return m_nComponents;
+  }
+
+  bool
+  empty() const noexcept
+  {
+    return m_nComponents == 0;
+  }
+
+  /**
+   * @brief Return a Name consisting of the components appended so far.
+   *
+   * The returned Name has its wire encoding set and shares the buffer of this builder.
+   */
+  Name
+  build() const;
+
+public: // appending components
+  /**
+   * @brief Append a component of the specified type with the specified TLV-VALUE.
+   * @throw name::Component::Error @p type or @p value is not valid for a name component
+   */
+  NameBuilder&
+  append(uint32_t type, span<const uint8_t> value);
+
+  /**
+   * @brief Append a GenericNameComponent with the specified TLV-VALUE.
+   */
+  NameBuilder&
+  append(span<const uint8_t> value)
+  {
+    return append(tlv::GenericNameComponent, value);
+  }
+
+  /**
+   * @brief Append a GenericNameComponent whose TLV-VALUE is the null-terminated string @p str.
+   * @note The terminating null character is not included.
+   */
+  NameBuilder&
+  append(const char* str);
+
+  NameBuilder&
+  append(const name::Component& component);
+
+  /**
+   * @brief Append all components of @p name.
+   */
+  NameBuilder&
+  append(const PartialName& name);
+
+  /**
+   * @brief Append a GenericNameComponent with a NonNegativeInteger.
+   * @sa Name::appendNumber()
+   */
+  NameBuilder&
+  appendNumber(uint64_t number);
+
+  /**
+   * @brief Append a GenericNameComponent with a marked number.
+   * @sa Name::appendNumberWithMarker()
+   */
+  NameBuilder&
+  appendNumberWithMarker(uint8_t marker, uint64_t number);
+
+  /**
+   * @brief Append a segment number component, using the current naming convention.
+   * @sa Name::appendSegment()
+   */
+  NameBuilder&
+  appendSegment(uint64_t segmentNo);
+
+  /**
+   * @brief Append a byte offset component, using the current naming convention.
+   * @sa Name::appendByteOffset()
+   */
+  NameBuilder&
+  appendByteOffset(uint64_t offset);
+
+  /**
+   * @brief Append a version component, using the current naming convention.
+   * @param version the version number to append; if nullopt, the current UNIX time
+   *                in milliseconds is used
+   * @sa Name::appendVersion()
+   */
+  NameBuilder&
+  appendVersion(const optional<uint64_t>& version = nullopt);
+
+  /**
+   * @brief Append a timestamp component, using the current naming convention.
+   * @param timestamp the timestamp to append; if nullopt, the current system time is used
+   * @sa Name::appendTimestamp()
+   */
+  NameBuilder&
+  appendTimestamp(const optional<time::system_clock::time_point>& timestamp = nullopt);
+
+  /**
+   * @brief Append a sequence number component, using the current naming convention.
+   * @sa Name::appendSequenceNumber()
+   */
+  NameBuilder&
+  appendSequenceNumber(uint64_t seqNo);
+
+  /**
+   * @brief Append an ImplicitSha256DigestComponent.
+   * @throw name::Component::Error @p digest is not a SHA-256 digest
+   */
+  NameBuilder&
+  appendImplicitSha256Digest(span<const uint8_t> digest)
+  {
+    return append(tlv::ImplicitSha256DigestComponent, digest);
+  }
+
+  /**
+   * @brief Append a ParametersSha256DigestComponent.
+   * @throw name::Component::Error @p digest is not a SHA-256 digest
+   */
+  NameBuilder&
+  appendParametersSha256Digest(span<const uint8_t> digest)
+  {
+    return append(tlv::ParametersSha256DigestComponent, digest);
+  }
+
+private:
+  /**
+   * @brief Prepare the buffer for appending up to @p size octets.
+   * @return where to write the appended octets
+   */
+  uint8_t*
+  prepareAppend(size_t size);
+
+  /**
+   * @brief Account for @p size octets written to the location returned by prepareAppend(),
+   *        containing @p nComponents components, and update TLV-LENGTH of the name.
+   */
+  void
+  commitAppend(size_t size, size_t nComponents = 1);
+
+  NameBuilder&
+  appendComponent(uint32_t type, span<const uint8_t> value);
+
+  NameBuilder&
+  appendNumberComponent(uint32_t type, optional<uint8_t> marker, uint64_t number);
+
+  NameBuilder&
+  appendConventionNumber(uint32_t type, uint8_t marker, uint64_t number);
+
+private:
+  /// shared with the Names returned by build() and with copies of this builder
+  shared_ptr<Buffer> m_buffer;
+  /// capacity to reserve on the first append
+  size_t m_capacity = 0;
+  /// end of the encoded components within m_buffer
+  size_t m_end = 0;
+  /// size of TLV-TYPE and TLV-LENGTH of the name, which end where the components begin
+  size_t m_headerSize = 0;
+  size_t m_nComponents = 0;
+};
+
+} // namespace ndn
+
+#endif // NDN_CXX_NAME_BUILDER_HPP
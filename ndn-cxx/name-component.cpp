@@ -28,7 +28,6 @@
 
 #include <cstdlib>
 #include <cstring>
-#include <sstream>
 
 #include <boost/logic/tribool.hpp>
 
@@ -122,7 +121,7 @@ Component::ensureValid() const
   if (type() < tlv::NameComponentMin || type() > tlv::NameComponentMax) {
     NDN_THROW(Error("TLV-TYPE " + to_string(type()) + " is not a valid NameComponent"));
   }
-  getComponentTypeTable().get(type()).check(*this);
+  getComponentTypeTable().get(type()).check(value_bytes());
 }
 
 Component::Component(uint32_t type)
@@ -159,62 +158,117 @@ Component::Component(const std::string& str)
 {
 }
 
-static Component
-parseUriEscapedValue(uint32_t type, const char* input, size_t len)
-{
-  std::ostringstream oss;
-  unescape(oss, input, len);
-  std::string value = oss.str();
-  if (value.find_first_not_of('.') == std::string::npos) { // all periods
-    if (value.size() < 3) {
+/**
+ * @brief Percent-decode @p input into @p output.
+ *
+ * Invalid or incomplete escape sequences are copied through, like unescape() does.
+ *
+ * @return number of octets written, at most `input.size()`
+ */
+static size_t
+unescapeUri(span<const char> input, uint8_t* output) noexcept
+{
+  uint8_t* out = output;
+  for (auto it = input.begin(); it != input.end(); ++it) {
+    if (*it == '%' && input.end() - it > 2) {
+      int hi = fromHexChar(it[1]);
+      int lo = fromHexChar(it[2]);
+      if (hi < 0 || lo < 0) {
+        std::copy_n(it, 3, out);
+        out += 3;
+      }
+      else {
+        *out++ = static_cast<uint8_t>((hi << 4) | lo);
+      }
+      it += 2;
+    }
+    else {
+      *out++ = static_cast<uint8_t>(*it);
+    }
+  }
+  return static_cast<size_t>(out - output);
+}
+
+/**
+ * @brief Parse `<escaped-value>` of NDN URI syntax, writing the TLV encoding of the component.
+ */
+static size_t
+parseUriEscapedValue(uint32_t type, span<const char> input, uint8_t* output)
+{
+  // decode the value after the largest possible TLV-TYPE and TLV-LENGTH,
+  // then move it in place once its length is known
+  uint8_t* value = output + detail::MAX_COMPONENT_HEADER_SIZE;
+  size_t valueSize = unescapeUri(input, value);
+  if (std::all_of(value, value + valueSize, [] (uint8_t x) { return x == '.'; })) {
+    if (valueSize < 3) {
       NDN_THROW(Component::Error("Illegal URI (name component cannot be . or ..)"));
     }
-    return Component(type, {reinterpret_cast<const uint8_t*>(value.data()), value.size() - 3});
+    valueSize -= 3;
   }
-  return Component(type, {reinterpret_cast<const uint8_t*>(value.data()), value.size()});
+  getComponentTypeTable().get(type).check({value, valueSize});
+
+  size_t headerSize = detail::writeTypeLength(output, type, valueSize);
+  std::memmove(output + headerSize, value, valueSize);
+  return headerSize + valueSize;
 }
 
-Component
-Component::fromEscapedString(const std::string& input)
+size_t
+detail::parseComponentUri(span<const char> input, uint8_t* output)
 {
-  size_t equalPos = input.find('=');
-  if (equalPos == std::string::npos) {
-    return parseUriEscapedValue(tlv::GenericNameComponent, input.data(), input.size());
+  auto equalPos = std::find(input.begin(), input.end(), '=');
+  if (equalPos == input.end()) {
+    return parseUriEscapedValue(tlv::GenericNameComponent, input, output);
   }
 
-  auto typePrefix = input.substr(0, equalPos);
-  auto type = std::strtoul(typePrefix.data(), nullptr, 10);
-  if (type >= tlv::NameComponentMin && type <= tlv::NameComponentMax &&
-      to_string(type) == typePrefix) {
-    size_t valuePos = equalPos + 1;
-    return parseUriEscapedValue(static_cast<uint32_t>(type),
-                                input.data() + valuePos, input.size() - valuePos);
+  auto typePrefix = input.first(static_cast<size_t>(equalPos - input.begin()));
+  auto value = input.subspan(typePrefix.size() + 1);
+  uint64_t type = 0;
+  if (parseDecimal(typePrefix, type) == DecimalStatus::OK &&
+      type >= tlv::NameComponentMin && type <= tlv::NameComponentMax) {
+    return parseUriEscapedValue(static_cast<uint32_t>(type), value, output);
   }
 
-  auto ct = getComponentTypeTable().findByUriPrefix(typePrefix);
+  std::string typePrefixStr(typePrefix.begin(), typePrefix.end());
+  auto ct = getComponentTypeTable().findByUriPrefix(typePrefixStr);
   if (ct == nullptr) {
-    NDN_THROW(Error("Unknown TLV-TYPE '" + typePrefix + "' in NameComponent URI"));
+    NDN_THROW(Component::Error("Unknown TLV-TYPE '" + typePrefixStr + "' in NameComponent URI"));
   }
-  return ct->parseAltUriValue(input.substr(equalPos + 1));
+  return ct->parseAltUriValue(value, output);
+}
+
+Component
+Component::fromEscapedString(const std::string& input)
+{
+  auto buffer = make_shared<Buffer>(input.size() + detail::MAX_COMPONENT_HEADER_SIZE);
+  buffer->resize(detail::parseComponentUri(input, buffer->data()));
+  return Component(Block(std::move(buffer)));
 }
 
 void
-Component::toUri(std::ostream& os, UriFormat format) const
+detail::writeComponentUri(UriWriter& out, const Component& comp, UriFormat format)
 {
   if (wantAltUri(format)) {
-    getComponentTypeTable().get(type()).writeUri(os, *this);
+    getComponentTypeTable().get(comp.type()).writeUri(out, comp);
   }
   else {
-    ComponentType().writeUri(os, *this);
+    ComponentType().writeUri(out, comp);
   }
 }
 
+void
+Component::toUri(std::ostream& os, UriFormat format) const
+{
+  UriWriter out(os);
+  detail::writeComponentUri(out, *this, format);
+}
+
 std::string
 Component::toUri(UriFormat format) const
 {
-  std::ostringstream os;
-  toUri(os, format);
-  return os.str();
+  std::string uri;
+  UriWriter out(uri);
+  detail::writeComponentUri(out, *this, format);
+  return uri;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -26,9 +26,10 @@
 #include "ndn-cxx/name.hpp"
 #include "ndn-cxx/encoding/block.hpp"
 #include "ndn-cxx/encoding/encoding-buffer.hpp"
+#include "ndn-cxx/impl/name-uri.hpp"
 #include "ndn-cxx/util/time.hpp"
 
-#include <sstream>
+#include <cstring>
 #include <boost/functional/hash.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/concepts.hpp>
@@ -51,6 +52,56 @@ const size_t Name::npos = std::numeric_limits<size_t>::max();
 
 // ---- constructors, encoding, decoding ----
 
+static Block
+parseUri(const char* begin, const char* end)
+{
+  // Omit the leading protocol such as ndn:, if the colon comes before any '/'
+  auto colon = std::find(begin, end, ':');
+  if (colon != end && std::find(begin, colon, '/') == colon) {
+    begin = colon + 1;
+  }
+
+  // Trim the leading slash and possibly the authority.
+  if (begin != end && *begin == '/') {
+    if (end - begin >= 2 && begin[1] == '/') {
+      // Strip the authority following "//".
+      begin = std::find(begin + 2, end, '/');
+      if (begin == end) {
+        // Unusual case: there was only an authority.
+        return Block(tlv::Name);
+      }
+    }
+    ++begin;
+  }
+
+  if (begin == end) {
+    return Block(tlv::Name);
+  }
+
+  // Encode all components into a single buffer that is large enough for any input, leaving room
+  // for the TLV-TYPE and TLV-LENGTH of the Name, which are written last in front of the components.
+  const size_t maxHeaderSize = 10;
+  auto nComponents = static_cast<size_t>(std::count(begin, end, '/')) + 1;
+  auto buffer = make_shared<Buffer>(maxHeaderSize + static_cast<size_t>(end - begin) +
+                                    nComponents * name::detail::MAX_COMPONENT_HEADER_SIZE);
+  uint8_t* const valueBegin = buffer->data() + maxHeaderSize;
+  uint8_t* valueEnd = valueBegin;
+
+  while (begin < end) {
+    auto componentEnd = std::find(begin, end, '/');
+    valueEnd += name::detail::parseComponentUri({begin, componentEnd}, valueEnd);
+    begin = componentEnd + 1;
+  }
+
+  size_t valueSize = static_cast<size_t>(valueEnd - valueBegin);
+  size_t headerSize = tlv::sizeOfVarNumber(tlv::Name) + tlv::sizeOfVarNumber(valueSize);
+  name::detail::writeTypeLength(valueBegin - headerSize, tlv::Name, valueSize);
+
+  auto wireBegin = buffer->cbegin() + (maxHeaderSize - headerSize);
+  auto wireEnd = buffer->cbegin() + (valueEnd - buffer->data());
+  return Block(std::move(buffer), wireBegin, wireEnd);
+}
+
 Name::Name()
   : m_wire(tlv::Name)
 {
@@ -63,53 +114,15 @@ Name::Name(const Block& wire)
 }
 
 Name::Name(const char* uri)
-  : Name(std::string(uri))
+  : m_wire(parseUri(uri, uri + std::strlen(uri)))
 {
+  m_wire.parse();
 }
 
-Name::Name(std::string uri)
+Name::Name(const std::string& uri)
+  : m_wire(parseUri(uri.data(), uri.data() + uri.size()))
 {
-  if (uri.empty())
-    return;
-
-  size_t iColon = uri.find(':');
-  if (iColon != std::string::npos) {
-    // Make sure the colon came before a '/'.
-    size_t iFirstSlash = uri.find('/');
-    if (iFirstSlash == std::string::npos || iColon < iFirstSlash) {
-      // Omit the leading protocol such as ndn:
-      uri.erase(0, iColon + 1);
-    }
-  }
-
-  // Trim the leading slash and possibly the authority.
-  if (uri[0] == '/') {
-    if (uri.size() >= 2 && uri[1] == '/') {
-      // Strip the authority following "//".
-      size_t iAfterAuthority = uri.find('/', 2);
-      if (iAfterAuthority == std::string::npos)
-        // Unusual case: there was only an authority.
-        return;
-      else {
-        uri.erase(0, iAfterAuthority + 1);
-      }
-    }
-    else {
-      uri.erase(0, 1);
-    }
-  }
-
-  size_t iComponentStart = 0;
-
-  // Unescape the components.
-  while (iComponentStart < uri.size()) {
-    size_t iComponentEnd = uri.find('/', iComponentStart);
-    if (iComponentEnd == std::string::npos)
-      iComponentEnd = uri.size();
-
-    append(Component::fromEscapedString(&uri[0], iComponentStart, iComponentEnd));
-    iComponentStart = iComponentEnd + 1;
-  }
+  m_wire.parse();
 }
 
 template<encoding::Tag TAG>
@@ -345,26 +358,48 @@ Name::compare(size_t pos1, size_t count1, const Name& other, size_t pos2, size_t
 
 // ---- URI representation ----
 
-void
-Name::toUri(std::ostream& os, name::UriFormat format) const
+static void
+writeNameUri(name::detail::UriWriter& out, const Name& name, name::UriFormat format)
 {
-  if (empty()) {
-    os << "/";
+  if (name.empty()) {
+    out.put('/');
     return;
   }
 
-  for (const auto& component : *this) {
-    os << "/";
-    component.toUri(os, format);
+  for (const auto& component : name) {
+    out.put('/');
+    name::detail::writeComponentUri(out, component, format);
   }
 }
 
+void
+Name::toUri(std::ostream& os, name::UriFormat format) const
+{
+  name::detail::UriWriter out(os);
+  writeNameUri(out, *this, format);
+}
+
 std::string
 Name::toUri(name::UriFormat format) const
 {
-  std::ostringstream os;
-  toUri(os, format);
-  return os.str();
+  std::string uri;
+  toUri(uri, format);
+  return uri;
+}
+
+void
+Name::toUri(std::string& output, name::UriFormat format) const
+{
+  name::detail::UriWriter out(output);
+  writeNameUri(out, *this, format);
+}
+
+size_t
+Name::toUri(span<char> output, name::UriFormat format) const
+{
+  name::detail::UriWriter out(output);
+  writeNameUri(out, *this, format);
+  return out.size();
 }
 
 std::istream&
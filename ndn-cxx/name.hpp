@@ -82,15 +82,19 @@ public: // constructors, encoding, decoding
 
   /** @brief Parse name from NDN URI.
    *  @param uri a null-terminated URI string
+   *  @throw name::Component::Error a URI component does not represent a valid name component
    *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/name.html#ndn-uri-scheme
    */
   Name(const char* uri);
 
   /** @brief Create name from NDN URI.
    *  @param uri a URI string
+   *  @throw name::Component::Error a URI component does not represent a valid name component
    *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/name.html#ndn-uri-scheme
+   *
+   *  All components are decoded in a single pass directly into one wire encoding buffer.
    */
-  Name(std::string uri);
+  Name(const std::string& uri);
 
   /** @brief Write URI representation of the name to the output stream.
    *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/name.html#ndn-uri-scheme
@@ -106,6 +110,25 @@ public: // constructors, encoding, decoding
   std::string
   toUri(name::UriFormat format = name::UriFormat::DEFAULT) const;
 
+  /** @brief Append URI representation of the name to @p output.
+   *
+   *  Unlike the overload that returns a new string, this allows reusing the capacity of an
+   *  existing string, e.g., when formatting log messages.
+   *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/name.html#ndn-uri-scheme
+   */
+  void
+  toUri(std::string& output, name::UriFormat format = name::UriFormat::DEFAULT) const;
+
+  /** @brief Write URI representation of the name into the character buffer @p output.
+   *
+   *  At most `output.size()` characters are written, and no terminating null character is added.
+   *  @return the length of the complete URI representation; if it is greater than
+   *          `output.size()`, the URI has been truncated
+   *  @sa https://named-data.net/doc/NDN-packet-spec/0.3/name.html#ndn-uri-scheme
+   */
+  size_t
+  toUri(span<char> output, name::UriFormat format = name::UriFormat::DEFAULT) const;
+
   /** @brief Check if this instance already has wire encoding.
    */
   bool
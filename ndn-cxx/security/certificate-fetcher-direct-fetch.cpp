@@ -49,23 +49,18 @@ CertificateFetcherDirectFetch::doFetch(const shared_ptr<CertificateRequest>& key
   uint64_t incomingFaceId = 0;
   auto interestState = dynamic_pointer_cast<InterestValidationState>(state);
   if (interestState != nullptr) {
-    auto incomingFaceIdTag = interestState->getOriginalInterest().getTag<lp::IncomingFaceIdTag>();
-    if (incomingFaceIdTag != nullptr) {
-      incomingFaceId = incomingFaceIdTag->get();
-    }
+    incomingFaceId = interestState->getOriginalInterest()
+                     .getTagValue<lp::IncomingFaceIdTag>().value_or(0);
   }
   else {
     auto dataState = dynamic_pointer_cast<DataValidationState>(state);
-    auto incomingFaceIdTag = dataState->getOriginalData().getTag<lp::IncomingFaceIdTag>();
-    if (incomingFaceIdTag != nullptr) {
-      incomingFaceId = incomingFaceIdTag->get();
-    }
+    incomingFaceId = dataState->getOriginalData().getTagValue<lp::IncomingFaceIdTag>().value_or(0);
   }
 
   if (incomingFaceId != 0) {
     Interest directInterest(keyRequest->interest);
     directInterest.refreshNonce();
-    directInterest.setTag(make_shared<lp::NextHopFaceIdTag>(incomingFaceId));
+    directInterest.setTagValue<lp::NextHopFaceIdTag>(incomingFaceId);
 
     if (!m_wantDirectInterestOnly) {
       // disable callbacks
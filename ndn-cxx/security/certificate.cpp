@@ -27,6 +27,8 @@
 #include "ndn-cxx/security/transform.hpp"
 #include "ndn-cxx/util/indented-stream.hpp"
 
+#include <mutex>
+
 namespace ndn {
 namespace security {
 inline namespace v2 {
@@ -36,6 +38,12 @@ BOOST_CONCEPT_ASSERT((WireDecodable<Certificate>));
 static_assert(std::is_base_of<Data::Error, Certificate::Error>::value,
               "Certificate::Error must inherit from Data::Error");
 
+struct Certificate::KeyCache
+{
+  std::once_flag loaded;
+  shared_ptr<const transform::PublicKey> key;
+};
+
 // /<IdentityName>/KEY/<KeyId>/<IssuerId>/<Version>
 const ssize_t Certificate::VERSION_OFFSET = -1;
 const ssize_t Certificate::ISSUER_ID_OFFSET = -2;
@@ -64,6 +72,8 @@ Certificate::Certificate(Data&& data)
   if (getFreshnessPeriod() <= 0_ms) {
     NDN_THROW(Error("Certificate FreshnessPeriod cannot be zero"));
   }
+
+  decodeFields();
 }
 
 Certificate::Certificate(const Data& data)
@@ -76,15 +86,41 @@ Certificate::Certificate(const Block& block)
 {
 }
 
+void
+Certificate::decodeFields()
+{
+  if (!hasWire()) {
+    return;
+  }
+
+  m_decodedWire = wireEncode();
+  m_identity = getName().getPrefix(KEY_COMPONENT_OFFSET);
+  m_keyName = getName().getPrefix(KEY_ID_OFFSET + 1);
+  m_keyCache = make_shared<KeyCache>();
+  try {
+    auto period = getSignatureInfo().getValidityPeriod().getPeriod();
+    m_validity.emplace(period.first, period.second);
+  }
+  catch (const tlv::Error&) {
+    // the error is reported on access, from the uncached code path
+  }
+}
+
 Name
 Certificate::getIdentity() const
 {
+  if (hasDecodedFields()) {
+    return m_identity;
+  }
   return getName().getPrefix(KEY_COMPONENT_OFFSET);
 }
 
 Name
 Certificate::getKeyName() const
 {
+  if (hasDecodedFields()) {
+    return m_keyName;
+  }
   return getName().getPrefix(KEY_ID_OFFSET + 1);
 }
 
@@ -100,15 +136,48 @@ Certificate::getIssuerId() const
   return getName().at(ISSUER_ID_OFFSET);
 }
 
+static shared_ptr<const transform::PublicKey>
+loadPublicKey(span<const uint8_t> der)
+{
+  auto key = make_shared<transform::PublicKey>();
+  try {
+    key->loadPkcs8(der);
+  }
+  catch (const transform::Error&) {
+    return nullptr;
+  }
+  catch (const transform::PublicKey::Error&) {
+    return nullptr;
+  }
+  return key;
+}
+
+shared_ptr<const transform::PublicKey>
+Certificate::getLoadedPublicKey() const
+{
+  if (!hasDecodedFields()) {
+    return loadPublicKey(getPublicKey());
+  }
+
+  std::call_once(m_keyCache->loaded, [this] { m_keyCache->key = loadPublicKey(getPublicKey()); });
+  return m_keyCache->key;
+}
+
 ValidityPeriod
 Certificate::getValidityPeriod() const
 {
+  if (hasDecodedFields() && m_validity) {
+    return ValidityPeriod(m_validity->first, m_validity->second);
+  }
   return getSignatureInfo().getValidityPeriod();
 }
 
 bool
 Certificate::isValid(const time::system_clock::TimePoint& ts) const
 {
+  if (hasDecodedFields() && m_validity) {
+    return m_validity->first <= ts && ts <= m_validity->second;
+  }
   return getSignatureInfo().getValidityPeriod().isValid(ts);
 }
 
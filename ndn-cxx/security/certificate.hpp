@@ -29,6 +29,11 @@
 
 namespace ndn {
 namespace security {
+
+namespace transform {
+class PublicKey;
+} // namespace transform
+
 inline namespace v2 {
 
 /**
@@ -122,6 +127,17 @@ public:
     return getContent().value_bytes();
   }
 
+  /**
+   * @brief Return the public key loaded for signature verification.
+   *
+   * The key is loaded on first use and shared by all copies of the certificate, so that
+   * repeated verifications reuse its verification contexts. This function is thread-safe.
+   *
+   * @return the key, or nullptr if it cannot be loaded
+   */
+  shared_ptr<const transform::PublicKey>
+  getLoadedPublicKey() const;
+
   /**
    * @brief Get validity period of the certificate
    */
@@ -158,6 +174,35 @@ public:
   static const size_t MIN_KEY_NAME_LENGTH;
   static const name::Component KEY_COMPONENT;
   static const name::Component DEFAULT_ISSUER_ID;
+
+private:
+  /**
+   * @brief Decode the frequently accessed fields from the current wire encoding.
+   */
+  void
+  decodeFields();
+
+  /**
+   * @brief Check whether the fields decoded at construction still reflect the packet.
+   *
+   * The Data setters are not virtual, so modifications made through them cannot be intercepted.
+   * They do however discard the wire encoding, which is detected here.
+   */
+  bool
+  hasDecodedFields() const noexcept
+  {
+    return hasWire() && m_decodedWire.hasWire() && wireEncode().data() == m_decodedWire.data();
+  }
+
+private:
+  Block m_decodedWire; ///< wire encoding from which the fields below were decoded
+  Name m_identity;
+  Name m_keyName;
+  /// [NotBefore, NotAfter], or nullopt if ValidityPeriod is missing or malformed
+  optional<std::pair<time::system_clock::TimePoint, time::system_clock::TimePoint>> m_validity;
+  struct KeyCache;
+  /// public key loaded from m_decodedWire, shared with copies of the certificate
+  shared_ptr<KeyCache> m_keyCache;
 };
 
 std::ostream&
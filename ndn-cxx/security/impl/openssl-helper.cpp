@@ -62,6 +62,19 @@ getEvpPkeyType(const EVP_PKEY* key)
   return EVP_PKEY_base_id(key);
 }
 
+span<const uint8_t>
+joinInputBuffers(const InputBuffers& bufs, Buffer& storage)
+{
+  if (bufs.size() == 1)
+    return bufs.front();
+
+  storage.clear();
+  for (const auto& buf : bufs) {
+    storage.insert(storage.end(), buf.begin(), buf.end());
+  }
+  return storage;
+}
+
 EvpMdCtx::EvpMdCtx()
   : m_ctx(EVP_MD_CTX_new())
 {
@@ -74,6 +87,18 @@ EvpMdCtx::~EvpMdCtx()
   EVP_MD_CTX_free(m_ctx);
 }
 
+EvpCipherCtx::EvpCipherCtx()
+  : m_ctx(EVP_CIPHER_CTX_new())
+{
+  if (m_ctx == nullptr)
+    NDN_THROW(std::runtime_error("EVP_CIPHER_CTX creation failed"));
+}
+
+EvpCipherCtx::~EvpCipherCtx()
+{
+  EVP_CIPHER_CTX_free(m_ctx);
+}
+
 EvpPkeyCtx::EvpPkeyCtx(EVP_PKEY* key)
   : m_ctx(EVP_PKEY_CTX_new(key, nullptr))
 {
@@ -23,6 +23,7 @@
 #define NDN_CXX_SECURITY_IMPL_OPENSSL_HELPER_HPP
 
 #include "ndn-cxx/security/security-common.hpp"
+#include "ndn-cxx/encoding/buffer.hpp"
 
 #include <openssl/bio.h>
 #include <openssl/evp.h>
@@ -37,6 +38,14 @@ digestAlgorithmToEvpMd(DigestAlgorithm algo);
 NDN_CXX_NODISCARD int
 getEvpPkeyType(const EVP_PKEY* key);
 
+/**
+ * @brief Return the concatenation of @p bufs, using @p storage only if there is more than one.
+ *
+ * This is needed by one-shot algorithms such as Ed25519, which cannot process input in parts.
+ */
+span<const uint8_t>
+joinInputBuffers(const InputBuffers& bufs, Buffer& storage);
+
 class EvpMdCtx : noncopyable
 {
 public:
@@ -53,6 +62,22 @@ private:
   EVP_MD_CTX* m_ctx;
 };
 
+class EvpCipherCtx : noncopyable
+{
+public:
+  EvpCipherCtx();
+
+  ~EvpCipherCtx();
+
+  operator EVP_CIPHER_CTX*() const
+  {
+    return m_ctx;
+  }
+
+private:
+  EVP_CIPHER_CTX* m_ctx;
+};
+
 class EvpPkeyCtx : noncopyable
 {
 public:
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/detail/probes.hpp"
 #include "ndn-cxx/security/signing-helpers.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 
@@ -402,6 +403,8 @@ KeyChain::importPrivateKey(const Name& keyName, shared_ptr<transform::PrivateKey
 void
 KeyChain::sign(Data& data, const SigningInfo& params)
 {
+  auto startTime = NDN_CXX_PROBE_ENABLED(keychain_sign) ? time::steady_clock::now()
+                                                         : time::steady_clock::time_point();
   Name keyName;
   SignatureInfo sigInfo;
   std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
@@ -413,11 +416,16 @@ KeyChain::sign(Data& data, const SigningInfo& params)
 
   auto sigValue = sign({encoder}, keyName, params.getDigestAlgorithm());
   data.wireEncode(encoder, *sigValue);
+
+  NDN_CXX_PROBE(keychain_sign, std::hash<Name>()(data.getName()), 'D', data.wireEncode().size(),
+                time::duration_cast<time::nanoseconds>(time::steady_clock::now() - startTime).count());
 }
 
 void
 KeyChain::sign(Interest& interest, const SigningInfo& params)
 {
+  auto startTime = NDN_CXX_PROBE_ENABLED(keychain_sign) ? time::steady_clock::now()
+                                                         : time::steady_clock::time_point();
   Name keyName;
   SignatureInfo sigInfo;
   std::tie(keyName, sigInfo) = prepareSignatureInfo(params);
@@ -443,6 +451,9 @@ KeyChain::sign(Interest& interest, const SigningInfo& params)
 
     interest.setName(signedName);
   }
+
+  NDN_CXX_PROBE(keychain_sign, std::hash<Name>()(interest.getName()), 'I', interest.wireEncode().size(),
+                time::duration_cast<time::nanoseconds>(time::steady_clock::now() - startTime).count());
 }
 
 Certificate
@@ -785,6 +796,8 @@ KeyChain::getSignatureType(KeyType keyType, DigestAlgorithm)
     return tlv::SignatureSha256WithRsa;
   case KeyType::EC:
     return tlv::SignatureSha256WithEcdsa;
+  case KeyType::ED25519:
+    return tlv::SignatureEd25519;
   case KeyType::HMAC:
     return tlv::SignatureHmacWithSha256;
   default:
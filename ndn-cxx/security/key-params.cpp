@@ -47,6 +47,7 @@ const uint32_t MAX_RSA_KEY_SIZE = 16384;
 const uint32_t DEFAULT_RSA_KEY_SIZE = 2048;
 const uint32_t EC_KEY_SIZES[] = {224, 256, 384, 521};
 const uint32_t DEFAULT_EC_KEY_SIZE = 256;
+const uint32_t ED25519_KEY_SIZE = 256;
 const uint32_t AES_KEY_SIZES[] = {128, 192, 256};
 const uint32_t DEFAULT_AES_KEY_SIZE = 128;
 const uint32_t DEFAULT_HMAC_KEY_SIZE = 256;
@@ -81,6 +82,20 @@ EcKeyParamsInfo::getDefaultSize()
   return DEFAULT_EC_KEY_SIZE;
 }
 
+uint32_t
+Ed25519KeyParamsInfo::checkKeySize(uint32_t size)
+{
+  if (size != ED25519_KEY_SIZE)
+    NDN_THROW(KeyParams::Error("Unsupported Ed25519 key size " + to_string(size)));
+  return size;
+}
+
+uint32_t
+Ed25519KeyParamsInfo::getDefaultSize()
+{
+  return ED25519_KEY_SIZE;
+}
+
 uint32_t
 AesKeyParamsInfo::checkKeySize(uint32_t size)
 {
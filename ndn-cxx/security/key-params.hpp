@@ -141,6 +141,30 @@ public:
   getDefaultSize();
 };
 
+/// @brief Ed25519KeyParamsInfo is used to instantiate SimplePublicKeyParams for Ed25519 keys.
+class Ed25519KeyParamsInfo
+{
+public:
+  static constexpr KeyType
+  getType()
+  {
+    return KeyType::ED25519;
+  }
+
+  /**
+   * @brief Check if @p size is valid and supported for this key type.
+   *
+   * Ed25519 keys always have a size of 256 bits.
+   *
+   * @throw KeyParams::Error if the key size is not supported.
+   */
+  static uint32_t
+  checkKeySize(uint32_t size);
+
+  static uint32_t
+  getDefaultSize();
+};
+
 } // namespace detail
 
 
@@ -201,6 +225,9 @@ typedef SimplePublicKeyParams<detail::RsaKeyParamsInfo> RsaKeyParams;
 /// @brief EcKeyParams carries parameters for EC key.
 typedef SimplePublicKeyParams<detail::EcKeyParamsInfo> EcKeyParams;
 
+/// @brief Ed25519KeyParams carries parameters for Ed25519 key.
+typedef SimplePublicKeyParams<detail::Ed25519KeyParamsInfo> Ed25519KeyParams;
+
 
 namespace detail {
 
@@ -53,6 +53,8 @@ operator<<(std::ostream& os, KeyType keyType)
       return os << "AES";
     case KeyType::HMAC:
       return os << "HMAC";
+    case KeyType::ED25519:
+      return os << "Ed25519";
   }
   return os << to_underlying(keyType);
 }
@@ -99,6 +101,20 @@ operator<<(std::ostream& os, BlockCipherAlgorithm algorithm)
   return os << to_underlying(algorithm);
 }
 
+std::ostream&
+operator<<(std::ostream& os, AeadAlgorithm algorithm)
+{
+  switch (algorithm) {
+    case AeadAlgorithm::NONE:
+      return os << "NONE";
+    case AeadAlgorithm::AES_GCM:
+      return os << "AES-GCM";
+    case AeadAlgorithm::CHACHA20_POLY1305:
+      return os << "ChaCha20-Poly1305";
+  }
+  return os << to_underlying(algorithm);
+}
+
 std::ostream&
 operator<<(std::ostream& os, CipherOperator op)
 {
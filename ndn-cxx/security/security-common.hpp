@@ -98,6 +98,7 @@ enum class KeyType {
   EC,       ///< Elliptic Curve key (e.g. for ECDSA), supports sign/verify operations
   AES,      ///< AES key, supports encrypt/decrypt operations
   HMAC,     ///< HMAC key, supports sign/verify operations
+  ED25519,  ///< Ed25519 key, supports sign/verify operations
 };
 
 std::ostream&
@@ -128,6 +129,18 @@ enum class BlockCipherAlgorithm {
 std::ostream&
 operator<<(std::ostream& os, BlockCipherAlgorithm algorithm);
 
+/**
+ * @brief Authenticated encryption with associated data (AEAD) algorithms.
+ */
+enum class AeadAlgorithm {
+  NONE,
+  AES_GCM,           ///< AES in Galois/Counter Mode, with a 128-, 192-, or 256-bit key
+  CHACHA20_POLY1305, ///< ChaCha20-Poly1305 as specified in RFC 8439
+};
+
+std::ostream&
+operator<<(std::ostream& os, AeadAlgorithm algorithm);
+
 enum class CipherOperator {
   DECRYPT,
   ENCRYPT,
@@ -130,6 +130,7 @@ BackEndFile::doCreateKey(const Name& identityName, const KeyParams& params)
   switch (params.getKeyType()) {
   case KeyType::RSA:
   case KeyType::EC:
+  case KeyType::ED25519:
     break;
   default:
     NDN_THROW(std::invalid_argument("File-based TPM does not support creating a key of type " +
@@ -75,6 +75,7 @@ BackEndMem::doCreateKey(const Name& identityName, const KeyParams& params)
   switch (params.getKeyType()) {
   case KeyType::RSA:
   case KeyType::EC:
+  case KeyType::ED25519:
   case KeyType::HMAC:
     break;
   default:
@@ -20,13 +20,7 @@
  */
 
 #include "ndn-cxx/security/tpm/impl/key-handle-mem.hpp"
-#include "ndn-cxx/security/transform/bool-sink.hpp"
-#include "ndn-cxx/security/transform/buffer-source.hpp"
 #include "ndn-cxx/security/transform/private-key.hpp"
-#include "ndn-cxx/security/transform/signer-filter.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
-#include "ndn-cxx/security/transform/verifier-filter.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
 
 namespace ndn {
 namespace security {
@@ -41,23 +35,21 @@ KeyHandleMem::KeyHandleMem(shared_ptr<transform::PrivateKey> key)
 ConstBufferPtr
 KeyHandleMem::doSign(DigestAlgorithm digestAlgo, const InputBuffers& bufs) const
 {
-  using namespace transform;
+  return m_key->sign(digestAlgo, bufs);
+}
 
-  OBufferStream sigOs;
-  bufferSource(bufs) >> signerFilter(digestAlgo, *m_key) >> streamSink(sigOs);
-  return sigOs.buf();
+size_t
+KeyHandleMem::doSignInto(DigestAlgorithm digestAlgo, const InputBuffers& bufs,
+                         span<uint8_t> sig) const
+{
+  return m_key->sign(digestAlgo, bufs, sig);
 }
 
 bool
 KeyHandleMem::doVerify(DigestAlgorithm digestAlgo, const InputBuffers& bufs,
                        span<const uint8_t> sig) const
 {
-  using namespace transform;
-
-  bool result = false;
-  bufferSource(bufs) >> verifierFilter(digestAlgo, *m_key, sig)
-                     >> boolSink(result);
-  return result;
+  return m_key->verify(digestAlgo, bufs, sig);
 }
 
 ConstBufferPtr
@@ -46,6 +46,9 @@ private:
   ConstBufferPtr
   doSign(DigestAlgorithm digestAlgo, const InputBuffers& bufs) const final;
 
+  size_t
+  doSignInto(DigestAlgorithm digestAlgo, const InputBuffers& bufs, span<uint8_t> sig) const final;
+
   bool
   doVerify(DigestAlgorithm digestAlgo, const InputBuffers& bufs, span<const uint8_t> sig) const final;
 
@@ -33,6 +33,12 @@ KeyHandle::sign(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs) const
   return doSign(digestAlgorithm, bufs);
 }
 
+size_t
+KeyHandle::sign(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs, span<uint8_t> sig) const
+{
+  return doSignInto(digestAlgorithm, bufs, sig);
+}
+
 bool
 KeyHandle::verify(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs,
                   span<const uint8_t> sig) const
@@ -52,6 +58,19 @@ KeyHandle::derivePublicKey() const
   return doDerivePublicKey();
 }
 
+size_t
+KeyHandle::doSignInto(DigestAlgorithm digestAlgo, const InputBuffers& bufs, span<uint8_t> sig) const
+{
+  auto result = doSign(digestAlgo, bufs);
+  if (result == nullptr)
+    NDN_THROW(Error("Failed to sign with key " + m_keyName.toUri()));
+  if (result->size() > sig.size())
+    NDN_THROW(Error("Signature buffer is too small"));
+
+  std::copy(result->begin(), result->end(), sig.begin());
+  return result->size();
+}
+
 } // namespace tpm
 } // namespace security
 } // namespace ndn
@@ -53,6 +53,15 @@ public:
   ConstBufferPtr
   sign(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs) const;
 
+  /**
+   * @brief Generate a digital signature for @p bufs using this key with @p digestAlgorithm,
+   *        writing it into the caller-provided @p sig.
+   * @return Size of the signature written into @p sig.
+   * @throw Error @p sig is too small for the signature.
+   */
+  size_t
+  sign(DigestAlgorithm digestAlgorithm, const InputBuffers& bufs, span<uint8_t> sig) const;
+
   /**
    * @brief Verify the signature @p sig over @p bufs using this key and @p digestAlgorithm.
    */
@@ -87,6 +96,14 @@ private:
   virtual ConstBufferPtr
   doSign(DigestAlgorithm digestAlgo, const InputBuffers& bufs) const = 0;
 
+  /**
+   * @brief Sign into caller-provided storage.
+   *
+   * The default implementation copies the signature returned by doSign().
+   */
+  virtual size_t
+  doSignInto(DigestAlgorithm digestAlgo, const InputBuffers& bufs, span<uint8_t> sig) const;
+
   virtual bool
   doVerify(DigestAlgorithm digestAlgo, const InputBuffers& bufs, span<const uint8_t> sig) const = 0;
 
@@ -35,6 +35,7 @@
 #include "ndn-cxx/security/transform/hex-encode.hpp"
 #include "ndn-cxx/security/transform/strip-space.hpp"
 
+#include "ndn-cxx/security/transform/aead-filter.hpp"
 #include "ndn-cxx/security/transform/block-cipher.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/private-key.hpp"
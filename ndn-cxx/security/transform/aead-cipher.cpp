@@ -0,0 +1,220 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/transform/aead-cipher.hpp"
+#include "ndn-cxx/security/impl/openssl-helper.hpp"
+
+#include <openssl/crypto.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <limits>
+
+namespace ndn {
+namespace security {
+namespace transform {
+
+static const EVP_CIPHER*
+getEvpCipher(AeadAlgorithm algo, size_t keySize)
+{
+  switch (algo) {
+  case AeadAlgorithm::AES_GCM:
+    switch (keySize) {
+    case 16:
+      return EVP_aes_128_gcm();
+    case 24:
+      return EVP_aes_192_gcm();
+    case 32:
+      return EVP_aes_256_gcm();
+    }
+    break;
+#if !defined(OPENSSL_NO_CHACHA) && !defined(OPENSSL_NO_POLY1305)
+  case AeadAlgorithm::CHACHA20_POLY1305:
+    if (keySize == 32)
+      return EVP_chacha20_poly1305();
+    break;
+#endif
+  default:
+    NDN_THROW(AeadCipher::Error("Unsupported AEAD algorithm " + boost::lexical_cast<std::string>(algo)));
+  }
+  NDN_THROW(AeadCipher::Error("Unsupported key length " + to_string(keySize) + " for " +
+                              boost::lexical_cast<std::string>(algo)));
+}
+
+/**
+ * @brief Pass @p in through the cipher into @p out, or as associated data if @p out is nullptr.
+ */
+static bool
+cipherUpdate(EVP_CIPHER_CTX* ctx, uint8_t* out, span<const uint8_t> in)
+{
+  constexpr size_t maxChunk = std::numeric_limits<int>::max() & ~size_t(0xff);
+  while (!in.empty()) {
+    size_t chunkSize = std::min(in.size(), maxChunk);
+    int outLen = 0;
+    if (EVP_CipherUpdate(ctx, out, &outLen, in.data(), static_cast<int>(chunkSize)) != 1)
+      return false;
+    if (out != nullptr) {
+      out += outLen;
+    }
+    in = in.subspan(chunkSize);
+  }
+  return true;
+}
+
+constexpr size_t AeadCipher::NONCE_SIZE;
+constexpr size_t AeadCipher::TAG_SIZE;
+
+class AeadCipher::Impl
+{
+public:
+  void
+  checkSizes(span<const uint8_t> nonce, size_t inSize, size_t outSize, size_t tagSize) const
+  {
+    if (nonce.size() != NONCE_SIZE)
+      NDN_THROW(Error("Nonce length must be " + to_string(NONCE_SIZE)));
+    if (outSize != inSize)
+      NDN_THROW(Error("Output length must be equal to input length"));
+    if (tagSize != TAG_SIZE)
+      NDN_THROW(Error("Tag length must be " + to_string(TAG_SIZE)));
+  }
+
+public:
+  AeadAlgorithm algo;
+  /// contexts initialized with the key, re-initialized with a new nonce for each operation
+  detail::EvpCipherCtx encCtx;
+  detail::EvpCipherCtx decCtx;
+};
+
+AeadCipher::AeadCipher(AeadAlgorithm algo, span<const uint8_t> key)
+  : m_impl(make_unique<Impl>())
+{
+  const EVP_CIPHER* cipher = getEvpCipher(algo, key.size());
+  m_impl->algo = algo;
+
+  if (EVP_EncryptInit_ex(m_impl->encCtx, cipher, nullptr, key.data(), nullptr) != 1 ||
+      EVP_DecryptInit_ex(m_impl->decCtx, cipher, nullptr, key.data(), nullptr) != 1)
+    NDN_THROW(Error("Failed to initialize " + boost::lexical_cast<std::string>(algo) + " cipher"));
+}
+
+AeadCipher::~AeadCipher() = default;
+
+AeadAlgorithm
+AeadCipher::getAlgorithm() const
+{
+  return m_impl->algo;
+}
+
+void
+AeadCipher::encrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> plaintext,
+                    span<uint8_t> ciphertext, span<uint8_t> tag)
+{
+  m_impl->checkSizes(nonce, plaintext.size(), ciphertext.size(), tag.size());
+
+  EVP_CIPHER_CTX* ctx = m_impl->encCtx;
+  if (EVP_EncryptInit_ex(ctx, nullptr, nullptr, nullptr, nonce.data()) != 1)
+    NDN_THROW(Error("Failed to set nonce"));
+
+  if (!cipherUpdate(ctx, nullptr, aad) || !cipherUpdate(ctx, ciphertext.data(), plaintext))
+    NDN_THROW(Error("Failed to encrypt"));
+
+  // neither AEAD mode buffers input, so there is no output from the final step
+  int outLen = 0;
+  if (EVP_EncryptFinal_ex(ctx, ciphertext.data() + ciphertext.size(), &outLen) != 1 ||
+      EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_GET_TAG, static_cast<int>(TAG_SIZE), tag.data()) != 1)
+    NDN_THROW(Error("Failed to finalize encryption"));
+  BOOST_ASSERT(outLen == 0);
+}
+
+ConstBufferPtr
+AeadCipher::encrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> plaintext)
+{
+  auto sealed = make_shared<Buffer>(plaintext.size() + TAG_SIZE);
+  auto out = make_span(*sealed);
+  encrypt(nonce, aad, plaintext, out.first(plaintext.size()), out.last(TAG_SIZE));
+  return sealed;
+}
+
+bool
+AeadCipher::decrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> ciphertext,
+                    span<const uint8_t> tag, span<uint8_t> plaintext)
+{
+  m_impl->checkSizes(nonce, ciphertext.size(), plaintext.size(), tag.size());
+
+  EVP_CIPHER_CTX* ctx = m_impl->decCtx;
+  if (EVP_DecryptInit_ex(ctx, nullptr, nullptr, nullptr, nonce.data()) != 1 ||
+      EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_SET_TAG, static_cast<int>(TAG_SIZE),
+                          const_cast<uint8_t*>(tag.data())) != 1)
+    NDN_THROW(Error("Failed to set nonce and tag"));
+
+  if (!cipherUpdate(ctx, nullptr, aad) || !cipherUpdate(ctx, plaintext.data(), ciphertext))
+    NDN_THROW(Error("Failed to decrypt"));
+
+  int outLen = 0;
+  if (EVP_DecryptFinal_ex(ctx, plaintext.data() + plaintext.size(), &outLen) != 1) {
+    // do not release unauthenticated plaintext
+    OPENSSL_cleanse(plaintext.data(), plaintext.size());
+    return false;
+  }
+  BOOST_ASSERT(outLen == 0);
+  return true;
+}
+
+ConstBufferPtr
+AeadCipher::decrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> sealed)
+{
+  if (sealed.size() < TAG_SIZE)
+    return nullptr;
+
+  auto plaintext = make_shared<Buffer>(sealed.size() - TAG_SIZE);
+  if (!decrypt(nonce, aad, sealed.first(plaintext->size()), sealed.last(TAG_SIZE), *plaintext))
+    return nullptr;
+  return plaintext;
+}
+
+AeadNonceSequence::AeadNonceSequence(uint32_t fixedField, uint64_t counter)
+  : m_fixedField(fixedField)
+  , m_counter(counter)
+{
+}
+
+AeadNonceSequence::Nonce
+AeadNonceSequence::next()
+{
+  if (m_isExhausted)
+    NDN_THROW(AeadCipher::Error("Nonce sequence is exhausted"));
+
+  Nonce nonce;
+  for (size_t i = 0; i < 4; ++i) {
+    nonce[i] = static_cast<uint8_t>(m_fixedField >> (24 - 8 * i));
+  }
+  for (size_t i = 0; i < 8; ++i) {
+    nonce[4 + i] = static_cast<uint8_t>(m_counter >> (56 - 8 * i));
+  }
+
+  if (++m_counter == 0) {
+    m_isExhausted = true;
+  }
+  return nonce;
+}
+
+} // namespace transform
+} // namespace security
+} // namespace ndn
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_TRANSFORM_AEAD_CIPHER_HPP
+#define NDN_CXX_SECURITY_TRANSFORM_AEAD_CIPHER_HPP
+
+#include "ndn-cxx/encoding/buffer.hpp"
+#include "ndn-cxx/security/security-common.hpp"
+
+#include <array>
+
+namespace ndn {
+namespace security {
+namespace transform {
+
+/**
+ * @brief Authenticated encryption with associated data (AEAD) using a single key.
+ *
+ * Unlike BlockCipher, this class calls the OpenSSL EVP interface directly on caller-provided
+ * memory, so that packet content can be encrypted or decrypted in place without intermediate
+ * copies. The key schedule is computed once, in the constructor, and reused by every operation.
+ *
+ * An AeadCipher object is not thread-safe; use one object per thread.
+ *
+ * @sa AeadNonceSequence to generate nonces, AeadFilter to use AEAD in a transformation chain
+ */
+class AeadCipher : noncopyable
+{
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /// Size of the nonce, in bytes
+  static constexpr size_t NONCE_SIZE = 12;
+  /// Size of the authentication tag, in bytes
+  static constexpr size_t TAG_SIZE = 16;
+
+public:
+  /**
+   * @brief Create a cipher for algorithm @p algo with the symmetric key @p key.
+   *
+   * AES-GCM accepts 16-, 24-, and 32-byte keys; ChaCha20-Poly1305 accepts 32-byte keys.
+   *
+   * @throw Error the algorithm is not supported or the key has the wrong size
+   */
+  AeadCipher(AeadAlgorithm algo, span<const uint8_t> key);
+
+  ~AeadCipher();
+
+  AeadAlgorithm
+  getAlgorithm() const;
+
+  /**
+   * @brief Encrypt @p plaintext into @p ciphertext and compute the authentication tag.
+   *
+   * @param nonce NONCE_SIZE bytes; a nonce must never be used twice with the same key
+   * @param aad associated data, which is authenticated but not encrypted; may be empty
+   * @param plaintext the data to encrypt
+   * @param ciphertext receives the encrypted data, must be the same size as @p plaintext;
+   *                   it may be the same memory as @p plaintext, but must not partially overlap it
+   * @param tag receives the authentication tag, must be TAG_SIZE bytes
+   * @throw Error a parameter has the wrong size, or the encryption failed
+   */
+  void
+  encrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> plaintext,
+          span<uint8_t> ciphertext, span<uint8_t> tag);
+
+  /**
+   * @brief Encrypt @p plaintext and return the ciphertext followed by the authentication tag.
+   * @throw Error a parameter has the wrong size, or the encryption failed
+   */
+  ConstBufferPtr
+  encrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> plaintext);
+
+  /**
+   * @brief Authenticate and decrypt @p ciphertext into @p plaintext.
+   *
+   * @param nonce the nonce used for encryption
+   * @param aad the associated data used for encryption
+   * @param ciphertext the data to decrypt
+   * @param tag the authentication tag, must be TAG_SIZE bytes
+   * @param plaintext receives the decrypted data, must be the same size as @p ciphertext;
+   *                  it may be the same memory as @p ciphertext, but must not partially overlap it
+   * @return whether authentication succeeded; if false, @p plaintext is zeroed
+   * @throw Error a parameter has the wrong size, or the decryption failed
+   */
+  NDN_CXX_NODISCARD bool
+  decrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> ciphertext,
+          span<const uint8_t> tag, span<uint8_t> plaintext);
+
+  /**
+   * @brief Authenticate and decrypt @p sealed, the ciphertext followed by the authentication tag.
+   * @return the plaintext, or nullptr if authentication failed
+   * @throw Error a parameter has the wrong size, or the decryption failed
+   */
+  ConstBufferPtr
+  decrypt(span<const uint8_t> nonce, span<const uint8_t> aad, span<const uint8_t> sealed);
+
+private:
+  class Impl;
+  const unique_ptr<Impl> m_impl;
+};
+
+/**
+ * @brief Generates unique nonces for use with one AEAD key.
+ *
+ * Each nonce consists of a 4-byte fixed field followed by a 64-bit big-endian invocation
+ * counter, which is the deterministic construction of NIST SP 800-38D, Section 8.2.1.
+ */
+class AeadNonceSequence
+{
+public:
+  using Nonce = std::array<uint8_t, AeadCipher::NONCE_SIZE>;
+
+  /**
+   * @brief Start a sequence with the given fixed field.
+   *
+   * Encryptors sharing a key must use distinct fixed fields, e.g., assigned per device or per
+   * sender. A randomly chosen fixed field is not enough: with only 32 bits, collisions between
+   * encryptors become likely after tens of thousands of them, and a collision reuses nonces.
+   *
+   * @param fixedField identifies the encryptor among those sharing the key
+   * @param counter the counter value of the first nonce, e.g., to resume a saved sequence
+   */
+  explicit
+  AeadNonceSequence(uint32_t fixedField, uint64_t counter = 0);
+
+  /**
+   * @brief Return the next nonce and advance the counter.
+   * @throw AeadCipher::Error the counter is exhausted; the key must be replaced
+   */
+  Nonce
+  next();
+
+  uint32_t
+  getFixedField() const
+  {
+    return m_fixedField;
+  }
+
+  /**
+   * @brief Return the counter value that will be used by the next nonce.
+   */
+  uint64_t
+  getCounter() const
+  {
+    return m_counter;
+  }
+
+private:
+  uint32_t m_fixedField;
+  uint64_t m_counter;
+  bool m_isExhausted = false;
+};
+
+} // namespace transform
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_TRANSFORM_AEAD_CIPHER_HPP
@@ -0,0 +1,119 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/transform/aead-filter.hpp"
+#include "ndn-cxx/security/transform/aead-cipher.hpp"
+
+namespace ndn {
+namespace security {
+namespace transform {
+
+class AeadFilter::Impl
+{
+public:
+  unique_ptr<AeadCipher> cipher;
+  CipherOperator op;
+  Buffer nonce;
+  Buffer aad;
+  /// accumulated input, followed by room for the tag when encrypting
+  unique_ptr<OBuffer> input = make_unique<OBuffer>();
+};
+
+
+AeadFilter::AeadFilter(AeadAlgorithm algo, CipherOperator op, span<const uint8_t> key,
+                       span<const uint8_t> nonce, span<const uint8_t> aad)
+  : m_impl(make_unique<Impl>())
+{
+  if (nonce.size() != AeadCipher::NONCE_SIZE)
+    NDN_THROW(Error(getIndex(), "Nonce length must be " + to_string(AeadCipher::NONCE_SIZE)));
+
+  try {
+    m_impl->cipher = make_unique<AeadCipher>(algo, key);
+  }
+  catch (const AeadCipher::Error& e) {
+    NDN_THROW_NESTED(Error(getIndex(), e.what()));
+  }
+  m_impl->op = op;
+  m_impl->nonce.assign(nonce.begin(), nonce.end());
+  m_impl->aad.assign(aad.begin(), aad.end());
+}
+
+AeadFilter::~AeadFilter() = default;
+
+size_t
+AeadFilter::convert(span<const uint8_t> buf)
+{
+  m_impl->input->insert(m_impl->input->end(), buf.begin(), buf.end());
+  return buf.size();
+}
+
+void
+AeadFilter::finalize()
+{
+  auto& buffer = m_impl->input;
+  const size_t tagSize = AeadCipher::TAG_SIZE;
+
+  if (m_impl->op == CipherOperator::ENCRYPT) {
+    // encrypt in place and append the tag
+    size_t textSize = buffer->size();
+    buffer->resize(textSize + tagSize);
+    auto text = make_span(*buffer).first(textSize);
+    try {
+      m_impl->cipher->encrypt(m_impl->nonce, m_impl->aad, text, text, make_span(*buffer).last(tagSize));
+    }
+    catch (const AeadCipher::Error& e) {
+      NDN_THROW_NESTED(Error(getIndex(), e.what()));
+    }
+  }
+  else {
+    if (buffer->size() < tagSize)
+      NDN_THROW(Error(getIndex(), "Input is shorter than the authentication tag"));
+
+    // decrypt in place and drop the tag
+    size_t textSize = buffer->size() - tagSize;
+    auto text = make_span(*buffer).first(textSize);
+    bool isAuthentic = false;
+    try {
+      isAuthentic = m_impl->cipher->decrypt(m_impl->nonce, m_impl->aad, text,
+                                            make_span(*buffer).last(tagSize), text);
+    }
+    catch (const AeadCipher::Error& e) {
+      NDN_THROW_NESTED(Error(getIndex(), e.what()));
+    }
+    if (!isAuthentic)
+      NDN_THROW(Error(getIndex(), "Authentication failed"));
+    buffer->resize(textSize);
+  }
+
+  setOutputBuffer(std::move(buffer));
+  flushAllOutput();
+}
+
+unique_ptr<Transform>
+aeadFilter(AeadAlgorithm algo, CipherOperator op, span<const uint8_t> key,
+           span<const uint8_t> nonce, span<const uint8_t> aad)
+{
+  return make_unique<AeadFilter>(algo, op, key, nonce, aad);
+}
+
+} // namespace transform
+} // namespace security
+} // namespace ndn
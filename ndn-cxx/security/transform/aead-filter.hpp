@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_SECURITY_TRANSFORM_AEAD_FILTER_HPP
+#define NDN_CXX_SECURITY_TRANSFORM_AEAD_FILTER_HPP
+
+#include "ndn-cxx/security/transform/transform-base.hpp"
+#include "ndn-cxx/security/security-common.hpp"
+
+namespace ndn {
+namespace security {
+namespace transform {
+
+/**
+ * @brief The module to encrypt or decrypt data using an AEAD algorithm.
+ *
+ * When encrypting, the output is the ciphertext followed by the authentication tag. When
+ * decrypting, the input must be in the same format, and the output is the plaintext.
+ *
+ * The input is accumulated and processed as a whole by AeadCipher when the transformation
+ * chain ends, so that unauthenticated plaintext is never passed to the next module. Use
+ * AeadCipher directly to avoid the copies made by this module.
+ */
+class AeadFilter final : public Transform
+{
+public:
+  /**
+   * @brief Create an AEAD module.
+   *
+   * @param algo The AEAD algorithm to use.
+   * @param op   The operation to perform (encrypt or decrypt).
+   * @param key  The symmetric key.
+   * @param nonce The nonce, which must never be used twice with the same key for encryption.
+   * @param aad  The associated data, which is authenticated but not encrypted.
+   */
+  AeadFilter(AeadAlgorithm algo, CipherOperator op, span<const uint8_t> key,
+             span<const uint8_t> nonce, span<const uint8_t> aad = {});
+
+  ~AeadFilter() final;
+
+private:
+  /**
+   * @brief Append @p buf to the accumulated input.
+   *
+   * @return The number of bytes that are actually accepted
+   */
+  size_t
+  convert(span<const uint8_t> buf) final;
+
+  /**
+   * @brief Encrypt or decrypt the accumulated input and write the result into next module.
+   *
+   * @throw Error the authentication failed, or the cipher reported an error
+   */
+  void
+  finalize() final;
+
+private:
+  class Impl;
+  const unique_ptr<Impl> m_impl;
+};
+
+unique_ptr<Transform>
+aeadFilter(AeadAlgorithm algo, CipherOperator op, span<const uint8_t> key,
+           span<const uint8_t> nonce, span<const uint8_t> aad = {});
+
+} // namespace transform
+} // namespace security
+} // namespace ndn
+
+#endif // NDN_CXX_SECURITY_TRANSFORM_AEAD_FILTER_HPP
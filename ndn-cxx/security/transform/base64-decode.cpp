@@ -20,106 +20,53 @@
  */
 
 #include "ndn-cxx/security/transform/base64-decode.hpp"
-
-#include <openssl/bio.h>
-#include <openssl/evp.h>
+#include "ndn-cxx/util/impl/base64.hpp"
 
 namespace ndn {
 namespace security {
 namespace transform {
 
-class Base64Decode::Impl : boost::noncopyable
+class Base64Decode::Impl
 {
 public:
-  Impl()
-    : m_base64(BIO_new(BIO_f_base64()))
-    , m_source(BIO_new(BIO_s_mem()))
-  {
-    // Input may not be written in a single time.
-    // Do not return EOF when source is empty unless explicitly requested
-    BIO_set_mem_eof_return(m_source, -1);
-
-    // connect base64 transform to the data source.
-    BIO_push(m_base64, m_source);
-  }
-
-  ~Impl()
-  {
-    BIO_free_all(m_base64);
-  }
-
-public:
-  BIO* m_base64;
-  BIO* m_source; // BIO_f_base64 alone does not work without a source
+  util::detail::Base64Decoder decoder;
 };
 
 
-Base64Decode::Base64Decode(bool expectNewlineEvery64Bytes)
+Base64Decode::Base64Decode(bool)
   : m_impl(make_unique<Impl>())
 {
-  if (!expectNewlineEvery64Bytes)
-    BIO_set_flags(m_impl->m_base64, BIO_FLAGS_BASE64_NO_NL);
 }
 
 Base64Decode::~Base64Decode() = default;
 
-void
-Base64Decode::preTransform()
-{
-  while (isOutputBufferEmpty()) {
-    fillOutputBuffer();
-    if (isOutputBufferEmpty()) // nothing to read from BIO, return
-      return;
-
-    flushOutputBuffer();
-  }
-}
-
 size_t
 Base64Decode::convert(span<const uint8_t> buf)
 {
-  int wLen = BIO_write(m_impl->m_source, buf.data(), buf.size());
+  auto buffer = make_unique<OBuffer>(m_impl->decoder.getMaxOutputSize(buf.size()));
+  size_t nWritten = 0;
+  if (!m_impl->decoder.update(buf, buffer->data(), nWritten))
+    NDN_THROW(Error(getIndex(), "Wrong input byte"));
 
-  if (wLen <= 0) { // fail to write data
-    if (!BIO_should_retry(m_impl->m_source)) {
-      // we haven't written everything but some error happens, and we cannot retry
-      NDN_THROW(Error(getIndex(), "Failed to accept more input"));
-    }
-    return 0;
-  }
-  else { // update number of bytes written
-    return wLen;
-  }
-}
-
-void
-Base64Decode::finalize()
-{
-  BIO_set_mem_eof_return(m_impl->m_source, 0);
+  buffer->resize(nWritten);
+  if (!buffer->empty())
+    setOutputBuffer(std::move(buffer));
 
-  fillOutputBuffer();
-
-  while (!isOutputBufferEmpty()) {
-    flushOutputBuffer();
-    if (isOutputBufferEmpty())
-      fillOutputBuffer();
-  }
+  return buf.size();
 }
 
 void
-Base64Decode::fillOutputBuffer()
+Base64Decode::finalize()
 {
-  // OpenSSL base64 BIO cannot give us the number bytes of partial decoded result,
-  // so we just try to read a chunk.
-  auto buffer = make_unique<OBuffer>(1024);
-  int rLen = BIO_read(m_impl->m_base64, buffer->data(), buffer->size());
-  if (rLen <= 0)
-    return;
-
-  if (static_cast<size_t>(rLen) < buffer->size())
-    buffer->erase(buffer->begin() + rLen, buffer->end());
+  auto buffer = make_unique<OBuffer>(m_impl->decoder.getMaxOutputSize(0));
+  size_t nWritten = 0;
+  if (!m_impl->decoder.finish(buffer->data(), nWritten))
+    NDN_THROW(Error(getIndex(), "Incomplete input"));
 
+  buffer->resize(nWritten);
   setOutputBuffer(std::move(buffer));
+
+  flushAllOutput();
 }
 
 unique_ptr<Transform>
@@ -37,9 +37,9 @@ public:
   /**
    * @brief Create a base64 decoding module
    *
-   * @param expectNewlineEvery64Bytes If true, expect newline after every 64 bytes, otherwise
-   *                                  expect all input to be in a single line. Output is undefined
-   *                                  if input does not conform to the requirement.
+   * @param expectNewlineEvery64Bytes Ignored. Whitespace and newlines are accepted anywhere
+   *                                  in the input, so both formats produced by base64Encode()
+   *                                  can be decoded.
    */
   explicit
   Base64Decode(bool expectNewlineEvery64Bytes = true);
@@ -47,15 +47,10 @@ public:
   ~Base64Decode() final;
 
 private:
-  /**
-   * @brief Read partial transformation results into output buffer and write them into next module.
-   */
-  void
-  preTransform() final;
-
   /**
    * @brief Decode @p buf from base64 format.
    * @return The number of bytes that have been accepted by the converter.
+   * @throw Error @p buf contains a character that is not valid base64
    */
   size_t
   convert(span<const uint8_t> buf) final;
@@ -63,17 +58,14 @@ private:
   /**
    * @brief Finalize base64 decoding
    *
-   * This method with read all decoding results from the converter and write them into next module.
+   * This method decodes the last incomplete group of input characters, if any, and writes it
+   * into next module.
+   *
+   * @throw Error the input ends with an incomplete group
    */
   void
   finalize() final;
 
-  /**
-   * @brief Try to fill partial decoding result into output buffer.
-   */
-  void
-  fillOutputBuffer();
-
 private:
   class Impl;
   const unique_ptr<Impl> m_impl;
@@ -20,109 +20,52 @@
  */
 
 #include "ndn-cxx/security/transform/base64-encode.hpp"
-
-#include <openssl/bio.h>
-#include <openssl/evp.h>
+#include "ndn-cxx/util/impl/base64.hpp"
 
 namespace ndn {
 namespace security {
 namespace transform {
 
-class Base64Encode::Impl : boost::noncopyable
+class Base64Encode::Impl
 {
 public:
-  Impl()
-    : m_base64(BIO_new(BIO_f_base64()))
-    , m_sink(BIO_new(BIO_s_mem()))
-  {
-    // connect base64 transform to the data sink.
-    BIO_push(m_base64, m_sink);
-  }
-
-  ~Impl()
+  explicit
+  Impl(bool needBreak)
+    : encoder(needBreak)
   {
-    BIO_free_all(m_base64);
   }
 
 public:
-  BIO* m_base64;
-  BIO* m_sink; // BIO_f_base64 alone does not work without a sink
+  util::detail::Base64Encoder encoder;
 };
 
 
 Base64Encode::Base64Encode(bool needBreak)
-  : m_impl(make_unique<Impl>())
+  : m_impl(make_unique<Impl>(needBreak))
 {
-  if (!needBreak)
-    BIO_set_flags(m_impl->m_base64, BIO_FLAGS_BASE64_NO_NL);
 }
 
 Base64Encode::~Base64Encode() = default;
 
-void
-Base64Encode::preTransform()
-{
-  fillOutputBuffer();
-}
-
 size_t
 Base64Encode::convert(span<const uint8_t> data)
 {
-  if (data.empty())
-    return 0;
-
-  int wLen = BIO_write(m_impl->m_base64, data.data(), data.size());
+  auto buffer = make_unique<OBuffer>(m_impl->encoder.getMaxOutputSize(data.size()));
+  buffer->resize(m_impl->encoder.update(data, buffer->data()));
+  if (!buffer->empty())
+    setOutputBuffer(std::move(buffer));
 
-  if (wLen <= 0) { // fail to write data
-    if (!BIO_should_retry(m_impl->m_base64)) {
-      // we haven't written everything but some error happens, and we cannot retry
-      NDN_THROW(Error(getIndex(), "Failed to accept more input"));
-    }
-    return 0;
-  }
-  else { // update number of bytes written
-    fillOutputBuffer();
-    return wLen;
-  }
+  return data.size();
 }
 
 void
 Base64Encode::finalize()
 {
-  if (BIO_flush(m_impl->m_base64) != 1)
-    NDN_THROW(Error(getIndex(), "Failed to flush"));
-
-  while (!isConverterEmpty()) {
-    fillOutputBuffer();
-    while (!isOutputBufferEmpty()) {
-      flushOutputBuffer();
-    }
-  }
-}
-
-void
-Base64Encode::fillOutputBuffer()
-{
-  int nRead = BIO_pending(m_impl->m_sink);
-  if (nRead <= 0)
-    return;
-
-  // there is something to read from BIO
-  auto buffer = make_unique<OBuffer>(nRead);
-  int rLen = BIO_read(m_impl->m_sink, buffer->data(), nRead);
-  if (rLen < 0)
-    return;
-
-  if (rLen < nRead)
-    buffer->erase(buffer->begin() + rLen, buffer->end());
-
+  auto buffer = make_unique<OBuffer>(m_impl->encoder.getMaxOutputSize(0));
+  buffer->resize(m_impl->encoder.finish(buffer->data()));
   setOutputBuffer(std::move(buffer));
-}
 
-bool
-Base64Encode::isConverterEmpty()
-{
-  return BIO_pending(m_impl->m_sink) <= 0;
+  flushAllOutput();
 }
 
 unique_ptr<Transform>
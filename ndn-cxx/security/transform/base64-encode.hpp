@@ -45,12 +45,6 @@ public:
   ~Base64Encode() final;
 
 private:
-  /**
-   * @brief Read partial transformation result (if exists) from BIO
-   */
-  void
-  preTransform() final;
-
   /**
    * @brief Encode @p data into base64 format.
    * @return The number of input bytes that have been accepted by the converter.
@@ -61,23 +55,12 @@ private:
   /**
    * @brief Finalize base64 encoding
    *
-   * This method with read all encoding results from the converter and write them into next module.
+   * This method encodes the last incomplete group of input bytes, if any, and writes it
+   * into next module.
    */
   void
   finalize() final;
 
-  /**
-   * @brief Fill output buffer with the transformation result from BIO.
-   */
-  void
-  fillOutputBuffer();
-
-  /**
-   * @return true if converter does not have partial result.
-   */
-  bool
-  isConverterEmpty();
-
 private:
   class Impl;
   const unique_ptr<Impl> m_impl;
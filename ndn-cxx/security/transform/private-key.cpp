@@ -35,8 +35,12 @@
 #endif
 
 #include <boost/lexical_cast.hpp>
+#include <array>
 #include <cstring>
+#include <map>
+#include <mutex>
 
+#include <openssl/crypto.h>
 #include <openssl/ec.h>
 #include <openssl/pem.h>
 #include <openssl/rsa.h>
@@ -66,8 +70,33 @@ public:
     EVP_PKEY_free(key);
   }
 
+  const detail::EvpMdCtx&
+  getSigningContext(DigestAlgorithm algo)
+  {
+    // sign() and verify() are const and may be called concurrently on the same key
+    std::lock_guard<std::mutex> lock(contextsMutex);
+    auto it = signingContexts.find(algo);
+    if (it != signingContexts.end())
+      return *it->second;
+
+    const EVP_MD* md = detail::digestAlgorithmToEvpMd(algo);
+    if (md == nullptr)
+      NDN_THROW(Error("Unsupported digest algorithm " + boost::lexical_cast<std::string>(algo)));
+
+    auto ctx = make_unique<detail::EvpMdCtx>();
+    if (EVP_DigestSignInit(*ctx, nullptr, md, nullptr, key) != 1)
+      NDN_THROW(Error("Failed to initialize signing context with " +
+                      boost::lexical_cast<std::string>(algo) + " digest"));
+
+    return *signingContexts.emplace(algo, std::move(ctx)).first->second;
+  }
+
 public:
   EVP_PKEY* key = nullptr;
+  /// signing contexts initialized with the key, copied for each signature
+  std::map<DigestAlgorithm, unique_ptr<detail::EvpMdCtx>> signingContexts;
+  /// guards signingContexts; the contexts themselves are only read after insertion
+  std::mutex contextsMutex;
 };
 
 PrivateKey::PrivateKey()
@@ -90,6 +119,8 @@ PrivateKey::getKeyType() const
     return KeyType::EC;
   case EVP_PKEY_HMAC:
     return KeyType::HMAC;
+  case EVP_PKEY_ED25519:
+    return KeyType::ED25519;
   default:
     return KeyType::NONE;
   }
@@ -102,7 +133,8 @@ PrivateKey::getKeySize() const
     case KeyType::RSA:
     case KeyType::EC:
       return static_cast<size_t>(EVP_PKEY_bits(m_impl->key));
-    case KeyType::HMAC: {
+    case KeyType::HMAC:
+    case KeyType::ED25519: {
       size_t nBytes = 0;
       EVP_PKEY_get_raw_private_key(m_impl->key, nullptr, &nBytes);
       return nBytes * 8;
@@ -340,6 +372,73 @@ PrivateKey::decrypt(span<const uint8_t> cipherText) const
   }
 }
 
+size_t
+PrivateKey::getMaxSignatureSize(DigestAlgorithm algo) const
+{
+  ENSURE_PRIVATE_KEY_LOADED(m_impl->key);
+
+  if (getKeyType() == KeyType::HMAC) {
+    const EVP_MD* md = detail::digestAlgorithmToEvpMd(algo);
+    if (md == nullptr)
+      NDN_THROW(Error("Unsupported digest algorithm " + boost::lexical_cast<std::string>(algo)));
+    return static_cast<size_t>(EVP_MD_size(md));
+  }
+  return static_cast<size_t>(EVP_PKEY_size(m_impl->key));
+}
+
+size_t
+PrivateKey::sign(DigestAlgorithm algo, const InputBuffers& bufs, span<uint8_t> sig) const
+{
+  if (sig.size() < getMaxSignatureSize(algo))
+    NDN_THROW(Error("Signature buffer is too small"));
+
+  if (getKeyType() == KeyType::ED25519) {
+    // Ed25519 hashes the message internally and cannot take it in parts
+    Buffer joined;
+    auto msg = detail::joinInputBuffers(bufs, joined);
+    detail::EvpMdCtx ctx;
+    size_t sigLen = sig.size();
+    if (EVP_DigestSignInit(ctx, nullptr, nullptr, nullptr, m_impl->key) != 1 ||
+        EVP_DigestSign(ctx, sig.data(), &sigLen, msg.data(), msg.size()) != 1)
+      NDN_THROW(Error("Failed to compute Ed25519 signature"));
+    return sigLen;
+  }
+
+  detail::EvpMdCtx ctx;
+  if (EVP_MD_CTX_copy_ex(ctx, m_impl->getSigningContext(algo)) != 1)
+    NDN_THROW(Error("Failed to copy signing context"));
+
+  for (const auto& buf : bufs) {
+    if (EVP_DigestSignUpdate(ctx, buf.data(), buf.size()) != 1)
+      NDN_THROW(Error("Failed to accept more input"));
+  }
+
+  size_t sigLen = sig.size();
+  if (EVP_DigestSignFinal(ctx, sig.data(), &sigLen) != 1)
+    NDN_THROW(Error("Failed to finalize signature"));
+
+  return sigLen;
+}
+
+ConstBufferPtr
+PrivateKey::sign(DigestAlgorithm algo, const InputBuffers& bufs) const
+{
+  auto sig = make_shared<Buffer>(getMaxSignatureSize(algo));
+  sig->resize(sign(algo, bufs, *sig));
+  return sig;
+}
+
+bool
+PrivateKey::verify(DigestAlgorithm algo, const InputBuffers& bufs, span<const uint8_t> sig) const
+{
+  if (getKeyType() != KeyType::HMAC)
+    NDN_THROW(Error("Verification with a private key is only supported for HMAC keys"));
+
+  std::array<uint8_t, EVP_MAX_MD_SIZE> hmac;
+  size_t hmacLen = sign(algo, bufs, hmac);
+  return hmacLen == sig.size() && CRYPTO_memcmp(hmac.data(), sig.data(), hmacLen) == 0;
+}
+
 void*
 PrivateKey::getEvpPkey() const
 {
@@ -505,6 +604,23 @@ PrivateKey::generateEcKey(uint32_t keySize)
   return privateKey;
 }
 
+unique_ptr<PrivateKey>
+PrivateKey::generateEd25519Key()
+{
+  auto privateKey = make_unique<PrivateKey>();
+  BOOST_ASSERT(privateKey->m_impl->key == nullptr);
+
+  detail::EvpPkeyCtx kctx(EVP_PKEY_ED25519);
+
+  if (EVP_PKEY_keygen_init(kctx) <= 0)
+    NDN_THROW(Error("Failed to initialize Ed25519 keygen context"));
+
+  if (EVP_PKEY_keygen(kctx, &privateKey->m_impl->key) <= 0)
+    NDN_THROW(Error("Failed to generate Ed25519 key"));
+
+  return privateKey;
+}
+
 unique_ptr<PrivateKey>
 PrivateKey::generateHmacKey(uint32_t keySize)
 {
@@ -534,6 +650,9 @@ generatePrivateKey(const KeyParams& keyParams)
       const auto& ecParams = static_cast<const EcKeyParams&>(keyParams);
       return PrivateKey::generateEcKey(ecParams.getKeySize());
     }
+    case KeyType::ED25519: {
+      return PrivateKey::generateEd25519Key();
+    }
     case KeyType::HMAC: {
       const auto& hmacParams = static_cast<const HmacKeyParams&>(keyParams);
       return PrivateKey::generateHmacKey(hmacParams.getKeySize());
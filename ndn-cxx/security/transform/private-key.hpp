@@ -184,6 +184,8 @@ public:
 
   /**
    * @brief Save the private key in PKCS#1 format into a stream @p os
+   *
+   * Ed25519 keys, which have no PKCS#1 representation, are saved in unencrypted PKCS#8 format.
    */
   void
   savePkcs1(std::ostream& os) const;
@@ -238,6 +240,46 @@ public:
   ConstBufferPtr
   decrypt(span<const uint8_t> cipherText) const;
 
+  /**
+   * @brief Returns the maximum size of a signature generated using this private key and @p algo.
+   */
+  size_t
+  getMaxSignatureSize(DigestAlgorithm algo) const;
+
+  /**
+   * @brief Sign @p bufs using this private key and @p algo, writing the signature into @p sig.
+   *
+   * Unlike signerFilter(), this does not create a transformation chain. A signing context is
+   * initialized with this key once for each digest algorithm, and copied for each signature,
+   * so that the key setup (including the HMAC key schedule) is not repeated.
+   *
+   * Ed25519 keys sign the message itself, and @p algo is ignored.
+   *
+   * @return Size of the signature written into @p sig.
+   * @throw Error @p sig is smaller than getMaxSignatureSize(), or signing failed.
+   * @note This function must not be called concurrently on the same private key.
+   */
+  size_t
+  sign(DigestAlgorithm algo, const InputBuffers& bufs, span<uint8_t> sig) const;
+
+  /**
+   * @brief Sign @p bufs using this private key and @p algo.
+   * @return The signature.
+   * @throw Error Signing failed.
+   */
+  ConstBufferPtr
+  sign(DigestAlgorithm algo, const InputBuffers& bufs) const;
+
+  /**
+   * @brief Verify the signature @p sig over @p bufs using this private key and @p algo.
+   *
+   * Only HMAC keys are supported.
+   *
+   * @throw Error The key is not an HMAC key, or signing failed.
+   */
+  bool
+  verify(DigestAlgorithm algo, const InputBuffers& bufs, span<const uint8_t> sig) const;
+
 private:
   friend class SignerFilter;
   friend class VerifierFilter;
@@ -271,6 +313,9 @@ private:
   static unique_ptr<PrivateKey>
   generateEcKey(uint32_t keySize);
 
+  static unique_ptr<PrivateKey>
+  generateEd25519Key();
+
   static unique_ptr<PrivateKey>
   generateHmacKey(uint32_t keySize);
 
@@ -28,6 +28,10 @@
 #include "ndn-cxx/security/impl/openssl-helper.hpp"
 #include "ndn-cxx/encoding/buffer-stream.hpp"
 
+#include <boost/lexical_cast.hpp>
+#include <map>
+#include <mutex>
+
 #include <openssl/rsa.h>
 #include <openssl/x509.h>
 
@@ -60,8 +64,33 @@ public:
     EVP_PKEY_free(key);
   }
 
+  const detail::EvpMdCtx&
+  getVerificationContext(DigestAlgorithm algo)
+  {
+    // sign() and verify() are const and may be called concurrently on the same key
+    std::lock_guard<std::mutex> lock(contextsMutex);
+    auto it = verificationContexts.find(algo);
+    if (it != verificationContexts.end())
+      return *it->second;
+
+    const EVP_MD* md = detail::digestAlgorithmToEvpMd(algo);
+    if (md == nullptr)
+      NDN_THROW(Error("Unsupported digest algorithm " + boost::lexical_cast<std::string>(algo)));
+
+    auto ctx = make_unique<detail::EvpMdCtx>();
+    if (EVP_DigestVerifyInit(*ctx, nullptr, md, nullptr, key) != 1)
+      NDN_THROW(Error("Failed to initialize verification context with " +
+                      boost::lexical_cast<std::string>(algo) + " digest"));
+
+    return *verificationContexts.emplace(algo, std::move(ctx)).first->second;
+  }
+
 public:
   EVP_PKEY* key;
+  /// verification contexts initialized with the key, copied for each verification
+  std::map<DigestAlgorithm, unique_ptr<detail::EvpMdCtx>> verificationContexts;
+  /// guards verificationContexts; the contexts themselves are only read after insertion
+  std::mutex contextsMutex;
 };
 
 PublicKey::PublicKey()
@@ -82,6 +111,8 @@ PublicKey::getKeyType() const
     return KeyType::RSA;
   case EVP_PKEY_EC:
     return KeyType::EC;
+  case EVP_PKEY_ED25519:
+    return KeyType::ED25519;
   default:
     return KeyType::NONE;
   }
@@ -94,6 +125,11 @@ PublicKey::getKeySize() const
   case KeyType::RSA:
   case KeyType::EC:
     return static_cast<size_t>(EVP_PKEY_bits(m_impl->key));
+  case KeyType::ED25519: {
+    size_t nBytes = 0;
+    EVP_PKEY_get_raw_public_key(m_impl->key, nullptr, &nBytes);
+    return nBytes * 8;
+  }
   default:
     return 0;
   }
@@ -161,6 +197,33 @@ PublicKey::encrypt(span<const uint8_t> plainText) const
   }
 }
 
+bool
+PublicKey::verify(DigestAlgorithm algo, const InputBuffers& bufs, span<const uint8_t> sig) const
+{
+  ENSURE_PUBLIC_KEY_LOADED(m_impl->key);
+
+  if (getKeyType() == KeyType::ED25519) {
+    // Ed25519 hashes the message internally and cannot take it in parts
+    Buffer joined;
+    auto msg = detail::joinInputBuffers(bufs, joined);
+    detail::EvpMdCtx ctx;
+    if (EVP_DigestVerifyInit(ctx, nullptr, nullptr, nullptr, m_impl->key) != 1)
+      NDN_THROW(Error("Failed to initialize Ed25519 verification context"));
+    return EVP_DigestVerify(ctx, sig.data(), sig.size(), msg.data(), msg.size()) == 1;
+  }
+
+  detail::EvpMdCtx ctx;
+  if (EVP_MD_CTX_copy_ex(ctx, m_impl->getVerificationContext(algo)) != 1)
+    NDN_THROW(Error("Failed to copy verification context"));
+
+  for (const auto& buf : bufs) {
+    if (EVP_DigestVerifyUpdate(ctx, buf.data(), buf.size()) != 1)
+      NDN_THROW(Error("Failed to accept more input"));
+  }
+
+  return EVP_DigestVerifyFinal(ctx, sig.data(), sig.size()) == 1;
+}
+
 void*
 PublicKey::getEvpPkey() const
 {
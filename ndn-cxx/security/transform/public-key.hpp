@@ -107,6 +107,21 @@ public:
   ConstBufferPtr
   encrypt(span<const uint8_t> plainText) const;
 
+  /**
+   * @brief Verify the signature @p sig over @p bufs using this public key and @p algo.
+   *
+   * Unlike verifierFilter(), this does not create a transformation chain. A verification
+   * context is initialized with this key once for each digest algorithm, and copied for
+   * each verification.
+   *
+   * Ed25519 keys verify the message itself, and @p algo is ignored.
+   *
+   * @throw Error The verification context could not be initialized.
+   * @note This function must not be called concurrently on the same public key.
+   */
+  bool
+  verify(DigestAlgorithm algo, const InputBuffers& bufs, span<const uint8_t> sig) const;
+
 private:
   friend class VerifierFilter;
 
@@ -33,16 +33,26 @@ class SignerFilter::Impl
 {
 public:
   detail::EvpMdCtx ctx;
+  /// whether the key signs the whole input at once, in which case it is accumulated in input
+  bool isOneShot = false;
+  Buffer input;
 };
 
 
 SignerFilter::SignerFilter(DigestAlgorithm algo, const PrivateKey& key)
   : m_impl(make_unique<Impl>())
 {
-  const EVP_MD* md = detail::digestAlgorithmToEvpMd(algo);
-  if (md == nullptr)
-    NDN_THROW(Error(getIndex(), "Unsupported digest algorithm " +
-                    boost::lexical_cast<std::string>(algo)));
+  const EVP_MD* md = nullptr;
+  if (key.getKeyType() == KeyType::ED25519) {
+    // Ed25519 hashes the message internally
+    m_impl->isOneShot = true;
+  }
+  else {
+    md = detail::digestAlgorithmToEvpMd(algo);
+    if (md == nullptr)
+      NDN_THROW(Error(getIndex(), "Unsupported digest algorithm " +
+                      boost::lexical_cast<std::string>(algo)));
+  }
 
   if (EVP_DigestSignInit(m_impl->ctx, nullptr, md, nullptr,
                          reinterpret_cast<EVP_PKEY*>(key.getEvpPkey())) != 1)
@@ -56,6 +66,11 @@ SignerFilter::~SignerFilter() = default;
 size_t
 SignerFilter::convert(span<const uint8_t> buf)
 {
+  if (m_impl->isOneShot) {
+    m_impl->input.insert(m_impl->input.end(), buf.begin(), buf.end());
+    return buf.size();
+  }
+
   if (EVP_DigestSignUpdate(m_impl->ctx, buf.data(), buf.size()) != 1)
     NDN_THROW(Error(getIndex(), "Failed to accept more input"));
 
@@ -65,12 +80,17 @@ SignerFilter::convert(span<const uint8_t> buf)
 void
 SignerFilter::finalize()
 {
+  const auto& input = m_impl->input;
   size_t sigLen = 0;
-  if (EVP_DigestSignFinal(m_impl->ctx, nullptr, &sigLen) != 1)
+  int ret = m_impl->isOneShot ? EVP_DigestSign(m_impl->ctx, nullptr, &sigLen, input.data(), input.size())
+                              : EVP_DigestSignFinal(m_impl->ctx, nullptr, &sigLen);
+  if (ret != 1)
     NDN_THROW(Error(getIndex(), "Failed to estimate buffer length"));
 
   auto buffer = make_unique<OBuffer>(sigLen);
-  if (EVP_DigestSignFinal(m_impl->ctx, buffer->data(), &sigLen) != 1)
+  ret = m_impl->isOneShot ? EVP_DigestSign(m_impl->ctx, buffer->data(), &sigLen, input.data(), input.size())
+                          : EVP_DigestSignFinal(m_impl->ctx, buffer->data(), &sigLen);
+  if (ret != 1)
     NDN_THROW(Error(getIndex(), "Failed to finalize signature"));
 
   buffer->erase(buffer->begin() + sigLen, buffer->end());
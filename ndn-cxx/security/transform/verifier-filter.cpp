@@ -42,6 +42,8 @@ public:
 public:
   detail::EvpMdCtx ctx;
   span<const uint8_t> sig;
+  /// input accumulated for keys that verify the whole input at once
+  Buffer input;
 };
 
 
@@ -67,10 +69,14 @@ VerifierFilter::~VerifierFilter() = default;
 void
 VerifierFilter::init(DigestAlgorithm algo, void* pkey)
 {
-  const EVP_MD* md = detail::digestAlgorithmToEvpMd(algo);
-  if (md == nullptr)
-    NDN_THROW(Error(getIndex(), "Unsupported digest algorithm " +
-                    boost::lexical_cast<std::string>(algo)));
+  // Ed25519 hashes the message internally
+  const EVP_MD* md = nullptr;
+  if (m_keyType != KeyType::ED25519) {
+    md = detail::digestAlgorithmToEvpMd(algo);
+    if (md == nullptr)
+      NDN_THROW(Error(getIndex(), "Unsupported digest algorithm " +
+                      boost::lexical_cast<std::string>(algo)));
+  }
 
   int ret;
   if (m_keyType == KeyType::HMAC)
@@ -87,6 +93,11 @@ VerifierFilter::init(DigestAlgorithm algo, void* pkey)
 size_t
 VerifierFilter::convert(span<const uint8_t> buf)
 {
+  if (m_keyType == KeyType::ED25519) {
+    m_impl->input.insert(m_impl->input.end(), buf.begin(), buf.end());
+    return buf.size();
+  }
+
   int ret;
   if (m_keyType == KeyType::HMAC)
     ret = EVP_DigestSignUpdate(m_impl->ctx, buf.data(), buf.size());
@@ -112,6 +123,10 @@ VerifierFilter::finalize()
 
     ok = CRYPTO_memcmp(hmacBuf->data(), m_impl->sig.data(), std::min(hmacLen, m_impl->sig.size())) == 0;
   }
+  else if (m_keyType == KeyType::ED25519) {
+    ok = EVP_DigestVerify(m_impl->ctx, m_impl->sig.data(), m_impl->sig.size(),
+                          m_impl->input.data(), m_impl->input.size()) == 1;
+  }
   else {
     ok = EVP_DigestVerifyFinal(m_impl->ctx, m_impl->sig.data(), m_impl->sig.size()) == 1;
   }
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/security/validation-state.hpp"
+#include "ndn-cxx/detail/probes.hpp"
 #include "ndn-cxx/security/validator.hpp"
 #include "ndn-cxx/security/verification-helpers.hpp"
 #include "ndn-cxx/util/logger.hpp"
@@ -99,6 +100,7 @@ DataValidationState::verifyOriginalPacket(const optional<Certificate>& trustedCe
     m_successCb(m_data);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
     m_outcome = true;
+    NDN_CXX_PROBE(validator_finish, std::hash<Name>()(m_data.getName()), 'D', 1);
   }
   else {
     this->fail({ValidationError::INVALID_SIGNATURE, "Data " + m_data.getName().toUri()});
@@ -112,6 +114,7 @@ DataValidationState::bypassValidation()
   m_successCb(m_data);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = true;
+  NDN_CXX_PROBE(validator_finish, std::hash<Name>()(m_data.getName()), 'D', 1);
 }
 
 void
@@ -121,6 +124,7 @@ DataValidationState::fail(const ValidationError& error)
   m_failureCb(m_data, error);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = false;
+  NDN_CXX_PROBE(validator_finish, std::hash<Name>()(m_data.getName()), 'D', 0);
 }
 
 /////// InterestValidationState
@@ -152,6 +156,7 @@ InterestValidationState::verifyOriginalPacket(const optional<Certificate>& trust
     this->afterSuccess(m_interest);
     BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
     m_outcome = true;
+    NDN_CXX_PROBE(validator_finish, std::hash<Name>()(m_interest.getName()), 'I', 1);
   }
   else {
     this->fail({ValidationError::INVALID_SIGNATURE, "Interest " + m_interest.getName().toUri()});
@@ -165,6 +170,7 @@ InterestValidationState::bypassValidation()
   this->afterSuccess(m_interest);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = true;
+  NDN_CXX_PROBE(validator_finish, std::hash<Name>()(m_interest.getName()), 'I', 1);
 }
 
 void
@@ -174,6 +180,7 @@ InterestValidationState::fail(const ValidationError& error)
   m_failureCb(m_interest, error);
   BOOST_ASSERT(boost::logic::indeterminate(m_outcome));
   m_outcome = false;
+  NDN_CXX_PROBE(validator_finish, std::hash<Name>()(m_interest.getName()), 'I', 0);
 }
 
 } // inline namespace v2
@@ -209,6 +209,9 @@ parseSigType(const std::string& value)
   else if (boost::iequals(value, "ecdsa-sha256")) {
     return tlv::SignatureSha256WithEcdsa;
   }
+  else if (boost::iequals(value, "ed25519")) {
+    return tlv::SignatureEd25519;
+  }
   // TODO: uncomment when HMAC logic is defined/implemented
   // else if (boost::iequals(value, "hmac-sha256")) {
   //   return tlv::SignatureHmacWithSha256;
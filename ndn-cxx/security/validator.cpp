@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/security/validator.hpp"
+#include "ndn-cxx/detail/probes.hpp"
 #include "ndn-cxx/util/logger.hpp"
 
 #include <boost/lexical_cast.hpp>
@@ -52,6 +53,7 @@ Validator::validate(const Data& data,
 {
   auto state = make_shared<DataValidationState>(data, successCb, failureCb);
   NDN_LOG_DEBUG_DEPTH("Start validating data " << data.getName());
+  NDN_CXX_PROBE(validator_start, std::hash<Name>()(data.getName()), 'D');
 
   m_policy->checkPolicy(data, state, [this] (auto&&... args) {
     continueValidation(std::forward<decltype(args)>(args)...);
@@ -65,6 +67,7 @@ Validator::validate(const Interest& interest,
 {
   auto state = make_shared<InterestValidationState>(interest, successCb, failureCb);
   NDN_LOG_DEBUG_DEPTH("Start validating interest " << interest.getName());
+  NDN_CXX_PROBE(validator_start, std::hash<Name>()(interest.getName()), 'I');
 
   try {
     auto fmt = interest.getSignatureInfo() ? SignedInterestFormat::V03 : SignedInterestFormat::V02;
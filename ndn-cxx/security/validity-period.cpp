@@ -60,6 +60,17 @@ ValidityPeriod::ValidityPeriod(const time::system_clock::TimePoint& notBefore,
 {
 }
 
+static time::system_clock::TimePoint
+decodeTimestamp(const Block& element)
+{
+  auto value = element.value_bytes();
+  auto timePoint = time::parseIsoString({reinterpret_cast<const char*>(value.data()), value.size()});
+  if (!timePoint) {
+    NDN_THROW(ValidityPeriod::Error("Invalid date format in NOT-BEFORE or NOT-AFTER field"));
+  }
+  return *timePoint;
+}
+
 ValidityPeriod::ValidityPeriod(const Block& block)
 {
   wireDecode(block);
@@ -122,15 +133,8 @@ ValidityPeriod::wireDecode(const Block& wire)
     NDN_THROW(Error("Invalid NotBefore or NotAfter field"));
   }
 
-  try {
-    m_notBefore = time_point_cast<TimePoint::duration>(
-                    time::fromIsoString(readString(m_wire.elements()[NOT_BEFORE_OFFSET])));
-    m_notAfter = time_point_cast<TimePoint::duration>(
-                   time::fromIsoString(readString(m_wire.elements()[NOT_AFTER_OFFSET])));
-  }
-  catch (const std::bad_cast&) {
-    NDN_THROW(Error("Invalid date format in NOT-BEFORE or NOT-AFTER field"));
-  }
+  m_notBefore = time_point_cast<TimePoint::duration>(decodeTimestamp(m_wire.elements()[NOT_BEFORE_OFFSET]));
+  m_notAfter = time_point_cast<TimePoint::duration>(decodeTimestamp(m_wire.elements()[NOT_AFTER_OFFSET]));
 }
 
 ValidityPeriod&
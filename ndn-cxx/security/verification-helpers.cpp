@@ -27,12 +27,10 @@
 #include "ndn-cxx/security/certificate.hpp"
 #include "ndn-cxx/security/pib/key.hpp"
 #include "ndn-cxx/security/tpm/tpm.hpp"
-#include "ndn-cxx/security/transform/bool-sink.hpp"
 #include "ndn-cxx/security/transform/buffer-source.hpp"
 #include "ndn-cxx/security/transform/digest-filter.hpp"
 #include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
-#include "ndn-cxx/security/transform/verifier-filter.hpp"
 
 #include <openssl/crypto.h>
 
@@ -64,17 +62,15 @@ public:
 bool
 verifySignature(const InputBuffers& blobs, span<const uint8_t> sig, const transform::PublicKey& key)
 {
-  bool result = false;
   try {
-    using namespace transform;
-    bufferSource(blobs) >> verifierFilter(DigestAlgorithm::SHA256, key, sig)
-                        >> boolSink(result);
+    return key.verify(DigestAlgorithm::SHA256, blobs, sig);
   }
   catch (const transform::Error&) {
     return false;
   }
-
-  return result;
+  catch (const transform::PublicKey::Error&) {
+    return false;
+  }
 }
 
 bool
@@ -220,7 +216,8 @@ verifySignature(const Data& data, const optional<Certificate>& cert)
 {
   auto parsed = parse(data);
   if (cert) {
-    return verifySignature(parsed, cert->getPublicKey());
+    auto key = cert->getLoadedPublicKey();
+    return key != nullptr && verifySignature(parsed, *key);
   }
   else if (parsed.info.getSignatureType() == tlv::SignatureTypeValue::DigestSha256) {
     return verifyDigest(parsed, DigestAlgorithm::SHA256);
@@ -236,7 +233,8 @@ verifySignature(const Interest& interest, const optional<Certificate>& cert)
 {
   auto parsed = parse(interest);
   if (cert) {
-    return verifySignature(parsed, cert->getPublicKey());
+    auto key = cert->getLoadedPublicKey();
+    return key != nullptr && verifySignature(parsed, *key);
   }
   else if (parsed.info.getSignatureType() == tlv::SignatureTypeValue::DigestSha256) {
     return verifyDigest(parsed, DigestAlgorithm::SHA256);
@@ -55,6 +55,8 @@ template<typename T, int TypeId>
 class SimpleTag : public Tag
 {
 public:
+  using ValueType = T;
+
   static constexpr int
   getTypeId() noexcept
   {
@@ -22,13 +22,13 @@
 #ifndef NDN_CXX_TRANSPORT_DETAIL_STREAM_TRANSPORT_IMPL_HPP
 #define NDN_CXX_TRANSPORT_DETAIL_STREAM_TRANSPORT_IMPL_HPP
 
+#include "ndn-cxx/detail/probes.hpp"
 #include "ndn-cxx/transport/transport.hpp"
 
 #include <boost/asio/steady_timer.hpp>
 #include <boost/asio/write.hpp>
 
-#include <list>
-#include <queue>
+#include <deque>
 
 namespace ndn {
 namespace detail {
@@ -43,7 +43,7 @@ class StreamTransportImpl : public std::enable_shared_from_this<StreamTransportI
 {
 public:
   using Impl = StreamTransportImpl<BaseTransport, Protocol>;
-  using TransmissionQueue = std::queue<Block, std::list<Block>>;
+  using TransmissionQueue = std::deque<Block>;
 
   StreamTransportImpl(BaseTransport& transport, boost::asio::io_service& ioService)
     : m_transport(transport)
@@ -84,6 +84,7 @@ public:
     m_socket.close(error);
 
     TransmissionQueue{}.swap(m_transmissionQueue); // clear the queue
+    m_transport.setSendQueueLength(0);
   }
 
   void
@@ -108,14 +109,26 @@ public:
   void
   send(const Block& block)
   {
-    m_transmissionQueue.push(block);
+    send(make_span(&block, 1));
+  }
+
+  void
+  send(span<const Block> blocks)
+  {
+    if (blocks.empty()) {
+      return;
+    }
+
+    bool wasIdle = m_transmissionQueue.empty();
+    m_transmissionQueue.insert(m_transmissionQueue.end(), blocks.begin(), blocks.end());
+    m_transport.setSendQueueLength(m_transmissionQueue.size());
 
     if (m_transport.getState() != Transport::State::CLOSED &&
         m_transport.getState() != Transport::State::CONNECTING &&
-        m_transmissionQueue.size() == 1) {
+        wasIdle) {
       asyncWrite();
     }
-    // if not connected or there's another transmission in progress (m_transmissionQueue.size() > 1),
+    // if not connected or there's another transmission in progress (queue was not empty),
     // the next write will be scheduled either in connectHandler or in asyncWriteHandler
   }
 
@@ -152,9 +165,22 @@ protected:
   asyncWrite()
   {
     BOOST_ASSERT(!m_transmissionQueue.empty());
-    boost::asio::async_write(m_socket, boost::asio::buffer(m_transmissionQueue.front()),
+
+    // gather as many queued blocks as possible into a single write
+    m_writeBuffers.clear();
+    for (const auto& block : m_transmissionQueue) {
+      if (m_writeBuffers.size() == MAX_WRITE_BUFFERS) {
+        break;
+      }
+      m_writeBuffers.push_back(boost::asio::buffer(block));
+    }
+    size_t nBlocks = m_writeBuffers.size();
+    NDN_CXX_PROBE(transport_write, nBlocks, boost::asio::buffer_size(m_writeBuffers),
+                  m_transmissionQueue.size());
+
+    boost::asio::async_write(m_socket, m_writeBuffers,
       // capture a copy of the shared_ptr to "this" to prevent deallocation
-      [this, self = this->shared_from_this()] (const auto& error, size_t) {
+      [this, self = this->shared_from_this(), nBlocks] (const auto& error, size_t) {
         if (error) {
           if (error == boost::system::errc::operation_canceled) {
             // async receive has been explicitly cancelled (e.g., socket close)
@@ -168,8 +194,9 @@ protected:
           return; // queue has already been cleared
         }
 
-        BOOST_ASSERT(!m_transmissionQueue.empty());
-        m_transmissionQueue.pop();
+        BOOST_ASSERT(m_transmissionQueue.size() >= nBlocks);
+        m_transmissionQueue.erase(m_transmissionQueue.begin(), m_transmissionQueue.begin() + nBlocks);
+        m_transport.setSendQueueLength(m_transmissionQueue.size());
 
         if (!m_transmissionQueue.empty()) {
           asyncWrite();
@@ -194,6 +221,7 @@ protected:
         }
 
         m_inputBufferSize += nBytesRecvd;
+        NDN_CXX_PROBE(transport_receive, nBytesRecvd, m_inputBufferSize);
         // do magic
 
         std::size_t offset = 0;
@@ -234,12 +262,16 @@ protected:
   }
 
 protected:
+  /// maximum number of queued blocks handed to the socket in a single write
+  static constexpr size_t MAX_WRITE_BUFFERS = 64;
+
   BaseTransport& m_transport;
 
   typename Protocol::socket m_socket;
   uint8_t m_inputBuffer[MAX_NDN_PACKET_SIZE];
   size_t m_inputBufferSize = 0;
   TransmissionQueue m_transmissionQueue;
+  std::vector<boost::asio::const_buffer> m_writeBuffers;
   boost::asio::steady_timer m_connectTimer;
 };
 
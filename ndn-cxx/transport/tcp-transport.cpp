@@ -98,6 +98,13 @@ TcpTransport::send(const Block& wire)
   m_impl->send(wire);
 }
 
+void
+TcpTransport::sendBatch(span<const Block> wires)
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  m_impl->send(wires);
+}
+
 void
 TcpTransport::close()
 {
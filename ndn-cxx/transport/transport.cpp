@@ -37,4 +37,12 @@ Transport::connect(boost::asio::io_service& ioService, ReceiveCallback receiveCa
   m_receiveCallback = std::move(receiveCallback);
 }
 
+void
+Transport::sendBatch(span<const Block> blocks)
+{
+  for (const auto& block : blocks) {
+    send(block);
+  }
+}
+
 } // namespace ndn
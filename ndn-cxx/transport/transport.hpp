@@ -25,6 +25,9 @@
 #include "ndn-cxx/detail/asio-fwd.hpp"
 #include "ndn-cxx/detail/common.hpp"
 #include "ndn-cxx/encoding/block.hpp"
+#include "ndn-cxx/util/span.hpp"
+
+#include <atomic>
 
 #include <boost/system/error_code.hpp>
 
@@ -78,6 +81,15 @@ public:
   virtual void
   send(const Block& block) = 0;
 
+  /**
+   * \brief Send a sequence of TLV blocks through the transport.
+   *
+   * The default implementation invokes send() on each block in order. Subclasses may override
+   * this function to hand the whole sequence to the underlying socket in fewer operations.
+   */
+  virtual void
+  sendBatch(span<const Block> blocks);
+
   /**
    * \brief Pause the transport, canceling all pending operations.
    * \post the receive callback will not be invoked
@@ -105,6 +117,16 @@ public:
     return m_state;
   }
 
+  /**
+   * \brief Return the number of packets that have been sent but not yet fully written.
+   * \note This function may be called from any thread.
+   */
+  size_t
+  getSendQueueLength() const noexcept
+  {
+    return m_sendQueueLength.load(std::memory_order_relaxed);
+  }
+
 protected:
   void
   setState(State state) noexcept
@@ -112,12 +134,19 @@ protected:
     m_state = state;
   }
 
+  void
+  setSendQueueLength(size_t length) noexcept
+  {
+    m_sendQueueLength.store(length, std::memory_order_relaxed);
+  }
+
 protected:
   boost::asio::io_service* m_ioService = nullptr;
   ReceiveCallback m_receiveCallback;
 
 private:
   State m_state = State::CLOSED;
+  std::atomic<size_t> m_sendQueueLength{0};
 };
 
 } // namespace ndn
@@ -96,6 +96,13 @@ UnixTransport::send(const Block& wire)
   m_impl->send(wire);
 }
 
+void
+UnixTransport::sendBatch(span<const Block> wires)
+{
+  BOOST_ASSERT(m_impl != nullptr);
+  m_impl->send(wires);
+}
+
 void
 UnixTransport::close()
 {
@@ -60,6 +60,9 @@ public:
   void
   send(const Block& wire) override;
 
+  void
+  sendBatch(span<const Block> wires) override;
+
   /** \brief Create transport with parameters defined in URI.
    *  \throw Transport::Error incorrect URI or unsupported protocol is specified
    */
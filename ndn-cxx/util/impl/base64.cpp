@@ -0,0 +1,255 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/impl/base64.hpp"
+#include "ndn-cxx/util/impl/simd-codec.hpp"
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+static const uint8_t ENCODING_TABLE[] =
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+const size_t LINE_LENGTH = 64;
+
+const uint8_t SKIP = 0x40;
+const uint8_t PAD = 0x41;
+const uint8_t BAD = 0xFF;
+
+// base64 decoding table: 6-bit value, or one of the above markers
+static const uint8_t DECODING_TABLE[] = {
+//   0    1    2    3    4    5    6    7    8    9    A    B    C    D    E    F
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,SKIP,SKIP,SKIP,SKIP,SKIP, BAD, BAD, // 0x00
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0x10
+ SKIP, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,  62, BAD, BAD, BAD,  63, // 0x20
+   52,  53,  54,  55,  56,  57,  58,  59,  60,  61, BAD, BAD, BAD, PAD, BAD, BAD, // 0x30
+  BAD,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14, // 0x40
+   15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, BAD, BAD, BAD, BAD, BAD, // 0x50
+  BAD,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40, // 0x60
+   41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, BAD, BAD, BAD, BAD, BAD, // 0x70
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0x80
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0x90
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0xA0
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0xB0
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0xC0
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0xD0
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0xE0
+  BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, // 0xF0
+};
+static_assert(std::extent<decltype(DECODING_TABLE)>::value == 256, "");
+
+size_t
+Base64Encoder::getMaxOutputSize(size_t nBytes) const noexcept
+{
+  size_t nChars = (m_nPending + nBytes + 2) / 3 * 4;
+  if (!m_needBreak)
+    return nChars;
+  return nChars + (m_lineLength + nChars) / LINE_LENGTH + 1;
+}
+
+uint8_t*
+Base64Encoder::encodeGroups(const uint8_t* input, size_t nGroups, uint8_t* output) noexcept
+{
+  while (nGroups > 0) {
+    // encode up to the end of the current line
+    size_t nRun = m_needBreak ? std::min(nGroups, (LINE_LENGTH - m_lineLength) / 4) : nGroups;
+    size_t nVector = encodeBase64Blocks(input, nRun * 3, output) / 3;
+    input += nVector * 3;
+    output += nVector * 4;
+    for (size_t i = nVector; i < nRun; ++i) {
+      uint32_t v = (uint32_t(input[0]) << 16) | (uint32_t(input[1]) << 8) | input[2];
+      output[0] = ENCODING_TABLE[v >> 18];
+      output[1] = ENCODING_TABLE[(v >> 12) & 0x3F];
+      output[2] = ENCODING_TABLE[(v >> 6) & 0x3F];
+      output[3] = ENCODING_TABLE[v & 0x3F];
+      input += 3;
+      output += 4;
+    }
+    nGroups -= nRun;
+
+    if (m_needBreak) {
+      m_lineLength += nRun * 4;
+      if (m_lineLength == LINE_LENGTH) {
+        *output++ = '\n';
+        m_lineLength = 0;
+      }
+    }
+  }
+  return output;
+}
+
+size_t
+Base64Encoder::update(span<const uint8_t> input, uint8_t* output) noexcept
+{
+  uint8_t* out = output;
+
+  if (m_nPending > 0) {
+    uint8_t group[3] = {m_pending[0], m_pending[1]};
+    size_t nNeeded = 3 - m_nPending;
+    if (input.size() < nNeeded) {
+      std::copy(input.begin(), input.end(), m_pending + m_nPending);
+      m_nPending += input.size();
+      return 0;
+    }
+    std::copy_n(input.begin(), nNeeded, group + m_nPending);
+    out = encodeGroups(group, 1, out);
+    input = input.subspan(nNeeded);
+    m_nPending = 0;
+  }
+
+  size_t nGroups = input.size() / 3;
+  out = encodeGroups(input.data(), nGroups, out);
+
+  m_nPending = input.size() - nGroups * 3;
+  std::copy_n(input.begin() + nGroups * 3, m_nPending, m_pending);
+  return static_cast<size_t>(out - output);
+}
+
+size_t
+Base64Encoder::finish(uint8_t* output) noexcept
+{
+  uint8_t* out = output;
+
+  if (m_nPending > 0) {
+    uint32_t v = uint32_t(m_pending[0]) << 16;
+    if (m_nPending == 2) {
+      v |= uint32_t(m_pending[1]) << 8;
+    }
+    out[0] = ENCODING_TABLE[v >> 18];
+    out[1] = ENCODING_TABLE[(v >> 12) & 0x3F];
+    out[2] = m_nPending == 2 ? ENCODING_TABLE[(v >> 6) & 0x3F] : '=';
+    out[3] = '=';
+    out += 4;
+    m_lineLength += 4;
+    m_nPending = 0;
+  }
+
+  if (m_needBreak && m_lineLength > 0) {
+    *out++ = '\n';
+  }
+  m_lineLength = 0;
+  return static_cast<size_t>(out - output);
+}
+
+size_t
+Base64Decoder::getMaxOutputSize(size_t nChars) const noexcept
+{
+  return (m_nChars + nChars + 3) / 4 * 3;
+}
+
+bool
+Base64Decoder::update(span<const uint8_t> input, uint8_t* output, size_t& nWritten) noexcept
+{
+  const uint8_t* in = input.data();
+  const uint8_t* end = in + input.size();
+  uint8_t* out = output;
+
+  while (in != end) {
+    if (m_nChars == 0 && m_nPadding == 0) {
+      // fast path: whole groups of four data characters
+      size_t nVector = decodeBase64Blocks(in, static_cast<size_t>(end - in), out);
+      in += nVector;
+      out += nVector / 4 * 3;
+      while (end - in >= 4) {
+        uint32_t a = DECODING_TABLE[in[0]];
+        uint32_t b = DECODING_TABLE[in[1]];
+        uint32_t c = DECODING_TABLE[in[2]];
+        uint32_t d = DECODING_TABLE[in[3]];
+        if ((a | b | c | d) & 0xC0)
+          break;
+
+        uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+        out[0] = static_cast<uint8_t>(v >> 16);
+        out[1] = static_cast<uint8_t>(v >> 8);
+        out[2] = static_cast<uint8_t>(v);
+        in += 4;
+        out += 3;
+      }
+      if (in == end)
+        break;
+    }
+
+    uint8_t v = DECODING_TABLE[*in++];
+    if (v == SKIP) {
+      continue;
+    }
+    if (v == BAD) {
+      return false;
+    }
+
+    if (v == PAD) {
+      // padding can only complete a group that has at least two data characters
+      if (m_nChars < 2 || m_nChars + m_nPadding >= 4)
+        return false;
+      ++m_nPadding;
+      continue;
+    }
+
+    if (m_nPadding > 0) {
+      // data after padding
+      return false;
+    }
+
+    m_bits = (m_bits << 6) | v;
+    if (++m_nChars == 4) {
+      out[0] = static_cast<uint8_t>(m_bits >> 16);
+      out[1] = static_cast<uint8_t>(m_bits >> 8);
+      out[2] = static_cast<uint8_t>(m_bits);
+      out += 3;
+      m_bits = 0;
+      m_nChars = 0;
+    }
+  }
+
+  nWritten = static_cast<size_t>(out - output);
+  return true;
+}
+
+bool
+Base64Decoder::finish(uint8_t* output, size_t& nWritten) noexcept
+{
+  nWritten = 0;
+  switch (m_nChars) {
+  case 0:
+    break;
+  case 1:
+    return false;
+  case 2:
+    output[0] = static_cast<uint8_t>(m_bits >> 4);
+    nWritten = 1;
+    break;
+  case 3:
+    output[0] = static_cast<uint8_t>(m_bits >> 10);
+    output[1] = static_cast<uint8_t>(m_bits >> 2);
+    nWritten = 2;
+    break;
+  }
+
+  m_bits = 0;
+  m_nChars = 0;
+  m_nPadding = 0;
+  return true;
+}
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
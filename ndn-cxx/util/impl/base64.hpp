@@ -0,0 +1,114 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_IMPL_BASE64_HPP
+#define NDN_CXX_UTIL_IMPL_BASE64_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/util/span.hpp"
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+/** \brief Incremental base64 encoder (RFC 4648, Section 4).
+ *
+ *  If line breaks are requested, the output is formatted like OpenSSL's base64 BIO: lines of
+ *  64 characters, each followed by a newline, including the last (possibly shorter) line.
+ */
+class Base64Encoder
+{
+public:
+  explicit
+  Base64Encoder(bool needBreak = true) noexcept
+    : m_needBreak(needBreak)
+  {
+  }
+
+  /** \brief Return the maximum number of characters written by encoding \p nBytes more
+   *         bytes and finishing.
+   */
+  size_t
+  getMaxOutputSize(size_t nBytes) const noexcept;
+
+  /** \brief Encode \p input into \p output, which must be at least getMaxOutputSize() long.
+   *  \return the number of characters written
+   */
+  size_t
+  update(span<const uint8_t> input, uint8_t* output) noexcept;
+
+  /** \brief Encode the pending bytes with padding, and terminate the last line.
+   *  \return the number of characters written, at most 5
+   */
+  size_t
+  finish(uint8_t* output) noexcept;
+
+private:
+  uint8_t*
+  encodeGroups(const uint8_t* input, size_t nGroups, uint8_t* output) noexcept;
+
+private:
+  bool m_needBreak;
+  uint8_t m_pending[2] = {};
+  size_t m_nPending = 0;
+  size_t m_lineLength = 0;
+};
+
+/** \brief Incremental base64 decoder (RFC 4648, Section 4).
+ *
+ *  ASCII whitespace, including newlines, is ignored anywhere in the input. Padding may be
+ *  omitted at the end of the input. Characters outside of the base64 alphabet and data
+ *  characters following padding are rejected.
+ */
+class Base64Decoder
+{
+public:
+  /** \brief Return the maximum number of bytes written by decoding \p nChars more characters
+   *         and finishing.
+   */
+  size_t
+  getMaxOutputSize(size_t nChars) const noexcept;
+
+  /** \brief Decode \p input into \p output, which must be at least getMaxOutputSize() long.
+   *  \param[out] nWritten the number of bytes written
+   *  \return false if the input is invalid
+   */
+  NDN_CXX_NODISCARD bool
+  update(span<const uint8_t> input, uint8_t* output, size_t& nWritten) noexcept;
+
+  /** \brief Decode the last incomplete group, which ends with padding or has no padding.
+   *  \param[out] nWritten the number of bytes written, at most 2
+   *  \return false if the input is incomplete
+   */
+  NDN_CXX_NODISCARD bool
+  finish(uint8_t* output, size_t& nWritten) noexcept;
+
+private:
+  uint32_t m_bits = 0;
+  size_t m_nChars = 0;
+  size_t m_nPadding = 0;
+};
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_IMPL_BASE64_HPP
@@ -0,0 +1,457 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/impl/simd-codec.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define NDN_CXX_HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+#ifdef NDN_CXX_HAVE_X86_SIMD
+
+// The kernels are compiled for their instruction set with function attributes, so that the
+// library itself does not require it; the CPU is checked at run time before they are called.
+#define NDN_CXX_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define NDN_CXX_TARGET_AVX2 __attribute__((target("avx2")))
+
+// ---- SSSE3 ----
+
+/** \brief Return a mask of the bytes of \p v that are in [\p lo, \p hi].
+ *
+ *  Comparisons are signed, so bytes above 0x7F are never in a printable ASCII range.
+ */
+NDN_CXX_TARGET_SSSE3 static inline __m128i
+inRange128(__m128i v, char lo, char hi)
+{
+  return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(static_cast<char>(lo - 1))),
+                       _mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(hi + 1))));
+}
+
+/** \brief Split 12 bytes of \p in into 16 6-bit base64 indices, one per byte.
+ */
+NDN_CXX_TARGET_SSSE3 static inline __m128i
+base64Indices128(__m128i in)
+{
+  // each 32-bit lane receives bytes [1 0 2 1] of a 3-byte group
+  in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  // move the first and third indices into bytes 0 and 2, the second and fourth into bytes 1 and 3
+  __m128i ac = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)),
+                               _mm_set1_epi32(0x04000040));
+  __m128i bd = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)),
+                               _mm_set1_epi32(0x01000010));
+  return _mm_or_si128(ac, bd);
+}
+
+/** \brief Translate base64 indices to characters of the alphabet.
+ */
+NDN_CXX_TARGET_SSSE3 static inline __m128i
+base64Chars128(__m128i indices)
+{
+  __m128i shift = _mm_set1_epi8('A');
+  shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(25)),
+                                            _mm_set1_epi8('a' - 26 - 'A')));
+  shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(51)),
+                                            _mm_set1_epi8('0' - 52 - ('a' - 26))));
+  shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(61)),
+                                            _mm_set1_epi8('+' - 62 - ('0' - 52))));
+  shift = _mm_add_epi8(shift, _mm_and_si128(_mm_cmpgt_epi8(indices, _mm_set1_epi8(62)),
+                                            _mm_set1_epi8('/' - 63 - ('+' - 62))));
+  return _mm_add_epi8(indices, shift);
+}
+
+/** \brief Decode 16 base64 characters into 12 bytes, placed at the beginning of \p out.
+ *  \return false if any character is not in the base64 alphabet
+ */
+NDN_CXX_TARGET_SSSE3 static inline bool
+decodeBase64Lane128(__m128i in, __m128i& out)
+{
+  __m128i upper = inRange128(in, 'A', 'Z');
+  __m128i lower = inRange128(in, 'a', 'z');
+  __m128i digit = inRange128(in, '0', '9');
+  __m128i plus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+  __m128i slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+  __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower),
+                               _mm_or_si128(digit, _mm_or_si128(plus, slash)));
+  if (_mm_movemask_epi8(valid) != 0xFFFF) {
+    return false;
+  }
+
+  __m128i shift = _mm_or_si128(
+    _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')),
+                 _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+    _mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+                 _mm_or_si128(_mm_and_si128(plus, _mm_set1_epi8(62 - '+')),
+                              _mm_and_si128(slash, _mm_set1_epi8(63 - '/')))));
+  __m128i indices = _mm_add_epi8(in, shift);
+
+  // combine pairs of indices into 12 bits, then pairs of those into 24 bits per 32-bit lane
+  __m128i pairs = _mm_maddubs_epi16(indices, _mm_set1_epi32(0x01400140));
+  __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+  out = _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12,
+                                               -1, -1, -1, -1));
+  return true;
+}
+
+NDN_CXX_TARGET_SSSE3 static inline void
+store12(uint8_t* output, __m128i v)
+{
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(output), v);
+  uint32_t last = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(v, 8)));
+  std::memcpy(output + 8, &last, sizeof(last));
+}
+
+/** \brief Convert 16 hex digits into their values, one per byte.
+ *  \return false if any character is not a hex digit
+ */
+NDN_CXX_TARGET_SSSE3 static inline bool
+hexValues128(__m128i in, __m128i& out)
+{
+  __m128i digit = inRange128(in, '0', '9');
+  __m128i upper = inRange128(in, 'A', 'F');
+  __m128i lower = inRange128(in, 'a', 'f');
+  if (_mm_movemask_epi8(_mm_or_si128(digit, _mm_or_si128(upper, lower))) != 0xFFFF) {
+    return false;
+  }
+
+  __m128i shift = _mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(-'0')),
+                               _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(10 - 'A')),
+                                            _mm_and_si128(lower, _mm_set1_epi8(10 - 'a'))));
+  out = _mm_add_epi8(in, shift);
+  return true;
+}
+
+NDN_CXX_TARGET_SSSE3 static size_t
+encodeBase64Ssse3(const uint8_t* input, size_t size, uint8_t* output)
+{
+  size_t i = 0;
+  // 12 bytes are encoded per iteration, but 16 are loaded
+  for (; i + 16 <= size; i += 12, output += 16) {
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), base64Chars128(base64Indices128(in)));
+  }
+  return i;
+}
+
+NDN_CXX_TARGET_SSSE3 static size_t
+decodeBase64Ssse3(const uint8_t* input, size_t size, uint8_t* output)
+{
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16, output += 12) {
+    __m128i out;
+    if (!decodeBase64Lane128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), out)) {
+      break;
+    }
+    store12(output, out);
+  }
+  return i;
+}
+
+NDN_CXX_TARGET_SSSE3 static size_t
+encodeHexSsse3(const uint8_t* input, size_t size, char* output, const char* digits)
+{
+  __m128i table = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+  __m128i mask = _mm_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 16 <= size; i += 16) {
+    __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+    __m128i hi = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+    __m128i lo = _mm_shuffle_epi8(table, _mm_and_si128(in, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * i), _mm_unpacklo_epi8(hi, lo));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+  }
+  return i;
+}
+
+NDN_CXX_TARGET_SSSE3 static size_t
+decodeHexSsse3(const char* input, size_t size, uint8_t* output)
+{
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    __m128i a, b;
+    if (!hexValues128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i)), a) ||
+        !hexValues128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 16)), b)) {
+      break;
+    }
+    // high nibble * 16 + low nibble, for each pair of digits
+    __m128i weights = _mm_set1_epi16(0x0110);
+    __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(a, weights), _mm_maddubs_epi16(b, weights));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i / 2), bytes);
+  }
+  return i;
+}
+
+// ---- AVX2 ----
+// The same algorithms on two 128-bit lanes; shuffles and packs operate within each lane.
+
+NDN_CXX_TARGET_AVX2 static inline __m256i
+inRange256(__m256i v, char lo, char hi)
+{
+  return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(static_cast<char>(lo - 1))),
+                          _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(hi + 1)), v));
+}
+
+NDN_CXX_TARGET_AVX2 static inline __m256i
+broadcast128(__m128i v)
+{
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(v), v, 1);
+}
+
+NDN_CXX_TARGET_AVX2 static size_t
+encodeBase64Avx2(const uint8_t* input, size_t size, uint8_t* output)
+{
+  const __m256i shuffle = broadcast128(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+  size_t i = 0;
+  // 24 bytes are encoded per iteration, 12 in each lane, but 28 are loaded
+  for (; i + 28 <= size; i += 24, output += 32) {
+    __m256i in = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))),
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i + 12)), 1);
+    in = _mm256_shuffle_epi8(in, shuffle);
+    __m256i ac = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)),
+                                    _mm256_set1_epi32(0x04000040));
+    __m256i bd = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)),
+                                    _mm256_set1_epi32(0x01000010));
+    __m256i indices = _mm256_or_si256(ac, bd);
+
+    __m256i shift = _mm256_set1_epi8('A');
+    shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpgt_epi8(indices, _mm256_set1_epi8(25)),
+                                                    _mm256_set1_epi8('a' - 26 - 'A')));
+    shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpgt_epi8(indices, _mm256_set1_epi8(51)),
+                                                    _mm256_set1_epi8('0' - 52 - ('a' - 26))));
+    shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpgt_epi8(indices, _mm256_set1_epi8(61)),
+                                                    _mm256_set1_epi8('+' - 62 - ('0' - 52))));
+    shift = _mm256_add_epi8(shift, _mm256_and_si256(_mm256_cmpgt_epi8(indices, _mm256_set1_epi8(62)),
+                                                    _mm256_set1_epi8('/' - 63 - ('+' - 62))));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), _mm256_add_epi8(indices, shift));
+  }
+  return i + encodeBase64Ssse3(input + i, size - i, output);
+}
+
+NDN_CXX_TARGET_AVX2 static size_t
+decodeBase64Avx2(const uint8_t* input, size_t size, uint8_t* output)
+{
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32, output += 24) {
+    __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+    __m256i upper = inRange256(in, 'A', 'Z');
+    __m256i lower = inRange256(in, 'a', 'z');
+    __m256i digit = inRange256(in, '0', '9');
+    __m256i plus = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('+'));
+    __m256i slash = _mm256_cmpeq_epi8(in, _mm256_set1_epi8('/'));
+    __m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower),
+                                    _mm256_or_si256(digit, _mm256_or_si256(plus, slash)));
+    if (_mm256_movemask_epi8(valid) != -1) {
+      break;
+    }
+
+    __m256i shift = _mm256_or_si256(
+      _mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+                      _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+      _mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+                      _mm256_or_si256(_mm256_and_si256(plus, _mm256_set1_epi8(62 - '+')),
+                                      _mm256_and_si256(slash, _mm256_set1_epi8(63 - '/')))));
+    __m256i indices = _mm256_add_epi8(in, shift);
+    __m256i pairs = _mm256_maddubs_epi16(indices, _mm256_set1_epi32(0x01400140));
+    __m256i groups = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+    __m256i bytes = _mm256_shuffle_epi8(groups, broadcast128(
+                      _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+    // move the 12 bytes of the second lane next to those of the first
+    bytes = _mm256_permutevar8x32_epi32(bytes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm256_castsi256_si128(bytes));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(output + 16), _mm256_extracti128_si256(bytes, 1));
+  }
+  return i + decodeBase64Ssse3(input + i, size - i, output);
+}
+
+NDN_CXX_TARGET_AVX2 static size_t
+encodeHexAvx2(const uint8_t* input, size_t size, char* output, const char* digits)
+{
+  __m256i table = broadcast128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)));
+  __m256i mask = _mm256_set1_epi8(0x0F);
+  size_t i = 0;
+  for (; i + 32 <= size; i += 32) {
+    __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+    __m256i hi = _mm256_shuffle_epi8(table, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+    __m256i lo = _mm256_shuffle_epi8(table, _mm256_and_si256(in, mask));
+    // unpacking interleaves within each lane: [0-7 16-23] and [8-15 24-31]
+    __m256i first = _mm256_unpacklo_epi8(hi, lo);
+    __m256i second = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2 * i),
+                        _mm256_permute2x128_si256(first, second, 0x20));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 2 * i + 32),
+                        _mm256_permute2x128_si256(first, second, 0x31));
+  }
+  return i + encodeHexSsse3(input + i, size - i, output + 2 * i, digits);
+}
+
+NDN_CXX_TARGET_AVX2 static inline bool
+hexValues256(__m256i in, __m256i& out)
+{
+  __m256i digit = inRange256(in, '0', '9');
+  __m256i upper = inRange256(in, 'A', 'F');
+  __m256i lower = inRange256(in, 'a', 'f');
+  if (_mm256_movemask_epi8(_mm256_or_si256(digit, _mm256_or_si256(upper, lower))) != -1) {
+    return false;
+  }
+
+  __m256i shift = _mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(-'0')),
+                                  _mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(10 - 'A')),
+                                                  _mm256_and_si256(lower, _mm256_set1_epi8(10 - 'a'))));
+  out = _mm256_add_epi8(in, shift);
+  return true;
+}
+
+NDN_CXX_TARGET_AVX2 static size_t
+decodeHexAvx2(const char* input, size_t size, uint8_t* output)
+{
+  size_t i = 0;
+  for (; i + 64 <= size; i += 64) {
+    __m256i a, b;
+    if (!hexValues256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i)), a) ||
+        !hexValues256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i + 32)), b)) {
+      break;
+    }
+    __m256i weights = _mm256_set1_epi16(0x0110);
+    __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights),
+                                        _mm256_maddubs_epi16(b, weights));
+    // packing interleaves the lanes of its operands
+    bytes = _mm256_permute4x64_epi64(bytes, 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i / 2), bytes);
+  }
+  return i + decodeHexSsse3(input + i, size - i, output + i / 2);
+}
+
+#endif // NDN_CXX_HAVE_X86_SIMD
+
+SimdLevel
+getSupportedSimdLevel() noexcept
+{
+#ifdef NDN_CXX_HAVE_X86_SIMD
+  static const SimdLevel level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdLevel::AVX2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+      return SimdLevel::SSSE3;
+    }
+    return SimdLevel::NONE;
+  }();
+  return level;
+#else
+  return SimdLevel::NONE;
+#endif
+}
+
+static std::atomic<SimdLevel>&
+getSelectedLevel() noexcept
+{
+  static std::atomic<SimdLevel> level{getSupportedSimdLevel()};
+  return level;
+}
+
+SimdLevel
+getSimdLevel() noexcept
+{
+  return getSelectedLevel().load(std::memory_order_relaxed);
+}
+
+SimdLevel
+setSimdLevel(SimdLevel level) noexcept
+{
+  level = std::min(level, getSupportedSimdLevel());
+  getSelectedLevel().store(level, std::memory_order_relaxed);
+  return level;
+}
+
+size_t
+encodeBase64Blocks(const uint8_t* input, size_t size, uint8_t* output) noexcept
+{
+  switch (getSimdLevel()) {
+#ifdef NDN_CXX_HAVE_X86_SIMD
+    case SimdLevel::AVX2:
+      return encodeBase64Avx2(input, size, output);
+    case SimdLevel::SSSE3:
+      return encodeBase64Ssse3(input, size, output);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t
+decodeBase64Blocks(const uint8_t* input, size_t size, uint8_t* output) noexcept
+{
+  switch (getSimdLevel()) {
+#ifdef NDN_CXX_HAVE_X86_SIMD
+    case SimdLevel::AVX2:
+      return decodeBase64Avx2(input, size, output);
+    case SimdLevel::SSSE3:
+      return decodeBase64Ssse3(input, size, output);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t
+encodeHexBlocks(const uint8_t* input, size_t size, char* output, bool wantUpperCase) noexcept
+{
+  const char* digits = wantUpperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+  switch (getSimdLevel()) {
+#ifdef NDN_CXX_HAVE_X86_SIMD
+    case SimdLevel::AVX2:
+      return encodeHexAvx2(input, size, output, digits);
+    case SimdLevel::SSSE3:
+      return encodeHexSsse3(input, size, output, digits);
+#endif
+    default:
+      return 0;
+  }
+}
+
+size_t
+decodeHexBlocks(const char* input, size_t size, uint8_t* output) noexcept
+{
+  switch (getSimdLevel()) {
+#ifdef NDN_CXX_HAVE_X86_SIMD
+    case SimdLevel::AVX2:
+      return decodeHexAvx2(input, size, output);
+    case SimdLevel::SSSE3:
+      return decodeHexSsse3(input, size, output);
+#endif
+    default:
+      return 0;
+  }
+}
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
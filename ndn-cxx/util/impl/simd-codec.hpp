@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_IMPL_SIMD_CODEC_HPP
+#define NDN_CXX_UTIL_IMPL_SIMD_CODEC_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+/** \brief Vector instruction set used by the bulk hex and base64 kernels.
+ */
+enum class SimdLevel {
+  NONE,  ///< portable scalar code only
+  SSSE3, ///< 128-bit kernels
+  AVX2,  ///< 256-bit kernels
+};
+
+/** \brief Return the highest SimdLevel supported by the compiler and the running CPU.
+ */
+SimdLevel
+getSupportedSimdLevel() noexcept;
+
+/** \brief Return the SimdLevel used by the kernels, which is getSupportedSimdLevel() unless
+ *         overridden with setSimdLevel().
+ */
+SimdLevel
+getSimdLevel() noexcept;
+
+/** \brief Select the SimdLevel used by the kernels, e.g., to test every implementation.
+ *  \return the level actually selected, which is at most getSupportedSimdLevel()
+ *  \note Intended for tests and benchmarks; the selection applies process-wide.
+ */
+SimdLevel
+setSimdLevel(SimdLevel level) noexcept;
+
+/** \brief Encode whole 3-byte groups of \p input as base64, without line breaks.
+ *
+ *  Only a prefix of \p input is encoded, whose size is a multiple of 3. The remainder is
+ *  left for the scalar code. No byte outside of \p input is read.
+ *
+ *  \return the number of bytes consumed; 4/3 as many characters were written to \p output
+ */
+size_t
+encodeBase64Blocks(const uint8_t* input, size_t size, uint8_t* output) noexcept;
+
+/** \brief Decode whole 4-character groups of base64 data characters.
+ *
+ *  Decoding stops before the first block of characters that contains whitespace, padding, or
+ *  a character outside of the alphabet, which is left for the scalar code.
+ *
+ *  \return the number of characters consumed, a multiple of 4; 3/4 as many bytes were
+ *          written to \p output
+ */
+size_t
+decodeBase64Blocks(const uint8_t* input, size_t size, uint8_t* output) noexcept;
+
+/** \brief Encode a prefix of \p input as hex digits.
+ *  \return the number of bytes consumed; twice as many characters were written to \p output
+ */
+size_t
+encodeHexBlocks(const uint8_t* input, size_t size, char* output, bool wantUpperCase) noexcept;
+
+/** \brief Decode a prefix of \p input consisting of pairs of hex digits.
+ *
+ *  Decoding stops before the first block of characters that contains a non-hex character.
+ *
+ *  \return the number of characters consumed, a multiple of 2; half as many bytes were
+ *          written to \p output
+ */
+size_t
+decodeHexBlocks(const char* input, size_t size, uint8_t* output) noexcept;
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_IMPL_SIMD_CODEC_HPP
@@ -0,0 +1,367 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/impl/trace-backend.hpp"
+
+#include <algorithm>
+#include <cinttypes> // for PRIdLEAST64
+#include <cstdio>    // for std::snprintf()
+#include <cstdlib>   // for std::abs(), std::atexit()
+#include <iomanip>
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+static_assert(sizeof(TraceBackend::RecordHeader) == 16, "RecordHeader must not have padding");
+
+/** \brief Interval at which the background thread writes captured records.
+ */
+static const std::chrono::milliseconds DRAIN_INTERVAL(100);
+
+static size_t
+roundCapacity(size_t capacity)
+{
+  size_t rounded = 4096;
+  while (rounded < capacity) {
+    rounded <<= 1;
+  }
+  return rounded;
+}
+
+TraceRing::TraceRing(size_t capacity)
+  : m_buffer(new uint8_t[roundCapacity(capacity)])
+  , m_mask(roundCapacity(capacity) - 1)
+{
+}
+
+bool
+TraceRing::write(const uint8_t* first, size_t firstSize, const uint8_t* second, size_t secondSize) noexcept
+{
+  const size_t capacity = m_mask + 1;
+  const auto size = static_cast<uint32_t>(firstSize + secondSize);
+  const size_t slotSize = getSlotSize(size);
+
+  uint64_t writePos = m_writePos.load(std::memory_order_relaxed);
+  size_t offset = static_cast<size_t>(writePos) & m_mask;
+  // a record never straddles the end of the buffer
+  size_t padding = offset + slotSize > capacity ? capacity - offset : 0;
+
+  uint64_t readPos = m_readPos.load(std::memory_order_acquire);
+  if (writePos - readPos + padding + slotSize > capacity) {
+    return false;
+  }
+
+  if (padding > 0) {
+    uint32_t marker = WRAP_MARKER;
+    std::memcpy(&m_buffer[offset], &marker, sizeof(marker));
+    writePos += padding;
+    offset = 0;
+  }
+
+  std::memcpy(&m_buffer[offset], &size, sizeof(size));
+  std::memcpy(&m_buffer[offset + sizeof(size)], first, firstSize);
+  std::memcpy(&m_buffer[offset + sizeof(size) + firstSize], second, secondSize);
+  m_writePos.store(writePos + slotSize, std::memory_order_release);
+  return true;
+}
+
+namespace {
+
+struct ThreadRing
+{
+  shared_ptr<TraceRing> ring;
+  uint64_t generation = 0;
+};
+
+thread_local ThreadRing t_threadRing;
+
+} // unnamed namespace
+
+TraceBackend&
+TraceBackend::get()
+{
+  // The instance is intentionally leaked, so that it outlives all threads that may log.
+  static TraceBackend* instance = new TraceBackend;
+  return *instance;
+}
+
+uint32_t
+TraceBackend::registerModule(const std::string& moduleName)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto it = m_moduleIds.emplace(moduleName, static_cast<uint32_t>(m_moduleNames.size()));
+  if (it.second) {
+    m_moduleNames.push_back(moduleName);
+  }
+  return it.first->second;
+}
+
+void
+TraceBackend::setDestination(shared_ptr<std::ostream> os, size_t bufferSize)
+{
+  std::thread thread;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    TraceRecord::s_isActive.store(false, std::memory_order_relaxed);
+    m_shouldStop = true;
+    thread = std::move(m_thread);
+  }
+  m_cv.notify_all();
+  if (thread.joinable()) {
+    thread.join();
+  }
+
+  bool isActive = os != nullptr;
+  {
+    std::lock_guard<std::mutex> lock(m_drainMutex);
+    drain();
+    m_os = std::move(os);
+  }
+  if (!isActive) {
+    return;
+  }
+
+  static bool isAtExitRegistered = false;
+  if (!isAtExitRegistered) {
+    std::atexit([] { TraceBackend::get().flush(); });
+    isAtExitRegistered = true;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  // threads allocate new ring buffers of the requested size upon their next record
+  m_rings.clear();
+  m_bufferSize = bufferSize;
+  m_generation.fetch_add(1, std::memory_order_release);
+  m_nDropped = 0;
+  m_shouldStop = false;
+  m_thread = std::thread([this] { run(); });
+  TraceRecord::s_isActive.store(true, std::memory_order_relaxed);
+}
+
+void
+TraceBackend::flush()
+{
+  std::lock_guard<std::mutex> lock(m_drainMutex);
+  drain();
+}
+
+void
+TraceBackend::commit(const TraceRecord& record) noexcept
+{
+  if (!TraceRecord::isActive()) {
+    return;
+  }
+
+  RecordHeader header{record.m_timestamp, record.m_moduleId, static_cast<int8_t>(record.m_level),
+                      record.m_isTruncated, record.m_argsSize};
+
+  TraceRing* ring = nullptr;
+  try {
+    ring = getThreadRing();
+  }
+  catch (const std::bad_alloc&) {
+  }
+
+  if (ring == nullptr ||
+      !ring->write(reinterpret_cast<const uint8_t*>(&header), sizeof(header),
+                   record.m_args, record.m_argsSize)) {
+    m_nDropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+TraceRing*
+TraceBackend::getThreadRing()
+{
+  ThreadRing& tr = t_threadRing;
+  if (tr.ring == nullptr || tr.generation != m_generation.load(std::memory_order_acquire)) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    tr.ring = make_shared<TraceRing>(m_bufferSize);
+    tr.generation = m_generation.load(std::memory_order_relaxed);
+    m_rings.push_back(tr.ring);
+  }
+  return tr.ring.get();
+}
+
+void
+TraceBackend::run()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while (!m_shouldStop) {
+    m_cv.wait_for(lock, DRAIN_INTERVAL);
+    lock.unlock();
+    flush();
+    lock.lock();
+  }
+}
+
+void
+TraceBackend::drain()
+{
+  if (m_os == nullptr) {
+    return;
+  }
+
+  std::vector<shared_ptr<TraceRing>> rings;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    rings.reserve(m_rings.size());
+    for (auto it = m_rings.begin(); it != m_rings.end();) {
+      rings.push_back(*it);
+      // if the owning thread has exited, the ring is consumed for the last time
+      if (it->use_count() == 2) {
+        it = m_rings.erase(it);
+      }
+      else {
+        ++it;
+      }
+    }
+  }
+
+  // (timestamp, offset in m_drainBuffer)
+  std::vector<std::pair<int64_t, size_t>> records;
+  m_drainBuffer.clear();
+  for (const auto& ring : rings) {
+    ring->consume([&] (const uint8_t* record, size_t size) {
+      RecordHeader header;
+      std::memcpy(&header, record, sizeof(header));
+      records.emplace_back(header.timestamp, m_drainBuffer.size());
+      m_drainBuffer.insert(m_drainBuffer.end(), record, record + size);
+    });
+  }
+
+  {
+    // module names are registered before any record refers to them
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (size_t i = m_moduleNameCache.size(); i < m_moduleNames.size(); ++i) {
+      m_moduleNameCache.push_back(&m_moduleNames[i]);
+    }
+  }
+
+  // each ring is in timestamp order, but records from different threads are interleaved
+  std::stable_sort(records.begin(), records.end(),
+                   [] (const auto& a, const auto& b) { return a.first < b.first; });
+  for (const auto& record : records) {
+    formatRecord(&m_drainBuffer[record.second]);
+  }
+
+  uint64_t nDropped = m_nDropped.exchange(0, std::memory_order_relaxed);
+  if (nDropped > 0) {
+    *m_os << formatTimestamp(time::system_clock::now()) << "  WARN: [ndn.util.Logging] "
+          << nDropped << " log records dropped due to full trace buffer\n";
+  }
+
+  if (!records.empty() || nDropped > 0) {
+    m_os->flush();
+  }
+}
+
+void
+TraceBackend::formatRecord(const uint8_t* record)
+{
+  RecordHeader header;
+  std::memcpy(&header, record, sizeof(header));
+
+  std::ostream& os = *m_os;
+  os << formatTimestamp(time::system_clock::time_point(time::nanoseconds(header.timestamp)))
+     << " " << std::setw(5) << static_cast<LogLevel>(header.level) << ": "
+     << "[" << *m_moduleNameCache.at(header.moduleId) << "] ";
+
+  const uint8_t* pos = record + sizeof(header);
+  const uint8_t* end = pos + header.argsSize;
+  while (pos < end) {
+    auto type = static_cast<TraceRecord::ArgType>(*pos++);
+    switch (type) {
+      case TraceRecord::ArgType::INT: {
+        int64_t value;
+        std::memcpy(&value, pos, sizeof(value));
+        pos += sizeof(value);
+        os << value;
+        break;
+      }
+      case TraceRecord::ArgType::UINT: {
+        uint64_t value;
+        std::memcpy(&value, pos, sizeof(value));
+        pos += sizeof(value);
+        os << value;
+        break;
+      }
+      case TraceRecord::ArgType::DOUBLE: {
+        double value;
+        std::memcpy(&value, pos, sizeof(value));
+        pos += sizeof(value);
+        os << value;
+        break;
+      }
+      case TraceRecord::ArgType::CHAR: {
+        os << static_cast<char>(*pos++);
+        break;
+      }
+      case TraceRecord::ArgType::BOOL: {
+        os << (*pos++ != 0);
+        break;
+      }
+      case TraceRecord::ArgType::STRING: {
+        uint16_t len;
+        std::memcpy(&len, pos, sizeof(len));
+        pos += sizeof(len);
+        os.write(reinterpret_cast<const char*>(pos), len);
+        pos += len;
+        break;
+      }
+    }
+  }
+
+  if (header.isTruncated) {
+    os << "...";
+  }
+  os << "\n";
+}
+
+std::string
+formatTimestamp(time::system_clock::time_point tp)
+{
+  using namespace ndn::time;
+
+  const auto sinceEpoch = tp.time_since_epoch();
+  BOOST_ASSERT(sinceEpoch.count() >= 0);
+  // use abs() to silence truncation warning in snprintf(), see #4365
+  const auto usecs = std::abs(duration_cast<microseconds>(sinceEpoch).count());
+  const auto usecsPerSec = microseconds::period::den;
+
+  // 10 (whole seconds) + '.' + 6 (fraction) + '\0'
+  std::string buffer(10 + 1 + 6 + 1, '\0'); // note 1 extra byte still needed for snprintf
+  BOOST_ASSERT_MSG(usecs / usecsPerSec <= 9999999999, "whole seconds cannot fit in 10 characters");
+
+  static_assert(std::is_same<microseconds::rep, int_least64_t>::value,
+                "PRIdLEAST64 is incompatible with microseconds::rep");
+  std::snprintf(&buffer.front(), buffer.size(), "%" PRIdLEAST64 ".%06" PRIdLEAST64,
+                usecs / usecsPerSec, usecs % usecsPerSec);
+
+  // need to remove extra 1 byte ('\0')
+  buffer.pop_back();
+  return buffer;
+}
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
@@ -0,0 +1,198 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_UTIL_IMPL_TRACE_BACKEND_HPP
+#define NDN_CXX_UTIL_IMPL_TRACE_BACKEND_HPP
+
+#include "ndn-cxx/util/logger.hpp"
+#include "ndn-cxx/util/time.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace ndn {
+namespace util {
+namespace detail {
+
+/** \brief Single-producer single-consumer ring buffer of variable-length byte records.
+ *
+ *  Each record occupies a contiguous region: a 32-bit length followed by the record bytes,
+ *  padded to a multiple of 8 octets. A record that does not fit before the end of the buffer
+ *  is preceded by a wrap-around marker and written at the beginning.
+ */
+class TraceRing : noncopyable
+{
+public:
+  /** \param capacity buffer size in bytes, rounded up to a power of two
+   */
+  explicit
+  TraceRing(size_t capacity);
+
+  /** \brief Append a record consisting of the concatenation of two byte ranges.
+   *  \return whether the record has been appended, i.e., false if the buffer is full
+   *  \note This must be called from the producer thread only.
+   */
+  bool
+  write(const uint8_t* first, size_t firstSize, const uint8_t* second, size_t secondSize) noexcept;
+
+  /** \brief Invoke \p f on every available record, then release them.
+   *  \tparam F function of type `void f(const uint8_t* record, size_t size)`
+   *  \note This must be called from the consumer thread only.
+   */
+  template<typename F>
+  void
+  consume(const F& f)
+  {
+    uint64_t readPos = m_readPos.load(std::memory_order_relaxed);
+    uint64_t writePos = m_writePos.load(std::memory_order_acquire);
+    while (readPos != writePos) {
+      size_t offset = static_cast<size_t>(readPos) & m_mask;
+      uint32_t size = 0;
+      std::memcpy(&size, &m_buffer[offset], sizeof(size));
+      if (size == WRAP_MARKER) {
+        readPos += m_mask + 1 - offset;
+        continue;
+      }
+      f(&m_buffer[offset + sizeof(size)], size);
+      readPos += getSlotSize(size);
+    }
+    m_readPos.store(readPos, std::memory_order_release);
+  }
+
+  size_t
+  getCapacity() const noexcept
+  {
+    return m_mask + 1;
+  }
+
+private:
+  static size_t
+  getSlotSize(size_t recordSize) noexcept
+  {
+    return (sizeof(uint32_t) + recordSize + 7) & ~size_t(7);
+  }
+
+private:
+  static constexpr uint32_t WRAP_MARKER = std::numeric_limits<uint32_t>::max();
+
+  std::unique_ptr<uint8_t[]> m_buffer;
+  const size_t m_mask;
+  std::atomic<uint64_t> m_writePos{0};
+  char m_padding[64]; // keep the consumer's position on a different cache line
+  std::atomic<uint64_t> m_readPos{0};
+};
+
+/** \brief Collects log records from per-thread TraceRing buffers and formats them on a
+ *         background thread.
+ *
+ *  The backend is a process-wide singleton that is never destroyed, so that threads may
+ *  write log records at any time, including during static destruction.
+ */
+class TraceBackend : noncopyable
+{
+public:
+  static TraceBackend&
+  get();
+
+  /** \brief Assign a numeric identifier to a log module name.
+   */
+  uint32_t
+  registerModule(const std::string& moduleName);
+
+  /** \brief Start capturing log records, and write them to \p os.
+   *  \param os output stream, or nullptr to stop capturing
+   *  \param bufferSize size in bytes of each thread's ring buffer
+   */
+  void
+  setDestination(shared_ptr<std::ostream> os, size_t bufferSize);
+
+  /** \brief Write all captured log records to the destination.
+   */
+  void
+  flush();
+
+  /** \brief Commit a record to the calling thread's ring buffer.
+   */
+  void
+  commit(const TraceRecord& record) noexcept;
+
+private:
+  TraceBackend() = default;
+
+  TraceRing*
+  getThreadRing();
+
+  void
+  run();
+
+  /** \brief Format records from all ring buffers in timestamp order.
+   *  \pre m_drainMutex is locked
+   */
+  void
+  drain();
+
+  void
+  formatRecord(const uint8_t* record);
+
+public:
+  /** \brief Fixed-size prefix of each record in a TraceRing.
+   */
+  struct RecordHeader
+  {
+    int64_t timestamp; ///< nanoseconds since the epoch
+    uint32_t moduleId;
+    int8_t level;
+    bool isTruncated;
+    uint16_t argsSize;
+  };
+
+private:
+  std::mutex m_mutex; // protects the members below, up to m_drainMutex
+  std::deque<std::string> m_moduleNames;
+  std::unordered_map<std::string, uint32_t> m_moduleIds;
+  std::vector<shared_ptr<TraceRing>> m_rings;
+  std::atomic<uint64_t> m_generation{0};
+  size_t m_bufferSize = 0;
+  std::thread m_thread;
+  std::condition_variable m_cv;
+  bool m_shouldStop = false;
+  std::atomic<uint64_t> m_nDropped{0};
+
+  std::mutex m_drainMutex; // protects the members below
+  shared_ptr<std::ostream> m_os;
+  std::vector<const std::string*> m_moduleNameCache;
+  std::vector<uint8_t> m_drainBuffer;
+};
+
+/** \brief Format a timestamp as seconds since the epoch with microsecond precision.
+ */
+std::string
+formatTimestamp(time::system_clock::time_point tp);
+
+} // namespace detail
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_CXX_UTIL_IMPL_TRACE_BACKEND_HPP
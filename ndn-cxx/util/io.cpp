@@ -28,7 +28,6 @@
 #include "ndn-cxx/security/transform/hex-encode.hpp"
 #include "ndn-cxx/security/transform/stream-sink.hpp"
 #include "ndn-cxx/security/transform/stream-source.hpp"
-#include "ndn-cxx/security/transform/strip-space.hpp"
 
 namespace ndn {
 namespace io {
@@ -45,7 +44,7 @@ loadBuffer(std::istream& is, IoEncoding encoding)
         t::streamSource(is) >> t::streamSink(os);
         return os.buf();
       case BASE64:
-        t::streamSource(is) >> t::stripSpace("\n") >> t::base64Decode(false) >> t::streamSink(os);
+        t::streamSource(is) >> t::base64Decode(false) >> t::streamSink(os);
         return os.buf();
       case HEX:
         t::streamSource(is) >> t::hexDecode() >> t::streamSink(os);
@@ -21,6 +21,8 @@
 
 #include "ndn-cxx/util/logger.hpp"
 #include "ndn-cxx/util/logging.hpp"
+#include "ndn-cxx/util/time.hpp"
+#include "ndn-cxx/util/impl/trace-backend.hpp"
 
 #include <cstring> // for std::strspn()
 
@@ -94,6 +96,7 @@ isValidLoggerName(const std::string& name)
 
 Logger::Logger(const char* name)
   : m_moduleName(name)
+  , m_traceModuleId(detail::TraceBackend::get().registerModule(m_moduleName))
 {
   if (!isValidLoggerName(m_moduleName)) {
     NDN_THROW(std::invalid_argument("Logger name '" + m_moduleName + "' is invalid"));
@@ -113,5 +116,182 @@ Logger::registerModuleName(const char* name)
   Logging::get().registerLoggerNameImpl(std::move(moduleName));
 }
 
+namespace detail {
+
+std::atomic<bool> TraceRecord::s_isActive{false};
+
+/** \brief Forwards characters written to an ostream into the current STRING argument.
+ */
+class TraceRecord::FormatStream : noncopyable
+{
+public:
+  FormatStream()
+    : os(&m_buf)
+  {
+  }
+
+  void
+  attach(TraceRecord& record) noexcept
+  {
+    m_buf.record = &record;
+    isInUse = true;
+  }
+
+  void
+  detach() noexcept
+  {
+    os.flags(std::ios_base::skipws | std::ios_base::dec);
+    os.width(0);
+    os.precision(6);
+    os.fill(' ');
+    os.clear();
+    m_buf.record = nullptr;
+    isInUse = false;
+  }
+
+  bool
+  hasNonDefaultState() const noexcept
+  {
+    return os.flags() != (std::ios_base::skipws | std::ios_base::dec) ||
+           os.width() != 0 || os.precision() != 6 || os.fill() != ' ';
+  }
+
+private:
+  class Buffer : public std::streambuf
+  {
+  protected:
+    std::streamsize
+    xsputn(const char* s, std::streamsize n) final
+    {
+      record->appendFormattedChars(s, static_cast<size_t>(n));
+      return n;
+    }
+
+    int_type
+    overflow(int_type ch) final
+    {
+      if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        char c = traits_type::to_char_type(ch);
+        record->appendFormattedChars(&c, 1);
+      }
+      return traits_type::not_eof(ch);
+    }
+
+  public:
+    TraceRecord* record = nullptr;
+  };
+
+  Buffer m_buf;
+
+public:
+  std::ostream os;
+  bool isInUse = false;
+};
+
+TraceRecord::TraceRecord(const Logger& logger, LogLevel level)
+  : m_timestamp(time::duration_cast<time::nanoseconds>(time::system_clock::now().time_since_epoch()).count())
+  , m_moduleId(logger.m_traceModuleId)
+  , m_level(level)
+{
+}
+
+TraceRecord::~TraceRecord()
+{
+  if (m_stream != nullptr) {
+    if (m_ownsStream) {
+      delete m_stream;
+    }
+    else {
+      m_stream->detach();
+    }
+  }
+
+  TraceBackend::get().commit(*this);
+}
+
+TraceRecord&
+TraceRecord::appendString(const char* str, size_t len) noexcept
+{
+  if (m_isTruncated || m_argsSize + 1 + sizeof(uint16_t) > MAX_ARGS_SIZE) {
+    m_isTruncated = true;
+    return *this;
+  }
+
+  m_args[m_argsSize] = static_cast<uint8_t>(ArgType::STRING);
+  m_formatOffset = m_argsSize + 1;
+  uint16_t zero = 0;
+  std::memcpy(&m_args[m_formatOffset], &zero, sizeof(zero));
+  m_argsSize += 1 + sizeof(uint16_t);
+
+  appendFormattedChars(str, len);
+  m_formatOffset = 0;
+  return *this;
+}
+
+std::ostream&
+TraceRecord::beginFormat()
+{
+  if (m_stream == nullptr) {
+    thread_local FormatStream threadStream;
+    if (!threadStream.isInUse) {
+      m_stream = &threadStream;
+    }
+    else {
+      // an output operator invoked while formatting an argument is logging, too
+      m_stream = new FormatStream;
+      m_ownsStream = true;
+    }
+    m_stream->attach(*this);
+  }
+
+  appendString(nullptr, 0);
+  if (!m_isTruncated) {
+    m_formatOffset = m_argsSize - sizeof(uint16_t);
+  }
+  return m_stream->os;
+}
+
+void
+TraceRecord::endFormat()
+{
+  if (m_formatOffset != 0) {
+    uint16_t len;
+    std::memcpy(&len, &m_args[m_formatOffset], sizeof(len));
+    if (len == 0) {
+      // omit empty arguments, e.g., manipulators
+      m_argsSize -= 1 + sizeof(uint16_t);
+    }
+    m_formatOffset = 0;
+  }
+  m_hasStreamState = m_stream->hasNonDefaultState();
+}
+
+void
+TraceRecord::appendFormattedChars(const char* str, size_t len) noexcept
+{
+  if (m_formatOffset == 0) {
+    return;
+  }
+
+  size_t room = MAX_ARGS_SIZE - m_argsSize;
+  if (len > room) {
+    len = room;
+    m_isTruncated = true;
+  }
+  if (len == 0) {
+    return;
+  }
+
+  std::memcpy(&m_args[m_argsSize], str, len);
+  m_argsSize += static_cast<uint16_t>(len);
+
+  uint16_t total;
+  std::memcpy(&total, &m_args[m_formatOffset], sizeof(total));
+  total += static_cast<uint16_t>(len);
+  std::memcpy(&m_args[m_formatOffset], &total, sizeof(total));
+}
+
+} // namespace detail
+
 } // namespace util
 } // namespace ndn
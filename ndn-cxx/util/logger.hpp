@@ -33,6 +33,8 @@
 #include <boost/log/sources/severity_logger.hpp>
 
 #include <atomic>
+#include <cstring>
+#include <ostream>
 
 namespace ndn {
 namespace util {
@@ -69,6 +71,10 @@ BOOST_LOG_ATTRIBUTE_KEYWORD(severity, "Severity", LogLevel)
 
 } // namespace log
 
+namespace detail {
+class TraceRecord;
+} // namespace detail
+
 /** \brief Represents a log module in the logging facility.
  *
  *  \note Normally, loggers should be defined using #NDN_LOG_INIT, #NDN_LOG_MEMBER_INIT,
@@ -103,7 +109,10 @@ public:
 
 private:
   const std::string m_moduleName;
+  const uint32_t m_traceModuleId;
   std::atomic<LogLevel> m_currentLevel;
+
+  friend detail::TraceRecord;
 };
 
 namespace detail {
@@ -128,6 +137,223 @@ template<class T>
 using ArgumentType = typename ExtractArgument<T>::type;
 /** \endcond */
 
+/** \brief A log record captured by the binary trace backend.
+ *
+ *  Arguments of fundamental types and strings are stored in binary form and formatted later,
+ *  on the trace backend's thread. Arguments of other types, and arguments that follow a stream
+ *  manipulator, are formatted immediately. The record is committed to the calling thread's
+ *  trace buffer upon destruction; it is dropped if the buffer is full.
+ *
+ *  \sa Logging::setTraceDestination()
+ */
+class TraceRecord : noncopyable
+{
+public:
+  TraceRecord(const Logger& logger, LogLevel level);
+
+  ~TraceRecord();
+
+  /** \brief Return whether log records are sent to the trace backend instead of Boost.Log.
+   */
+  static bool
+  isActive() noexcept
+  {
+    return s_isActive.load(std::memory_order_relaxed);
+  }
+
+  TraceRecord&
+  operator<<(bool value)
+  {
+    return appendScalar<bool>(ArgType::BOOL, value);
+  }
+
+  TraceRecord&
+  operator<<(char value)
+  {
+    return appendScalar<char>(ArgType::CHAR, value);
+  }
+
+  TraceRecord&
+  operator<<(signed char value)
+  {
+    return appendScalar<char>(ArgType::CHAR, value);
+  }
+
+  TraceRecord&
+  operator<<(unsigned char value)
+  {
+    return appendScalar<char>(ArgType::CHAR, value);
+  }
+
+  TraceRecord&
+  operator<<(short value)
+  {
+    return appendScalar<int64_t>(ArgType::INT, value);
+  }
+
+  TraceRecord&
+  operator<<(int value)
+  {
+    return appendScalar<int64_t>(ArgType::INT, value);
+  }
+
+  TraceRecord&
+  operator<<(long value)
+  {
+    return appendScalar<int64_t>(ArgType::INT, value);
+  }
+
+  TraceRecord&
+  operator<<(long long value)
+  {
+    return appendScalar<int64_t>(ArgType::INT, value);
+  }
+
+  TraceRecord&
+  operator<<(unsigned short value)
+  {
+    return appendScalar<uint64_t>(ArgType::UINT, value);
+  }
+
+  TraceRecord&
+  operator<<(unsigned int value)
+  {
+    return appendScalar<uint64_t>(ArgType::UINT, value);
+  }
+
+  TraceRecord&
+  operator<<(unsigned long value)
+  {
+    return appendScalar<uint64_t>(ArgType::UINT, value);
+  }
+
+  TraceRecord&
+  operator<<(unsigned long long value)
+  {
+    return appendScalar<uint64_t>(ArgType::UINT, value);
+  }
+
+  TraceRecord&
+  operator<<(float value)
+  {
+    return appendScalar<double>(ArgType::DOUBLE, value);
+  }
+
+  TraceRecord&
+  operator<<(double value)
+  {
+    return appendScalar<double>(ArgType::DOUBLE, value);
+  }
+
+  TraceRecord&
+  operator<<(const char* value)
+  {
+    if (m_hasStreamState) {
+      return appendFormatted(value);
+    }
+    return appendString(value, value == nullptr ? 0 : std::strlen(value));
+  }
+
+  TraceRecord&
+  operator<<(const std::string& value)
+  {
+    if (m_hasStreamState) {
+      return appendFormatted(value);
+    }
+    return appendString(value.data(), value.size());
+  }
+
+  TraceRecord&
+  operator<<(std::ostream& (*manip)(std::ostream&))
+  {
+    return appendFormatted(manip);
+  }
+
+  template<typename T>
+  TraceRecord&
+  operator<<(const T& value)
+  {
+    return appendFormatted(value);
+  }
+
+public:
+  /** \brief Type tag of an argument stored in binary form.
+   */
+  enum class ArgType : uint8_t {
+    INT,    ///< followed by int64_t
+    UINT,   ///< followed by uint64_t
+    DOUBLE, ///< followed by double
+    CHAR,   ///< followed by char
+    BOOL,   ///< followed by bool
+    STRING, ///< followed by uint16_t length and characters
+  };
+
+  /** \brief Maximum size of the encoded arguments of a record; longer records are truncated.
+   */
+  static constexpr size_t MAX_ARGS_SIZE = 480;
+
+private:
+  template<typename Stored, typename T>
+  TraceRecord&
+  appendScalar(ArgType type, T value)
+  {
+    if (m_hasStreamState) {
+      return appendFormatted(value);
+    }
+    if (m_isTruncated || m_argsSize + 1 + sizeof(Stored) > MAX_ARGS_SIZE) {
+      m_isTruncated = true;
+      return *this;
+    }
+    Stored stored = static_cast<Stored>(value);
+    m_args[m_argsSize] = static_cast<uint8_t>(type);
+    std::memcpy(&m_args[m_argsSize + 1], &stored, sizeof(stored));
+    m_argsSize += 1 + sizeof(stored);
+    return *this;
+  }
+
+  TraceRecord&
+  appendString(const char* str, size_t len) noexcept;
+
+  template<typename T>
+  TraceRecord&
+  appendFormatted(const T& value)
+  {
+    beginFormat() << value;
+    endFormat();
+    return *this;
+  }
+
+  /** \brief Start a STRING argument, and return a stream that appends to it.
+   */
+  std::ostream&
+  beginFormat();
+
+  /** \brief Finish the STRING argument started by beginFormat().
+   */
+  void
+  endFormat();
+
+  void
+  appendFormattedChars(const char* str, size_t len) noexcept;
+
+private:
+  class FormatStream;
+
+  const int64_t m_timestamp;
+  const uint32_t m_moduleId;
+  const LogLevel m_level;
+  bool m_isTruncated = false;
+  bool m_hasStreamState = false; ///< a manipulator has changed the formatting state
+  bool m_ownsStream = false;
+  FormatStream* m_stream = nullptr; ///< for arguments formatted immediately
+  uint16_t m_formatOffset = 0; ///< position of the STRING length being formatted, 0 if none
+  uint16_t m_argsSize = 0;
+  uint8_t m_args[MAX_ARGS_SIZE];
+
+  static std::atomic<bool> s_isActive;
+  friend class TraceBackend;
+};
+
 } // namespace detail
 
 /** \cond */
@@ -237,8 +463,14 @@ using ArgumentType = typename ExtractArgument<T>::type;
 #define NDN_LOG_INTERNAL(lvl, expression) \
   do { \
     if (ndn_cxx_getLogger().isLevelEnabled(::ndn::util::LogLevel::lvl)) { \
-      BOOST_LOG_SEV(ndn_cxx_getLogger(), ::ndn::util::LogLevel::lvl)  \
-        << expression; \
+      if (::ndn::util::detail::TraceRecord::isActive()) { \
+        ::ndn::util::detail::TraceRecord(ndn_cxx_getLogger(), ::ndn::util::LogLevel::lvl) \
+          << expression; \
+      } \
+      else { \
+        BOOST_LOG_SEV(ndn_cxx_getLogger(), ::ndn::util::LogLevel::lvl) \
+          << expression; \
+      } \
     } \
   } while (false)
 /** \endcond */
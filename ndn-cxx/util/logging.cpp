@@ -22,6 +22,7 @@
 #include "ndn-cxx/util/logging.hpp"
 #include "ndn-cxx/util/logger.hpp"
 #include "ndn-cxx/util/time.hpp"
+#include "ndn-cxx/util/impl/trace-backend.hpp"
 
 #ifdef __ANDROID__
 #include "ndn-cxx/util/impl/logger-android.hpp"
@@ -36,9 +37,6 @@
 #include <boost/range/algorithm/copy.hpp>
 #include <boost/range/iterator_range.hpp>
 
-#include <cinttypes> // for PRIdLEAST64
-#include <cstdio>    // for std::snprintf()
-#include <cstdlib>   // for std::abs()
 #include <iostream>
 #include <sstream>
 
@@ -49,26 +47,7 @@ namespace log {
 static std::string
 makeTimestamp()
 {
-  using namespace ndn::time;
-
-  const auto sinceEpoch = system_clock::now().time_since_epoch();
-  BOOST_ASSERT(sinceEpoch.count() >= 0);
-  // use abs() to silence truncation warning in snprintf(), see #4365
-  const auto usecs = std::abs(duration_cast<microseconds>(sinceEpoch).count());
-  const auto usecsPerSec = microseconds::period::den;
-
-  // 10 (whole seconds) + '.' + 6 (fraction) + '\0'
-  std::string buffer(10 + 1 + 6 + 1, '\0'); // note 1 extra byte still needed for snprintf
-  BOOST_ASSERT_MSG(usecs / usecsPerSec <= 9999999999, "whole seconds cannot fit in 10 characters");
-
-  static_assert(std::is_same<microseconds::rep, int_least64_t>::value,
-                "PRIdLEAST64 is incompatible with microseconds::rep");
-  std::snprintf(&buffer.front(), buffer.size(), "%" PRIdLEAST64 ".%06" PRIdLEAST64,
-                usecs / usecsPerSec, usecs % usecsPerSec);
-
-  // need to remove extra 1 byte ('\0')
-  buffer.pop_back();
-  return buffer;
+  return detail::formatTimestamp(time::system_clock::now());
 }
 
 BOOST_LOG_ATTRIBUTE_KEYWORD(timestamp, "Timestamp", std::string)
@@ -291,6 +270,11 @@ Logging::setDestinationImpl(boost::shared_ptr<boost::log::sinks::sink> destinati
 {
   std::lock_guard<std::mutex> lock(m_mutex);
 
+  if (m_isTracing) {
+    detail::TraceBackend::get().setDestination(nullptr, 0);
+    m_isTracing = false;
+  }
+
   if (destination == m_destination) {
     return;
   }
@@ -307,6 +291,20 @@ Logging::setDestinationImpl(boost::shared_ptr<boost::log::sinks::sink> destinati
   }
 }
 
+void
+Logging::setTraceDestinationImpl(shared_ptr<std::ostream> os, size_t bufferSize)
+{
+  // remove the Boost.Log destination and stop the previous trace, if any
+  setDestinationImpl(nullptr);
+  if (os == nullptr) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  detail::TraceBackend::get().setDestination(std::move(os), bufferSize);
+  m_isTracing = true;
+}
+
 #ifdef NDN_CXX_HAVE_TESTS
 boost::shared_ptr<boost::log::sinks::sink>
 Logging::getDestination() const
@@ -335,6 +333,9 @@ Logging::flushImpl()
 {
   std::lock_guard<std::mutex> lock(m_mutex);
 
+  if (m_isTracing) {
+    detail::TraceBackend::get().flush();
+  }
   if (m_destination != nullptr) {
     m_destination->flush();
   }
@@ -107,6 +107,24 @@ public:
   static void
   setDestination(std::ostream& os, bool wantAutoFlush);
 
+  /** \brief Send log records to the low-overhead binary trace backend.
+   *  \param os a stream for log output; if nullptr, the destination is removed as with
+   *            `setDestination(nullptr)`
+   *  \param bufferSize size in bytes of the trace buffer of each logging thread
+   *
+   *  Instead of passing through Boost.Log, log records are stored in compact binary form into
+   *  lock-free per-thread ring buffers. A background thread periodically collects the records,
+   *  formats them in timestamp order as the default stream destination would, and writes them
+   *  to \p os. A record is dropped, and the number of dropped records is reported in the
+   *  output, if the logging thread's buffer is full.
+   *
+   *  Severity levels are configured with setLevel() as usual. The trace backend stays in use
+   *  until setDestination() is invoked. Log records emitted while switching destinations may
+   *  be lost. flush() writes all records collected so far.
+   */
+  static void
+  setTraceDestination(shared_ptr<std::ostream> os, size_t bufferSize = 1 << 20);
+
   /**
    * \brief Flush log backend.
    *
@@ -157,6 +175,9 @@ private:
   void
   setDestinationImpl(boost::shared_ptr<boost::log::sinks::sink> sink);
 
+  void
+  setTraceDestinationImpl(shared_ptr<std::ostream> os, size_t bufferSize);
+
   void
   flushImpl();
 
@@ -189,6 +210,7 @@ private:
   std::unordered_multimap<std::string, Logger*> m_loggers; ///< module name => logger instance
 
   boost::shared_ptr<boost::log::sinks::sink> m_destination;
+  bool m_isTracing = false;
 };
 
 inline std::set<std::string>
@@ -215,6 +237,12 @@ Logging::setDestination(boost::shared_ptr<boost::log::sinks::sink> destination)
   get().setDestinationImpl(std::move(destination));
 }
 
+inline void
+Logging::setTraceDestination(shared_ptr<std::ostream> os, size_t bufferSize)
+{
+  get().setTraceDestinationImpl(std::move(os), bufferSize);
+}
+
 inline void
 Logging::flush()
 {
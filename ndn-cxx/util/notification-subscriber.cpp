@@ -40,7 +40,9 @@ NotificationSubscriberBase::NotificationSubscriberBase(Face& face, const Name& p
   , m_isRunning(false)
   , m_lastSequenceNum(std::numeric_limits<uint64_t>::max())
   , m_lastNackSequenceNum(std::numeric_limits<uint64_t>::max())
+  , m_highestRequestedSeqNum(std::numeric_limits<uint64_t>::max())
   , m_attempts(1)
+  , m_window(1)
   , m_scheduler(face.getIoService())
   , m_interestLifetime(interestLifetime)
 {
@@ -48,6 +50,15 @@ NotificationSubscriberBase::NotificationSubscriberBase(Face& face, const Name& p
 
 NotificationSubscriberBase::~NotificationSubscriberBase() = default;
 
+void
+NotificationSubscriberBase::setPipelineWindow(size_t window)
+{
+  if (window == 0) {
+    NDN_THROW(std::invalid_argument("Pipeline window must be positive"));
+  }
+  m_window = window;
+}
+
 void
 NotificationSubscriberBase::start()
 {
@@ -65,7 +76,22 @@ NotificationSubscriberBase::stop()
     return;
   m_isRunning = false;
 
-  m_lastInterest.cancel();
+  reset();
+}
+
+void
+NotificationSubscriberBase::reset()
+{
+  m_initialInterest.cancel();
+  m_pendingInterests.clear();
+  m_reorderBuffer.clear();
+}
+
+void
+NotificationSubscriberBase::restart()
+{
+  reset();
+  sendInitialInterest();
 }
 
 void
@@ -74,34 +100,68 @@ NotificationSubscriberBase::sendInitialInterest()
   if (shouldStop())
     return;
 
-  auto interest = make_shared<Interest>(m_prefix);
-  interest->setCanBePrefix(true);
-  interest->setMustBeFresh(true);
-  interest->setInterestLifetime(m_interestLifetime);
-  sendInterest(*interest);
+  Interest interest(m_prefix);
+  interest.setCanBePrefix(true);
+  interest.setMustBeFresh(true);
+  interest.setInterestLifetime(m_interestLifetime);
+
+  m_initialInterest = m_face.expressInterest(interest,
+    [this] (const auto&, const auto& d) {
+      m_initialInterest.release();
+      this->afterReceiveData(d, true);
+    },
+    [this] (const auto&, const auto& n) {
+      m_initialInterest.release();
+      this->afterReceiveNack(n);
+    },
+    [this] (const auto&) {
+      m_initialInterest.release();
+      this->afterTimeout(nullopt);
+    });
 }
 
 void
-NotificationSubscriberBase::sendNextInterest()
+NotificationSubscriberBase::sendNextInterests()
 {
   if (shouldStop())
     return;
 
-  Name nextName = m_prefix;
-  nextName.appendSequenceNumber(m_lastSequenceNum + 1);
-
-  auto interest = make_shared<Interest>(nextName);
-  interest->setInterestLifetime(m_interestLifetime);
-  sendInterest(*interest);
+  // keep Interests outstanding for up to m_window sequence numbers past the last delivered one
+  while (m_highestRequestedSeqNum - m_lastSequenceNum < m_window) {
+    sendSequenceInterest(++m_highestRequestedSeqNum);
+  }
 }
 
 void
-NotificationSubscriberBase::sendInterest(const Interest& interest)
+NotificationSubscriberBase::sendSequenceInterest(uint64_t seqNum)
 {
-  m_lastInterest = m_face.expressInterest(interest,
-                                          [this] (const auto&, const auto& d) { this->afterReceiveData(d); },
-                                          [this] (const auto&, const auto& n) { this->afterReceiveNack(n); },
-                                          [this] (const auto&) { this->afterTimeout(); });
+  Name nextName = m_prefix;
+  nextName.appendSequenceNumber(seqNum);
+
+  Interest interest(nextName);
+  interest.setInterestLifetime(m_interestLifetime);
+
+  auto release = [this, seqNum] {
+    auto it = m_pendingInterests.find(seqNum);
+    if (it != m_pendingInterests.end()) {
+      it->second.release();
+      m_pendingInterests.erase(it);
+    }
+  };
+
+  m_pendingInterests[seqNum] = m_face.expressInterest(interest,
+    [this, release] (const auto&, const auto& d) {
+      release();
+      this->afterReceiveData(d, false);
+    },
+    [this, release] (const auto&, const auto& n) {
+      release();
+      this->afterReceiveNack(n);
+    },
+    [this, release, seqNum] (const auto&) {
+      release();
+      this->afterTimeout(seqNum);
+    });
 }
 
 bool
@@ -118,27 +178,62 @@ NotificationSubscriberBase::shouldStop()
 }
 
 void
-NotificationSubscriberBase::afterReceiveData(const Data& data)
+NotificationSubscriberBase::afterReceiveData(const Data& data, bool isInitial)
 {
   if (shouldStop())
     return;
 
+  uint64_t seqNum = 0;
   try {
-    m_lastSequenceNum = data.getName().get(-1).toSequenceNumber();
+    seqNum = data.getName().get(-1).toSequenceNumber();
   }
   catch (const tlv::Error&) {
     onDecodeError(data);
-    sendInitialInterest();
+    restart();
     return;
   }
 
-  if (!decodeAndDeliver(data)) {
-    onDecodeError(data);
-    sendInitialInterest();
+  if (isInitial) {
+    // (re)synchronize with the stream: the received Notification is the next one to deliver
+    reset();
+    m_lastSequenceNum = seqNum - 1;
+    m_highestRequestedSeqNum = seqNum;
+  }
+  else if (seqNum - m_lastSequenceNum - 1 >= m_highestRequestedSeqNum - m_lastSequenceNum) {
+    // not within the current window, e.g., already delivered or skipped
     return;
   }
 
-  sendNextInterest();
+  m_reorderBuffer[seqNum] = data;
+
+  if (!deliverInOrder())
+    return;
+
+  sendNextInterests();
+}
+
+bool
+NotificationSubscriberBase::deliverInOrder()
+{
+  while (!m_reorderBuffer.empty() && m_reorderBuffer.begin()->first == m_lastSequenceNum + 1) {
+    auto node = m_reorderBuffer.begin();
+    optional<Data> data = std::move(node->second);
+    m_reorderBuffer.erase(node);
+    ++m_lastSequenceNum;
+
+    if (!data) {
+      onGap(m_lastSequenceNum);
+    }
+    else if (!decodeAndDeliver(*data)) {
+      onDecodeError(*data);
+      restart();
+      return false;
+    }
+
+    if (shouldStop())
+      return false;
+  }
+  return true;
 }
 
 void
@@ -149,19 +244,34 @@ NotificationSubscriberBase::afterReceiveNack(const lp::Nack& nack)
 
   onNack(nack);
 
+  reset();
   time::milliseconds delay = exponentialBackoff(nack);
   m_nackEvent = m_scheduler.schedule(delay, [this] { sendInitialInterest(); });
 }
 
 void
-NotificationSubscriberBase::afterTimeout()
+NotificationSubscriberBase::afterTimeout(optional<uint64_t> seqNum)
 {
   if (shouldStop())
     return;
 
+  if (seqNum && m_reorderBuffer.upper_bound(*seqNum) != m_reorderBuffer.end()) {
+    // a later Notification has arrived, so this one is unlikely to ever be retrieved
+    m_reorderBuffer.emplace(*seqNum, nullopt);
+    if (deliverInOrder())
+      sendNextInterests();
+    return;
+  }
+
+  if (seqNum && *seqNum != m_lastSequenceNum + 1) {
+    // an earlier sequence number is still outstanding, keep waiting for this one
+    sendSequenceInterest(*seqNum);
+    return;
+  }
+
   onTimeout();
 
-  sendInitialInterest();
+  restart();
 }
 
 time::milliseconds
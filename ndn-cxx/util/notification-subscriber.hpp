@@ -34,6 +34,8 @@
 #include "ndn-cxx/util/signal.hpp"
 #include "ndn-cxx/util/time.hpp"
 
+#include <map>
+
 namespace ndn {
 namespace util {
 
@@ -60,6 +62,27 @@ public:
     return m_isRunning;
   }
 
+  /** \return maximum number of outstanding sequence-numbered Interests.
+   */
+  size_t
+  getPipelineWindow() const
+  {
+    return m_window;
+  }
+
+  /** \brief Set the maximum number of outstanding sequence-numbered Interests.
+   *
+   *  With a window of 1 (the default), the next Interest is sent only after the previous
+   *  Notification has been received. A larger window keeps up to \p window Interests for
+   *  consecutive sequence numbers outstanding, so that throughput is not limited to one
+   *  Notification per round-trip time. Notifications are still delivered in order.
+   *
+   *  The new window takes effect the next time the pipeline is refilled.
+   *  \throw std::invalid_argument \p window is zero
+   */
+  void
+  setPipelineWindow(size_t window);
+
   /** \brief Start or resume receiving notifications.
    *  \note onNotification must have at least one listener,
    *        otherwise this operation has no effect.
@@ -85,10 +108,21 @@ private:
   sendInitialInterest();
 
   void
-  sendNextInterest();
+  sendNextInterests();
+
+  void
+  sendSequenceInterest(uint64_t seqNum);
+
+  /** \brief Cancel all outstanding Interests, discard buffered Data, and resynchronize
+   *         with the stream through an initial Interest.
+   */
+  void
+  restart();
 
+  /** \brief Cancel all outstanding Interests and discard buffered Data.
+   */
   void
-  sendInterest(const Interest& interest);
+  reset();
 
   virtual bool
   hasSubscriber() const = 0;
@@ -100,7 +134,13 @@ private:
   shouldStop();
 
   void
-  afterReceiveData(const Data& data);
+  afterReceiveData(const Data& data, bool isInitial);
+
+  /** \brief Deliver buffered notifications that are next in sequence.
+   *  \return false if the subscriber has been stopped or restarted during delivery
+   */
+  bool
+  deliverInOrder();
 
   /** \brief Decode the Data as a notification, and deliver it to subscribers.
    *  \return whether decode was successful
@@ -112,7 +152,7 @@ private:
   afterReceiveNack(const lp::Nack& nack);
 
   void
-  afterTimeout();
+  afterTimeout(optional<uint64_t> seqNum);
 
   time::milliseconds
   exponentialBackoff(lp::Nack nack);
@@ -130,16 +170,29 @@ public:
    */
   signal::Signal<NotificationSubscriberBase, Data> onDecodeError;
 
+  /** \brief Fires when a Notification is skipped because it could not be retrieved.
+   *
+   *  A gap is detected when the Interest for a sequence number times out after a Notification
+   *  with a higher sequence number has been received. The argument is the missing sequence number.
+   *  This signal can only fire when the pipeline window is greater than 1.
+   */
+  signal::Signal<NotificationSubscriberBase, uint64_t> onGap;
+
 private:
   Face& m_face;
   Name m_prefix;
   bool m_isRunning;
   uint64_t m_lastSequenceNum;
   uint64_t m_lastNackSequenceNum;
+  uint64_t m_highestRequestedSeqNum;
   uint64_t m_attempts;
+  size_t m_window;
   Scheduler m_scheduler;
   scheduler::ScopedEventId m_nackEvent;
-  ScopedPendingInterestHandle m_lastInterest;
+  ScopedPendingInterestHandle m_initialInterest;
+  std::map<uint64_t, ScopedPendingInterestHandle> m_pendingInterests;
+  /// received but not yet delivered Data, keyed by sequence number; nullopt marks a gap
+  std::map<uint64_t, optional<Data>> m_reorderBuffer;
   time::milliseconds m_interestLifetime;
 };
 
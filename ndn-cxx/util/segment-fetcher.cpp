@@ -22,8 +22,8 @@
  */
 
 #include "ndn-cxx/util/segment-fetcher.hpp"
+#include "ndn-cxx/name-builder.hpp"
 #include "ndn-cxx/name-component.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
 #include "ndn-cxx/lp/nack.hpp"
 #include "ndn-cxx/lp/nack-header.hpp"
 
@@ -114,7 +114,7 @@ SegmentFetcher::fetchFirstSegment(const Interest& baseInterest, bool isRetransmi
     interest.refreshNonce();
   }
 
-  sendInterest(0, interest, isRetransmission);
+  sendInterests({{0, isRetransmission}}, make_span(&interest, 1));
 }
 
 void
@@ -161,24 +161,34 @@ SegmentFetcher::fetchSegmentsInWindow(const Interest& origInterest)
     availableWindowSize--;
   }
 
+  if (segmentsToRequest.empty()) {
+    return;
+  }
+
+  std::vector<Interest> interests;
+  interests.reserve(segmentsToRequest.size());
+  const NameBuilder prefix(m_versionedDataName);
   for (const auto& segment : segmentsToRequest) {
     Interest interest(origInterest); // to preserve Interest elements
-    interest.setName(Name(m_versionedDataName).appendSegment(segment.first));
+    interest.setName(NameBuilder(prefix).appendSegment(segment.first).build());
     interest.setCanBePrefix(false);
     interest.setMustBeFresh(false);
     interest.setInterestLifetime(m_options.interestLifetime);
     interest.refreshNonce();
-    sendInterest(segment.first, interest, segment.second);
+    interests.push_back(std::move(interest));
   }
+  sendInterests(segmentsToRequest, interests);
 }
 
 void
-SegmentFetcher::sendInterest(uint64_t segNum, const Interest& interest, bool isRetransmission)
+SegmentFetcher::sendInterests(const std::vector<std::pair<uint64_t, bool>>& segments,
+                              span<const Interest> interests)
 {
+  BOOST_ASSERT(segments.size() == interests.size());
   weak_ptr<SegmentFetcher> weakSelf = m_this;
 
-  ++m_nSegmentsInFlight;
-  auto pendingInterest = m_face.expressInterest(interest,
+  m_nSegmentsInFlight += segments.size();
+  auto pendingInterests = m_face.expressInterests(interests,
     [this, weakSelf] (const Interest& interest, const Data& data) {
       afterSegmentReceivedCb(interest, data, weakSelf);
     },
@@ -188,20 +198,24 @@ SegmentFetcher::sendInterest(uint64_t segNum, const Interest& interest, bool isR
     nullptr);
 
   auto timeout = m_options.useConstantInterestTimeout ? m_options.maxTimeout : getEstimatedRto();
-  auto timeoutEvent = m_scheduler.schedule(timeout, [this, interest, weakSelf] {
-    afterTimeoutCb(interest, weakSelf);
-  });
+  for (size_t i = 0; i < segments.size(); ++i) {
+    uint64_t segNum = segments[i].first;
+    const Interest& interest = interests[i];
+    auto timeoutEvent = m_scheduler.schedule(timeout, [this, interest, weakSelf] {
+      afterTimeoutCb(interest, weakSelf);
+    });
+
+    if (segments[i].second) { // retransmission
+      updateRetransmittedSegment(segNum, pendingInterests[i], timeoutEvent);
+      continue;
+    }
 
-  if (isRetransmission) {
-    updateRetransmittedSegment(segNum, pendingInterest, timeoutEvent);
-    return;
+    PendingSegment pendingSegment{SegmentState::FirstInterest, time::steady_clock::now(),
+                                  pendingInterests[i], timeoutEvent};
+    bool isNew = m_pendingSegments.emplace(segNum, std::move(pendingSegment)).second;
+    BOOST_VERIFY(isNew);
+    m_highInterest = segNum;
   }
-
-  PendingSegment pendingSegment{SegmentState::FirstInterest, time::steady_clock::now(),
-                                pendingInterest, timeoutEvent};
-  bool isNew = m_pendingSegments.emplace(segNum, std::move(pendingSegment)).second;
-  BOOST_VERIFY(isNew);
-  m_highInterest = segNum;
 }
 
 void
@@ -294,8 +308,13 @@ SegmentFetcher::afterValidationSuccess(const Data& data, const Interest& origInt
 
   if (m_options.inOrder && m_nextSegmentInOrder == currentSegment) {
     do {
-      onInOrderData(std::make_shared<const Buffer>(m_segmentBuffer[m_nextSegmentInOrder]));
-      m_segmentBuffer.erase(m_nextSegmentInOrder++);
+      auto it = m_segmentBuffer.find(m_nextSegmentInOrder++);
+      auto segment = std::make_shared<const Buffer>(std::move(it->second));
+      m_segmentBuffer.erase(it);
+      onInOrderData(std::move(segment));
+      // a handler may stop the fetch, e.g., once it has read everything it needs
+      if (shouldStop(weakSelf))
+        return;
     } while (m_segmentBuffer.count(m_nextSegmentInOrder) > 0);
   }
 
@@ -413,15 +432,20 @@ SegmentFetcher::finalizeFetch()
     onInOrderComplete();
   }
   else {
-    // Combine segments into final buffer
-    OBufferStream buf;
     // We may have received more segments than exist in the object.
     BOOST_ASSERT(m_receivedSegments.size() >= static_cast<uint64_t>(m_nSegments));
 
+    // Combine segments into final buffer, which is allocated once
+    size_t totalSize = 0;
+    for (int64_t i = 0; i < m_nSegments; i++) {
+      totalSize += m_segmentBuffer[i].size();
+    }
+    auto buf = std::make_shared<Buffer>();
+    buf->reserve(totalSize);
     for (int64_t i = 0; i < m_nSegments; i++) {
-      buf.write(m_segmentBuffer[i].get<const char>(), m_segmentBuffer[i].size());
+      buf->insert(buf->end(), m_segmentBuffer[i].begin(), m_segmentBuffer[i].end());
     }
-    onComplete(buf.buf());
+    onComplete(buf);
   }
   stop();
 }
@@ -173,8 +173,13 @@ private:
   void
   fetchSegmentsInWindow(const Interest& origInterest);
 
+  /** \brief Express Interests for a set of segments as one batch.
+   *  \param segments segment numbers, each paired with whether it is a retransmission
+   *  \param interests the Interests, in the same order as \p segments
+   */
   void
-  sendInterest(uint64_t segNum, const Interest& interest, bool isRetransmission);
+  sendInterests(const std::vector<std::pair<uint64_t, bool>>& segments,
+                span<const Interest> interests);
 
   void
   afterSegmentReceivedCb(const Interest& origInterest, const Data& data,
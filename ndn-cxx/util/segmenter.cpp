@@ -20,12 +20,61 @@
  */
 
 #include "ndn-cxx/util/segmenter.hpp"
+#include "ndn-cxx/name-builder.hpp"
+#include "ndn-cxx/util/scope.hpp"
 
 #include <boost/iostreams/read.hpp>
 
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace ndn {
 namespace util {
 
+namespace {
+
+/**
+ * @brief Map a whole file into memory, read-only.
+ * @param[out] content the contents of the file, within the mapping
+ * @return the owner of the mapping, which unmaps the file when released; nullptr if the file is empty
+ */
+shared_ptr<const void>
+mapFile(const std::string& filename, span<const uint8_t>& content)
+{
+  int fd = ::open(filename.data(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    NDN_THROW(Segmenter::Error("Cannot open " + filename + ": " + std::strerror(errno)));
+  }
+  // the mapping remains valid after the file descriptor is closed
+  auto closeFd = make_scope_exit([fd] { ::close(fd); });
+
+  struct stat st;
+  if (::fstat(fd, &st) != 0) {
+    NDN_THROW(Segmenter::Error("Cannot stat " + filename + ": " + std::strerror(errno)));
+  }
+  auto size = static_cast<size_t>(st.st_size);
+  if (size == 0) {
+    content = {};
+    return nullptr;
+  }
+
+  void* addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (addr == MAP_FAILED) {
+    NDN_THROW(Segmenter::Error("Cannot map " + filename + ": " + std::strerror(errno)));
+  }
+  // segments are typically requested in order
+  ::madvise(addr, size, MADV_SEQUENTIAL);
+
+  content = {static_cast<const uint8_t*>(addr), size};
+  return shared_ptr<const void>(addr, [size] (const void* p) { ::munmap(const_cast<void*>(p), size); });
+}
+
+} // namespace
+
 Segmenter::Segmenter(KeyChain& keyChain, const security::SigningInfo& signingInfo)
   : m_keyChain(keyChain)
   , m_signingInfo(signingInfo)
@@ -46,12 +95,13 @@ Segmenter::segment(span<const uint8_t> buffer, const Name& dataName, size_t maxS
 
   std::vector<std::shared_ptr<Data>> segments;
   segments.reserve(numSegments);
+  const NameBuilder prefix(dataName);
 
   do {
     auto segLen = std::min(buffer.size(), maxSegmentSize);
 
     auto data = std::make_shared<Data>();
-    data->setName(Name(dataName).appendSegment(segments.size()));
+    data->setName(NameBuilder(prefix).appendSegment(segments.size()).build());
     data->setContentType(contentType);
     data->setFreshnessPeriod(freshnessPeriod);
     data->setFinalBlock(finalBlockId);
@@ -76,9 +126,10 @@ Segmenter::segment(std::istream& input, const Name& dataName, size_t maxSegmentS
   }
 
   std::vector<std::shared_ptr<Data>> segments;
+  const NameBuilder prefix(dataName);
 
   while (true) {
-    auto buffer = std::make_shared<Buffer>(maxSegmentSize);
+    auto buffer = std::make_shared<Buffer>(maxSegmentSize, Buffer::NoInit{});
     auto n = boost::iostreams::read(input, buffer->get<char>(), buffer->size());
     if (n < 0) { // EOF
       break;
@@ -86,7 +137,7 @@ Segmenter::segment(std::istream& input, const Name& dataName, size_t maxSegmentS
     buffer->resize(n);
 
     auto data = std::make_shared<Data>();
-    data->setName(Name(dataName).appendSegment(segments.size()));
+    data->setName(NameBuilder(prefix).appendSegment(segments.size()).build());
     data->setContentType(contentType);
     data->setFreshnessPeriod(freshnessPeriod);
     data->setContent(std::move(buffer));
@@ -97,7 +148,7 @@ Segmenter::segment(std::istream& input, const Name& dataName, size_t maxSegmentS
   // ensure we return at least one (empty) segment
   if (segments.empty()) {
     auto data = std::make_shared<Data>();
-    data->setName(Name(dataName).appendSegment(0));
+    data->setName(NameBuilder(prefix).appendSegment(0).build());
     data->setContentType(contentType);
     data->setFreshnessPeriod(freshnessPeriod);
     segments.push_back(std::move(data));
@@ -113,5 +164,94 @@ Segmenter::segment(std::istream& input, const Name& dataName, size_t maxSegmentS
   return segments;
 }
 
+Segmenter::FileSegments
+Segmenter::open(const std::string& filename, const Name& dataName, size_t maxSegmentSize,
+                time::milliseconds freshnessPeriod, uint32_t contentType, size_t cacheCapacity)
+{
+  if (maxSegmentSize == 0) {
+    NDN_THROW(std::invalid_argument("maxSegmentSize must be greater than 0"));
+  }
+  if (freshnessPeriod < 0_ms) {
+    NDN_THROW(std::invalid_argument("FreshnessPeriod must be >= 0"));
+  }
+
+  span<const uint8_t> content;
+  auto mapping = mapFile(filename, content);
+  return FileSegments(*this, std::move(mapping), content, dataName, maxSegmentSize,
+                      freshnessPeriod, contentType, cacheCapacity);
+}
+
+Segmenter::FileSegments::FileSegments(Segmenter& segmenter, shared_ptr<const void> mapping,
+                                      span<const uint8_t> content, const Name& dataName,
+                                      size_t maxSegmentSize, time::milliseconds freshnessPeriod,
+                                      uint32_t contentType, size_t cacheCapacity)
+  : m_keyChain(&segmenter.m_keyChain)
+  , m_signingInfo(segmenter.m_signingInfo)
+  , m_mapping(std::move(mapping))
+  , m_content(content)
+  , m_prefix(dataName)
+  , m_maxSegmentSize(maxSegmentSize)
+  , m_freshnessPeriod(freshnessPeriod)
+  , m_contentType(contentType)
+  // minimum of one (possibly empty) segment
+  , m_nSegments(1 + (m_content.size() - !m_content.empty()) / maxSegmentSize)
+  , m_finalBlockId(name::Component::fromSegment(m_nSegments - 1))
+  , m_cacheCapacity(cacheCapacity)
+{
+}
+
+shared_ptr<const Data>
+Segmenter::FileSegments::get(uint64_t segmentNo)
+{
+  if (segmentNo >= m_nSegments) {
+    NDN_THROW(std::out_of_range("Segment " + to_string(segmentNo) + " does not exist"));
+  }
+
+  auto it = m_cacheIndex.find(segmentNo);
+  if (it != m_cacheIndex.end()) {
+    m_cache.splice(m_cache.begin(), m_cache, it->second);
+    return it->second->second;
+  }
+
+  auto data = makeSegment(segmentNo);
+  if (m_cacheCapacity > 0) {
+    if (m_cache.size() >= m_cacheCapacity) {
+      m_cacheIndex.erase(m_cache.back().first);
+      m_cache.pop_back();
+    }
+    m_cache.emplace_front(segmentNo, data);
+    m_cacheIndex.emplace(segmentNo, m_cache.begin());
+  }
+  return data;
+}
+
+shared_ptr<const Data>
+Segmenter::FileSegments::get(const Interest& interest)
+{
+  const Name& name = interest.getName();
+  if (name.size() != m_prefix.size() + 1 || !m_prefix.isPrefixOf(name) ||
+      !name[-1].isSegment() || name[-1].toSegment() >= m_nSegments) {
+    return nullptr;
+  }
+  return get(name[-1].toSegment());
+}
+
+shared_ptr<const Data>
+Segmenter::FileSegments::makeSegment(uint64_t segmentNo) const
+{
+  size_t offset = static_cast<size_t>(segmentNo * m_maxSegmentSize);
+  size_t segLen = std::min(m_content.size() - offset, m_maxSegmentSize);
+
+  auto data = std::make_shared<Data>();
+  data->setName(NameBuilder(m_prefix).appendSegment(segmentNo).build());
+  data->setContentType(m_contentType);
+  data->setFreshnessPeriod(m_freshnessPeriod);
+  data->setFinalBlock(m_finalBlockId);
+  data->setContent(makeExternalBuffer(m_content.subspan(offset, segLen), m_mapping));
+
+  m_keyChain->sign(*data, m_signingInfo);
+  return data;
+}
+
 } // namespace util
 } // namespace ndn
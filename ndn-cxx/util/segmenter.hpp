@@ -25,6 +25,9 @@
 #include "ndn-cxx/security/key-chain.hpp"
 #include "ndn-cxx/util/span.hpp"
 
+#include <list>
+#include <unordered_map>
+
 namespace ndn {
 namespace util {
 
@@ -33,6 +36,104 @@ namespace util {
  */
 class Segmenter
 {
+public:
+  class Error : public std::runtime_error
+  {
+  public:
+    using std::runtime_error::runtime_error;
+  };
+
+  /**
+   * @brief Segments of a file that are created and signed on demand.
+   *
+   * The file is mapped into memory, and the Content of each segment refers to the mapping
+   * instead of holding a copy of it; the mapping stays alive as long as any segment does.
+   * Together with the bounded cache of signed segments, this allows a producer to serve an
+   * arbitrarily large file in constant memory.
+   *
+   * @sa Segmenter::open()
+   */
+  class FileSegments
+  {
+  public:
+    FileSegments(FileSegments&&) = default;
+
+    FileSegments&
+    operator=(FileSegments&&) = default;
+
+    /**
+     * @brief Return the name prefix of the segments.
+     */
+    const Name&
+    getPrefix() const noexcept
+    {
+      return m_prefix;
+    }
+
+    /**
+     * @brief Return the number of segments, which is at least one.
+     */
+    uint64_t
+    size() const noexcept
+    {
+      return m_nSegments;
+    }
+
+    /**
+     * @brief Return the FinalBlockId carried by every segment.
+     */
+    const name::Component&
+    getFinalBlockId() const noexcept
+    {
+      return m_finalBlockId;
+    }
+
+    /**
+     * @brief Return a segment, creating and signing it if it is not in the cache.
+     * @throw std::out_of_range @p segmentNo is not less than size()
+     */
+    shared_ptr<const Data>
+    get(uint64_t segmentNo);
+
+    /**
+     * @brief Return the segment that satisfies @p interest, if any.
+     *
+     * The Interest must name a segment of this object, i.e., its name must be the prefix
+     * followed by a valid segment number component.
+     *
+     * @return the segment, or nullptr if @p interest does not name a segment of this object
+     */
+    shared_ptr<const Data>
+    get(const Interest& interest);
+
+  private:
+    FileSegments(Segmenter& segmenter, shared_ptr<const void> mapping, span<const uint8_t> content,
+                 const Name& dataName, size_t maxSegmentSize, time::milliseconds freshnessPeriod,
+                 uint32_t contentType, size_t cacheCapacity);
+
+    shared_ptr<const Data>
+    makeSegment(uint64_t segmentNo) const;
+
+  private:
+    KeyChain* m_keyChain;
+    security::SigningInfo m_signingInfo;
+    shared_ptr<const void> m_mapping; ///< unmaps the file when released
+    span<const uint8_t> m_content; ///< the file contents, within the mapping
+    Name m_prefix;
+    size_t m_maxSegmentSize;
+    time::milliseconds m_freshnessPeriod;
+    uint32_t m_contentType;
+    uint64_t m_nSegments;
+    name::Component m_finalBlockId;
+
+    size_t m_cacheCapacity;
+    using CacheList = std::list<std::pair<uint64_t, shared_ptr<const Data>>>;
+    CacheList m_cache; ///< most recently used first
+    std::unordered_map<uint64_t, CacheList::iterator> m_cacheIndex;
+
+    friend Segmenter;
+  };
+
 public:
   /**
    * @brief Constructor.
@@ -73,6 +174,27 @@ public:
           time::milliseconds freshnessPeriod,
           uint32_t contentType = tlv::ContentType_Blob);
 
+  /**
+   * @brief Opens a file whose segments are created and signed on demand.
+   * @param filename Path of the file. It must not be modified while the returned object, or any
+   *                 segment obtained from it, exists.
+   * @param dataName Name prefix to use for the Data packets. A segment number will be appended to it.
+   * @param maxSegmentSize Maximum size of the `Content` element (payload) of each created Data packet.
+   * @param freshnessPeriod The `FreshnessPeriod` of created Data packets.
+   * @param contentType The `ContentType` of created Data packets.
+   * @param cacheCapacity Maximum number of signed segments kept for reuse, 0 disables caching.
+   * @throw Error the file cannot be opened or mapped
+   * @note The KeyChain of this Segmenter must outlive the returned object.
+   * @note An empty file yields one empty segment.
+   */
+  NDN_CXX_NODISCARD FileSegments
+  open(const std::string& filename,
+       const Name& dataName,
+       size_t maxSegmentSize,
+       time::milliseconds freshnessPeriod,
+       uint32_t contentType = tlv::ContentType_Blob,
+       size_t cacheCapacity = 0);
+
 private:
   KeyChain& m_keyChain;
   security::SigningInfo m_signingInfo;
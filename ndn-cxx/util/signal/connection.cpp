@@ -27,20 +27,28 @@ namespace signal {
 
 BOOST_CONCEPT_ASSERT((boost::EqualityComparable<Connection>));
 
-Connection::Connection(weak_ptr<DisconnectFunction> disconnect) noexcept
-  : m_disconnect(std::move(disconnect))
+Connection::Connection(weak_ptr<SlotTable> slotTable, uint64_t slotId) noexcept
+  : m_slotTable(std::move(slotTable))
+  , m_slotId(slotId)
 {
 }
 
 void
 Connection::disconnect()
 {
-  auto f = m_disconnect.lock();
-  if (f != nullptr) {
-    (*f)();
+  auto table = m_slotTable.lock();
+  if (table != nullptr) {
+    table->disconnectSlot(m_slotId);
   }
 }
 
+bool
+Connection::isConnected() const noexcept
+{
+  auto table = m_slotTable.lock();
+  return table != nullptr && table->isSlotConnected(m_slotId);
+}
+
 } // namespace signal
 } // namespace util
 } // namespace ndn
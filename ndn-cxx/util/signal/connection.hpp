@@ -28,7 +28,21 @@ namespace ndn {
 namespace util {
 namespace signal {
 
-using DisconnectFunction = std::function<void()>;
+/** \brief (implementation detail) The slots of a Signal, as seen by a Connection.
+ */
+class SlotTable
+{
+public:
+  virtual bool
+  isSlotConnected(uint64_t slotId) const noexcept = 0;
+
+  virtual void
+  disconnectSlot(uint64_t slotId) = 0;
+
+protected:
+  virtual
+  ~SlotTable() = default;
+};
 
 /** \brief Represents a connection to a signal.
  *  \note This type is copyable. Any copy can be used to disconnect.
@@ -51,16 +65,13 @@ public:
   /** \brief Check if connected to the signal.
    */
   bool
-  isConnected() const noexcept
-  {
-    return !m_disconnect.expired();
-  }
+  isConnected() const noexcept;
 
 private:
-  /** \param disconnect weak_ptr to a function that disconnects the handler
+  /** \param slotTable weak_ptr to the slots of a Signal
+   *  \param slotId identifier of the handler's slot, never reused within the Signal
    */
-  explicit
-  Connection(weak_ptr<DisconnectFunction> disconnect) noexcept;
+  Connection(weak_ptr<SlotTable> slotTable, uint64_t slotId) noexcept;
 
   template<typename Owner, typename ...TArgs>
   friend class Signal;
@@ -78,8 +89,9 @@ private:
   operator==(const Connection& lhs, const Connection& rhs) noexcept
   {
     return (!lhs.isConnected() && !rhs.isConnected()) ||
-        (!lhs.m_disconnect.owner_before(rhs.m_disconnect) &&
-         !rhs.m_disconnect.owner_before(lhs.m_disconnect));
+        (!lhs.m_slotTable.owner_before(rhs.m_slotTable) &&
+         !rhs.m_slotTable.owner_before(lhs.m_slotTable) &&
+         lhs.m_slotId == rhs.m_slotId);
   }
 
   friend bool
@@ -89,14 +101,15 @@ private:
   }
 
 private:
-  /** \note The only shared_ptr to the disconnect function is stored in Signal<..>::Slot,
-   *        and will be destructed if the handler is disconnected (through another Connection
-   *        instance) or the Signal is destructed.
-   *        Connection needs a weak_ptr instead of a shared_ptr to the disconnect function,
-   *        because the disconnect function is bound with an iterator to the Slot,
-   *        which is invalidated when the Slot is erased.
+  /** \brief The slots of the Signal.
+   *
+   *  \note The only shared_ptr to the SlotTable is owned by the Signal, so this weak_ptr expires
+   *        when the Signal is destructed, and the Connection cannot disconnect the handler again.
+   */
+  weak_ptr<SlotTable> m_slotTable;
+  /** \brief Identifies the handler's slot; zero for a default-constructed Connection.
    */
-  weak_ptr<DisconnectFunction> m_disconnect;
+  uint64_t m_slotId = 0;
 };
 
 } // namespace signal
@@ -22,10 +22,11 @@
 #ifndef NDN_CXX_UTIL_SIGNAL_SIGNAL_HPP
 #define NDN_CXX_UTIL_SIGNAL_SIGNAL_HPP
 
-#include "ndn-cxx/util/scope.hpp"
 #include "ndn-cxx/util/signal/connection.hpp"
 
-#include <list>
+#include <boost/container/small_vector.hpp>
+
+#include <algorithm>
 
 namespace ndn {
 namespace util {
@@ -44,19 +45,24 @@ class DummyExtraArg;
  *  To emit a signal from owner:
  *    this->signalName(arg1, arg2);
  *
+ *  Up to two handlers are stored inline in the signal object, so connecting a handler does not
+ *  allocate unless more handlers are connected, a handler is connected during emission, or the
+ *  handler itself does not fit in a std::function without allocating. The signal allocates a
+ *  single control block, shared with its Connections, when the first handler is connected.
+ *
  *  \tparam Owner the signal owner class; only this class can emit the signal
  *  \tparam TArgs types of signal arguments
  *  \sa signal-emit.hpp allows owner's derived classes to emit signals
  */
 template<typename Owner, typename ...TArgs>
-class Signal : noncopyable
+class Signal : noncopyable, private SlotTable
 {
 public: // API for anyone
   /** \brief Represents a function that can connect to the signal.
    */
   typedef function<void(const TArgs&...)> Handler;
 
-  Signal();
+  Signal() = default;
 
   ~Signal();
 
@@ -65,20 +71,29 @@ public: // API for anyone
    *  \warning The handler is permitted to disconnect itself, but it must ensure its validity.
    */
   Connection
-  connect(Handler handler);
+  connect(Handler handler)
+  {
+    return addSlot(std::move(handler), false);
+  }
 
   /** \brief Connects a single-shot handler to the signal.
    *
    *  After the handler is executed once, it is automatically disconnected.
    */
   Connection
-  connectSingleShot(Handler handler);
+  connectSingleShot(Handler handler)
+  {
+    return addSlot(std::move(handler), true);
+  }
 
 private: // API for owner
   /** \retval true if there is no connection
    */
   bool
-  isEmpty() const;
+  isEmpty() const
+  {
+    return !m_isExecuting && m_slots.empty();
+  }
 
   /** \brief Emits a signal.
    *  \param args arguments passed to all handlers
@@ -88,68 +103,94 @@ private: // API for owner
    *        who emits this signal, and some handlers may not be executed.
    */
   void
-  operator()(const TArgs&... args);
+  operator()(const TArgs&... args)
+  {
+    BOOST_ASSERT_MSG(!m_isExecuting, "cannot emit signal from a handler");
+
+    if (m_slots.empty()) {
+      return;
+    }
+    emitToSlots(args...);
+  }
 
   /** \brief (implementation detail) Emits a signal.
    *  \note This overload is used by signal-emit.hpp.
    */
   void
-  operator()(const TArgs&... args, const DummyExtraArg&);
+  operator()(const TArgs&... args, const DummyExtraArg&)
+  {
+    this->operator()(args...);
+  }
 
   // make Owner a friend of Signal<Owner, ...> so that API for owner can be called
   friend Owner;
 
 private: // internal implementation
-  typedef Signal<Owner, TArgs...> Self;
-
-  /** \brief Stores a handler function, and a function to disconnect this handler.
-   */
   struct Slot
   {
-    /** \brief The handler function who will receive emitted signals.
-     */
     Handler handler;
-
-    /** \brief The disconnect function which will disconnect this handler.
-     *
-     *  In practice this is the Signal::disconnect method bound to an iterator
-     *  pointing at this slot.
-     *
-     *  This is the only shared_ptr to this function object.
-     *  Connection class has a weak_ptr which references the same function object.
-     *  When the slot is erased or the signal is destructed, this function object is
-     *  destructed, and the related Connections cannot disconnect this slot again.
+    /** \brief Identifies the slot in Connections, never reused within this signal.
      */
-    shared_ptr<DisconnectFunction> disconnect;
+    uint64_t id;
+    bool isSingleShot;
   };
 
-  /** \brief Stores slots.
-   *  \note std::list is used because iterators must not be invalidated
-   *        when other slots are added or removed
+  Connection
+  addSlot(Handler handler, bool isSingleShot);
+
+  void
+  emitToSlots(const TArgs&... args);
+
+  void
+  finishEmission();
+
+  /** \brief Find a slot by identifier, excluding handlers connected during emission.
    */
-  typedef std::list<Slot> SlotList;
-  SlotList m_slots;
+  Slot*
+  findSlot(uint64_t slotId) const noexcept
+  {
+    for (auto& slot : m_slots) {
+      if (slot.id == slotId) {
+        return const_cast<Slot*>(&slot);
+      }
+    }
+    return nullptr;
+  }
 
-  /** \brief Is a signal handler executing?
+  bool
+  isSlotConnected(uint64_t slotId) const noexcept final;
+
+  void
+  disconnectSlot(uint64_t slotId) final;
+
+private:
+  boost::container::small_vector<Slot, 2> m_slots;
+
+  /** \brief Handlers connected during emission.
+   *
+   *  They are kept apart from m_slots, which must not be reallocated while a handler executes,
+   *  and moved to m_slots when the emission ends.
    */
-  bool m_isExecuting;
+  std::vector<Slot> m_pendingSlots;
 
-  /** \brief Iterator to current executing slot.
-   *  \note This field is meaningful when isExecuting==true
+  /** \brief Refers to this signal, without owning it.
+   *
+   *  This is the only shared_ptr to the control block. Connections have weak_ptrs that expire
+   *  when the signal is destructed.
    */
-  typename SlotList::iterator m_currentSlot;
+  shared_ptr<SlotTable> m_slotTable;
+  uint64_t m_lastSlotId = 0;
 
-  /** \brief Disconnects the handler in a slot.
+  /** \brief Is a signal handler executing?
    */
-  void
-  disconnect(typename SlotList::iterator it);
-};
+  bool m_isExecuting = false;
 
-template<typename Owner, typename ...TArgs>
-Signal<Owner, TArgs...>::Signal()
-  : m_isExecuting(false)
-{
-}
+  /** \brief Has the executing handler been disconnected?
+   *  \note This field, and m_currentSlotId, are meaningful when isExecuting==true
+   */
+  bool m_isCurrentSlotDisconnected = false;
+  uint64_t m_currentSlotId = 0;
+};
 
 template<typename Owner, typename ...TArgs>
 Signal<Owner, TArgs...>::~Signal()
@@ -159,91 +200,106 @@ Signal<Owner, TArgs...>::~Signal()
 
 template<typename Owner, typename ...TArgs>
 Connection
-Signal<Owner, TArgs...>::connect(Handler handler)
+Signal<Owner, TArgs...>::addSlot(Handler handler, bool isSingleShot)
 {
-  auto it = m_slots.insert(m_slots.end(), {std::move(handler), nullptr});
-  it->disconnect = make_shared<DisconnectFunction>([=] { disconnect(it); });
+  if (m_slotTable == nullptr) {
+    m_slotTable = shared_ptr<SlotTable>(static_cast<SlotTable*>(this), [] (SlotTable*) {});
+  }
 
-  return signal::Connection(it->disconnect);
+  uint64_t slotId = ++m_lastSlotId;
+  if (m_isExecuting) {
+    m_pendingSlots.push_back({std::move(handler), slotId, isSingleShot});
+  }
+  else {
+    m_slots.push_back({std::move(handler), slotId, isSingleShot});
+  }
+  return Connection(m_slotTable, slotId);
 }
 
 template<typename Owner, typename ...TArgs>
-Connection
-Signal<Owner, TArgs...>::connectSingleShot(Handler handler)
+void
+Signal<Owner, TArgs...>::emitToSlots(const TArgs&... args)
 {
-  auto it = m_slots.insert(m_slots.end(), {nullptr, nullptr});
-  it->disconnect = make_shared<DisconnectFunction>([=] { disconnect(it); });
-  signal::Connection conn(it->disconnect);
-
-  it->handler = [conn, handler = std::move(handler)] (const TArgs&... args) mutable {
-    handler(args...);
-    conn.disconnect();
-  };
-
-  return conn;
+  m_isExecuting = true;
+  try {
+    size_t i = 0;
+    while (i < m_slots.size()) {
+      // m_slots is not modified while a handler executes, so this reference stays valid
+      Slot& slot = m_slots[i];
+      m_currentSlotId = slot.id;
+
+      slot.handler(args...);
+
+      if (m_isCurrentSlotDisconnected || slot.isSingleShot) {
+        m_slots.erase(m_slots.begin() + i);
+        m_isCurrentSlotDisconnected = false;
+      }
+      else {
+        ++i;
+      }
+    }
+  }
+  catch (...) {
+    finishEmission();
+    throw;
+  }
+  finishEmission();
 }
 
 template<typename Owner, typename ...TArgs>
 void
-Signal<Owner, TArgs...>::disconnect(typename SlotList::iterator it)
+Signal<Owner, TArgs...>::finishEmission()
 {
-  if (m_isExecuting) {
-    // during signal emission, only the currently executing handler can be disconnected
-    BOOST_ASSERT_MSG(it == m_currentSlot, "cannot disconnect another handler from a handler");
-
-    // this serves to indicate that the current slot needs to be erased from the list
-    // after it finishes executing; we cannot do it here because of bug #2333
-    m_currentSlot = m_slots.end();
-
-    // expire all weak_ptrs, to prevent double disconnections
-    it->disconnect.reset();
+  m_isExecuting = false;
+
+  // a handler that disconnected itself before throwing an exception
+  if (m_isCurrentSlotDisconnected) {
+    m_isCurrentSlotDisconnected = false;
+    Slot* slot = findSlot(m_currentSlotId);
+    if (slot != nullptr) {
+      m_slots.erase(m_slots.begin() + (slot - m_slots.data()));
+    }
   }
-  else {
-    m_slots.erase(it);
+
+  // handlers connected during emission take effect from the next emission
+  if (!m_pendingSlots.empty()) {
+    for (auto& slot : m_pendingSlots) {
+      m_slots.push_back(std::move(slot));
+    }
+    m_pendingSlots.clear();
   }
 }
 
 template<typename Owner, typename ...TArgs>
 bool
-Signal<Owner, TArgs...>::isEmpty() const
+Signal<Owner, TArgs...>::isSlotConnected(uint64_t slotId) const noexcept
 {
-  return !m_isExecuting && m_slots.empty();
+  if (m_isExecuting && m_isCurrentSlotDisconnected && slotId == m_currentSlotId) {
+    return false;
+  }
+  return findSlot(slotId) != nullptr ||
+         std::any_of(m_pendingSlots.begin(), m_pendingSlots.end(),
+                     [slotId] (const Slot& slot) { return slot.id == slotId; });
 }
 
 template<typename Owner, typename ...TArgs>
 void
-Signal<Owner, TArgs...>::operator()(const TArgs&... args)
+Signal<Owner, TArgs...>::disconnectSlot(uint64_t slotId)
 {
-  BOOST_ASSERT_MSG(!m_isExecuting, "cannot emit signal from a handler");
-
-  if (m_slots.empty()) {
+  if (!isSlotConnected(slotId)) {
     return;
   }
 
-  auto guard = make_scope_exit([this] { m_isExecuting = false; });
-  m_isExecuting = true;
-
-  auto it = m_slots.begin();
-  auto last = std::prev(m_slots.end());
-  bool isLast = false;
-  while (!isLast) {
-    m_currentSlot = it;
-    isLast = it == last;
-
-    m_currentSlot->handler(args...);
+  if (m_isExecuting) {
+    // during signal emission, only the currently executing handler can be disconnected
+    BOOST_ASSERT_MSG(slotId == m_currentSlotId, "cannot disconnect another handler from a handler");
 
-    if (m_currentSlot == m_slots.end())
-      it = m_slots.erase(it);
-    else
-      ++it;
+    // the slot is erased after the handler finishes executing
+    m_isCurrentSlotDisconnected = true;
+  }
+  else {
+    m_slots.erase(m_slots.begin() + (findSlot(slotId) - m_slots.data()));
   }
-}
-
-template<typename Owner, typename ...TArgs>
-void
-Signal<Owner, TArgs...>::operator()(const TArgs&... args, const DummyExtraArg&)
-{
-  this->operator()(args...);
 }
 
 } // namespace signal
@@ -20,12 +20,10 @@
  */
 
 #include "ndn-cxx/util/string-helper.hpp"
-#include "ndn-cxx/encoding/buffer-stream.hpp"
-#include "ndn-cxx/security/transform/buffer-source.hpp"
-#include "ndn-cxx/security/transform/hex-decode.hpp"
-#include "ndn-cxx/security/transform/hex-encode.hpp"
-#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/util/impl/base64.hpp"
+#include "ndn-cxx/util/impl/simd-codec.hpp"
 
+#include <array>
 #include <sstream>
 
 namespace ndn {
@@ -44,32 +42,121 @@ printHex(std::ostream& os, uint64_t num, bool wantUpperCase)
 void
 printHex(std::ostream& os, span<const uint8_t> buffer, bool wantUpperCase)
 {
-  namespace tr = security::transform;
-  tr::bufferSource(buffer) >> tr::hexEncode(wantUpperCase) >> tr::streamSink(os);
+  std::array<char, 256> chunk;
+  while (!buffer.empty()) {
+    auto part = buffer.first(std::min(buffer.size(), chunk.size() / 2));
+    os.write(chunk.data(), static_cast<std::streamsize>(toHex(part, chunk, wantUpperCase)));
+    buffer = buffer.subspan(part.size());
+  }
 }
 
 std::string
 toHex(span<const uint8_t> buffer, bool wantUpperCase)
 {
-  std::ostringstream result;
-  printHex(result, buffer, wantUpperCase);
-  return result.str();
+  std::string result(buffer.size() * 2, '\0');
+  toHex(buffer, {&result[0], result.size()}, wantUpperCase);
+  return result;
+}
+
+size_t
+toHex(span<const uint8_t> buffer, span<char> output, bool wantUpperCase)
+{
+  if (output.size() < buffer.size() * 2)
+    NDN_THROW(StringHelperError("Output buffer is too small for hex conversion"));
+
+  const char* digits = wantUpperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+  char* out = output.data();
+  size_t nVector = util::detail::encodeHexBlocks(buffer.data(), buffer.size(), out, wantUpperCase);
+  out += nVector * 2;
+  for (uint8_t b : buffer.subspan(nVector)) {
+    out[0] = digits[b >> 4];
+    out[1] = digits[b & 0xf];
+    out += 2;
+  }
+  return buffer.size() * 2;
 }
 
 shared_ptr<Buffer>
 fromHex(const std::string& hexString)
 {
-  namespace tr = security::transform;
+  auto buffer = make_shared<Buffer>(hexString.size() / 2);
+  fromHex(hexString, *buffer);
+  return buffer;
+}
 
-  OBufferStream os;
-  try {
-    tr::bufferSource(hexString) >> tr::hexDecode() >> tr::streamSink(os);
-  }
-  catch (const tr::Error& e) {
-    NDN_THROW_NESTED(StringHelperError("Conversion from hex failed: "s + e.what()));
+size_t
+fromHex(span<const char> hex, span<uint8_t> output)
+{
+  if (hex.size() % 2 != 0)
+    NDN_THROW(StringHelperError("Conversion from hex failed: incomplete input"));
+  if (output.size() < hex.size() / 2)
+    NDN_THROW(StringHelperError("Output buffer is too small for hex conversion"));
+
+  // the vector kernel stops before an invalid character, which is then reported below
+  size_t nVector = util::detail::decodeHexBlocks(hex.data(), hex.size(), output.data());
+  uint8_t* out = output.data() + nVector / 2;
+  for (size_t i = nVector; i < hex.size(); i += 2) {
+    int hi = fromHexChar(hex[i]);
+    int lo = fromHexChar(hex[i + 1]);
+    if (hi < 0 || lo < 0)
+      NDN_THROW(StringHelperError("Conversion from hex failed: invalid character"));
+    *out++ = static_cast<uint8_t>((hi << 4) | lo);
   }
+  return hex.size() / 2;
+}
+
+static size_t
+getBase64EncodedSize(size_t nBytes, bool needBreak)
+{
+  size_t nChars = (nBytes + 2) / 3 * 4;
+  return needBreak ? nChars + (nChars + 63) / 64 : nChars;
+}
 
-  return os.buf();
+std::string
+toBase64(span<const uint8_t> buffer, bool needBreak)
+{
+  std::string result(getBase64EncodedSize(buffer.size(), needBreak), '\0');
+  toBase64(buffer, {&result[0], result.size()}, needBreak);
+  return result;
+}
+
+size_t
+toBase64(span<const uint8_t> buffer, span<char> output, bool needBreak)
+{
+  size_t size = getBase64EncodedSize(buffer.size(), needBreak);
+  if (output.size() < size)
+    NDN_THROW(StringHelperError("Output buffer is too small for base64 conversion"));
+
+  util::detail::Base64Encoder encoder(needBreak);
+  auto out = reinterpret_cast<uint8_t*>(output.data());
+  size_t nWritten = encoder.update(buffer, out);
+  nWritten += encoder.finish(out + nWritten);
+  BOOST_ASSERT(nWritten == size);
+  return nWritten;
+}
+
+shared_ptr<Buffer>
+fromBase64(const std::string& base64String)
+{
+  auto buffer = make_shared<Buffer>((base64String.size() + 3) / 4 * 3);
+  buffer->resize(fromBase64(base64String, *buffer));
+  return buffer;
+}
+
+size_t
+fromBase64(span<const char> base64, span<uint8_t> output)
+{
+  util::detail::Base64Decoder decoder;
+  if (output.size() < decoder.getMaxOutputSize(base64.size()))
+    NDN_THROW(StringHelperError("Output buffer is too small for base64 conversion"));
+
+  size_t nWritten = 0;
+  size_t nLast = 0;
+  if (!decoder.update({reinterpret_cast<const uint8_t*>(base64.data()), base64.size()},
+                      output.data(), nWritten) ||
+      !decoder.finish(output.data() + nWritten, nLast))
+    NDN_THROW(StringHelperError("Conversion from base64 failed: invalid input"));
+  return nWritten + nLast;
 }
 
 std::string
@@ -111,6 +111,78 @@ toHex(span<const uint8_t> buffer, bool wantUpperCase = true);
 shared_ptr<Buffer>
 fromHex(const std::string& hexString);
 
+/**
+ * @brief Write the hex representation of the bytes in @p buffer into @p output.
+ *
+ * @param buffer Range of bytes to convert to hexadecimal format
+ * @param output Destination, which must be at least `2 * buffer.size()` characters long
+ * @param wantUpperCase if true (the default) use uppercase hex chars
+ * @return The number of characters written, i.e., `2 * buffer.size()`
+ * @throw StringHelperError @p output is too small
+ */
+size_t
+toHex(span<const uint8_t> buffer, span<char> output, bool wantUpperCase = true);
+
+/**
+ * @brief Convert the hex string @p hex into bytes written to @p output.
+ *
+ * @param hex Sequence of pairs of hex numbers (lower and upper case can be mixed)
+ *        without any whitespace separators
+ * @param output Destination, which must be at least `hex.size() / 2` bytes long
+ * @return The number of bytes written
+ * @throw StringHelperError Input string is invalid, or @p output is too small
+ * @note A string literal passed as @p hex includes its terminating NUL character, which is
+ *       invalid input; pass a `std::string` or an explicit `{ptr, len}` span instead.
+ */
+size_t
+fromHex(span<const char> hex, span<uint8_t> output);
+
+/**
+ * @brief Return a string containing the base64 representation of the bytes in @p buffer.
+ *
+ * @param buffer Range of bytes to encode
+ * @param needBreak if true (the default), insert a newline after every 64 characters and at
+ *                  the end of the output, in the same format as transform::base64Encode()
+ */
+NDN_CXX_NODISCARD std::string
+toBase64(span<const uint8_t> buffer, bool needBreak = true);
+
+/**
+ * @brief Write the base64 representation of the bytes in @p buffer into @p output.
+ *
+ * @param buffer Range of bytes to encode
+ * @param output Destination, which must be at least `4 * ceil(buffer.size() / 3)` characters
+ *               long, plus one character for every (possibly incomplete) line of 64 characters
+ *               if @p needBreak is true
+ * @param needBreak whether to insert newlines, see toBase64(span<const uint8_t>, bool)
+ * @return The number of characters written
+ * @throw StringHelperError @p output is too small
+ */
+size_t
+toBase64(span<const uint8_t> buffer, span<char> output, bool needBreak = true);
+
+/**
+ * @brief Convert a base64 string to a raw byte buffer.
+ *
+ * Whitespace and newlines are ignored, and the padding at the end may be omitted.
+ *
+ * @throw StringHelperError Input string is invalid
+ */
+shared_ptr<Buffer>
+fromBase64(const std::string& base64String);
+
+/**
+ * @brief Convert the base64 string @p base64 into bytes written to @p output.
+ *
+ * @param base64 Base64 string, in the same format as accepted by fromBase64(const std::string&)
+ * @param output Destination, which must be at least `3 * ceil(base64.size() / 4)` bytes long
+ * @return The number of bytes written
+ * @throw StringHelperError Input string is invalid, or @p output is too small
+ * @note As with fromHex(span<const char>, span<uint8_t>), do not pass a string literal directly.
+ */
+size_t
+fromBase64(span<const char> base64, span<uint8_t> output);
+
 /**
  * @brief Convert (the least significant nibble of) @p n to the corresponding hex character.
  */
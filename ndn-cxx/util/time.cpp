@@ -167,9 +167,96 @@ convertToTimePoint(const boost::posix_time::ptime& ptime)
 system_clock::time_point
 fromIsoString(const std::string& isoString)
 {
+  auto timePoint = parseIsoString(isoString);
+  if (timePoint) {
+    return *timePoint;
+  }
+  // less common variants of the format, as well as error reporting, are left to Boost
   return convertToTimePoint(boost::posix_time::from_iso_string(isoString));
 }
 
+/**
+ * \brief Parse exactly \p n decimal digits at \p pos and advance \p pos
+ * \return the value, or -1 if a non-digit character is found
+ */
+static int
+parseDigits(const char*& pos, size_t n) noexcept
+{
+  int value = 0;
+  for (const char* end = pos + n; pos != end; ++pos) {
+    if (*pos < '0' || *pos > '9') {
+      return -1;
+    }
+    value = value * 10 + (*pos - '0');
+  }
+  return value;
+}
+
+/**
+ * \brief Return the number of days since 1970-01-01 of a date in the proleptic Gregorian calendar
+ */
+static int_fast64_t
+daysFromCivil(int year, int month, int day) noexcept
+{
+  // http://howardhinnant.github.io/date_algorithms.html#days_from_civil
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int yoe = year - era * 400;                                        // [0, 399]
+  const int doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1; // [0, 365]
+  const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                   // [0, 146096]
+  return int_fast64_t{era} * 146097 + doe - 719468;
+}
+
+optional<system_clock::time_point>
+parseIsoString(span<const char> isoString) noexcept
+{
+  constexpr size_t DATETIME_SIZE = 15; // YYYYMMDDTHHMMSS
+  if (isoString.size() < DATETIME_SIZE || isoString[8] != 'T') {
+    return nullopt;
+  }
+
+  const char* pos = isoString.data();
+  const char* const end = pos + isoString.size();
+  int year = parseDigits(pos, 4);
+  int month = parseDigits(pos, 2);
+  int day = parseDigits(pos, 2);
+  ++pos; // 'T'
+  int hour = parseDigits(pos, 2);
+  int minute = parseDigits(pos, 2);
+  int second = parseDigits(pos, 2);
+  if (year < 1400 || month < 1 || month > 12 || day < 1 ||
+      hour < 0 || hour > 23 || minute < 0 || minute > 59 || second < 0 || second > 59) {
+    return nullopt;
+  }
+
+  static const int DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+  bool isLeapYear = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+  if (day > DAYS_IN_MONTH[month - 1] + (month == 2 && isLeapYear)) {
+    return nullopt;
+  }
+
+  int_fast64_t micros = 0;
+  if (pos != end && (*pos == ',' || *pos == '.')) {
+    ++pos;
+    if (pos == end || *pos < '0' || *pos > '9') {
+      return nullopt;
+    }
+    int_fast64_t scale = 100000;
+    for (; pos != end && *pos >= '0' && *pos <= '9'; ++pos, scale /= 10) {
+      micros += (*pos - '0') * scale;
+    }
+  }
+  if (pos != end && *pos == 'Z') {
+    ++pos;
+  }
+  if (pos != end) {
+    return nullopt;
+  }
+
+  auto sinceEpoch = seconds(daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second);
+  return system_clock::time_point(sinceEpoch) + microseconds(micros);
+}
+
 system_clock::time_point
 fromIsoExtendedString(const std::string& isoString)
 {
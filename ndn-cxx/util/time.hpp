@@ -23,6 +23,8 @@
 #define NDN_CXX_UTIL_TIME_HPP
 
 #include "ndn-cxx/detail/common.hpp"
+#include "ndn-cxx/util/optional.hpp"
+#include "ndn-cxx/util/span.hpp"
 
 #include <boost/asio/wait_traits.hpp>
 #include <boost/chrono.hpp>
@@ -299,6 +301,21 @@ toIsoString(const system_clock::time_point& timePoint);
 system_clock::time_point
 fromIsoString(const std::string& isoString);
 
+/**
+ * \brief Parse a timestamp in the ISO 8601 basic format (`YYYYMMDDTHHMMSS,ffffff`) without
+ *        allocating memory.
+ *
+ * This is a fast path for the fixed format produced by toIsoString(), as found in certificate
+ * validity periods. A comma or a period may separate the optional fractional seconds, which are
+ * truncated to microseconds, and a trailing `Z` is permitted. The year must be between 1400 and
+ * 9999, like fromIsoString().
+ *
+ * \return the time point, or nullopt if \p isoString is not in the expected format or does not
+ *         denote a valid date and time
+ */
+optional<system_clock::time_point>
+parseIsoString(span<const char> isoString) noexcept;
+
 /**
  * \brief Convert to the ISO 8601 string representation, extended format (`YYYY-MM-DDTHH:MM:SS,fffffffff`).
  */
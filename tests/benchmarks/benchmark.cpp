@@ -0,0 +1,485 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tests/benchmarks/benchmark.hpp"
+#include "ndn-cxx/version.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <numeric>
+#include <sstream>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+namespace ndn {
+namespace tests {
+
+// updated by the replacement operator new below; plain thread-local counters avoid adding
+// atomic operations to every allocation in the measured code
+static thread_local AllocationStats t_allocations;
+
+AllocationStats
+getAllocationStats() noexcept
+{
+  return t_allocations;
+}
+
+namespace po = boost::program_options;
+
+po::options_description&
+getProgramOptions()
+{
+  static po::options_description options("Program options");
+  return options;
+}
+
+namespace {
+
+struct HarnessOptions
+{
+  optional<size_t> warmup;
+  optional<size_t> repetitions;
+  optional<int> cpu;
+  std::string format = "json";
+  std::string output;
+};
+
+HarnessOptions&
+getOptions()
+{
+  static HarnessOptions options;
+  return options;
+}
+
+std::vector<BenchmarkResult>&
+getResults()
+{
+  static std::vector<BenchmarkResult> results;
+  return results;
+}
+
+double
+computePercentile(const std::vector<double>& sorted, double percentile)
+{
+  BOOST_ASSERT(!sorted.empty());
+  double rank = percentile / 100.0 * (sorted.size() - 1);
+  auto lower = static_cast<size_t>(std::floor(rank));
+  auto upper = std::min(lower + 1, sorted.size() - 1);
+  return sorted[lower] + (sorted[upper] - sorted[lower]) * (rank - lower);
+}
+
+std::string
+escapeJson(const std::string& s)
+{
+  std::string escaped;
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+std::string
+escapeCsv(const std::string& s)
+{
+  if (s.find_first_of(",\"") == std::string::npos) {
+    return s;
+  }
+  std::string escaped = "\"";
+  for (char c : s) {
+    if (c == '"') {
+      escaped += '"';
+    }
+    escaped += c;
+  }
+  return escaped + '"';
+}
+
+const char*
+getBuildType()
+{
+#ifdef NDEBUG
+  return "release";
+#else
+  return "debug";
+#endif
+}
+
+void
+writeJson(std::ostream& os, const std::vector<BenchmarkResult>& results)
+{
+  const auto& options = getOptions();
+  auto& master = boost::unit_test::framework::master_test_suite();
+
+  os << "{\n"
+     << "  \"context\": {\n"
+     << "    \"program\": \"" << escapeJson(master.p_name.get()) << "\",\n"
+     << "    \"version\": \"" << escapeJson(NDN_CXX_VERSION_BUILD_STRING) << "\",\n"
+     << "    \"build\": \"" << getBuildType() << "\",\n"
+     << "    \"date\": \"" << time::toIsoString(time::system_clock::now()) << "\",\n"
+     << "    \"cpu\": " << options.cpu.value_or(-1) << "\n"
+     << "  },\n"
+     << "  \"unit\": \"ns/op\",\n"
+     << "  \"benchmarks\": [";
+
+  std::string separator = "\n";
+  for (const auto& r : results) {
+    os << separator
+       << "    {\n"
+       << "      \"name\": \"" << escapeJson(r.name) << "\",\n"
+       << "      \"operations\": " << r.nOperations << ",\n"
+       << "      \"repetitions\": " << r.samples.size() << ",\n"
+       << "      \"min\": " << r.min << ",\n"
+       << "      \"median\": " << r.median << ",\n"
+       << "      \"p90\": " << r.p90 << ",\n"
+       << "      \"p99\": " << r.p99 << ",\n"
+       << "      \"max\": " << r.max << ",\n"
+       << "      \"mean\": " << r.mean << ",\n"
+       << "      \"stddev\": " << r.stddev << ",\n"
+       << "      \"metrics\": {";
+    std::string metricSeparator;
+    for (const auto& metric : r.metrics) {
+      os << metricSeparator << "\"" << escapeJson(metric.first) << "\": " << metric.second;
+      metricSeparator = ", ";
+    }
+    os << "}\n"
+       << "    }";
+    separator = ",\n";
+  }
+  os << "\n  ]\n"
+     << "}\n";
+}
+
+void
+writeCsv(std::ostream& os, const std::vector<BenchmarkResult>& results)
+{
+  os << "name,operations,repetitions,min,median,p90,p99,max,mean,stddev,metrics\n";
+  for (const auto& r : results) {
+    std::string metrics;
+    for (const auto& metric : r.metrics) {
+      if (!metrics.empty()) {
+        metrics += ';';
+      }
+      metrics += metric.first + '=' + std::to_string(metric.second);
+    }
+    os << escapeCsv(r.name) << ',' << r.nOperations << ',' << r.samples.size() << ','
+       << r.min << ',' << r.median << ',' << r.p90 << ',' << r.p99 << ',' << r.max << ','
+       << r.mean << ',' << r.stddev << ',' << escapeCsv(metrics) << '\n';
+  }
+}
+
+void
+printResult(const BenchmarkResult& r)
+{
+  std::ostringstream os;
+  os << std::left << std::setw(40) << r.name << std::right
+     << std::fixed << std::setprecision(1)
+     << " median=" << r.median << "ns"
+     << " p90=" << r.p90 << "ns"
+     << " p99=" << r.p99 << "ns"
+     << " mean=" << r.mean << "ns"
+     << " stddev=" << r.stddev << "ns";
+  for (const auto& metric : r.metrics) {
+    os << " " << metric.first << "=" << metric.second;
+  }
+  std::cout << os.str() << std::endl;
+}
+
+void
+pinToCpu(int cpu)
+{
+#ifdef __linux__
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+    std::cerr << "WARNING: cannot pin to CPU " << cpu << ": " << std::strerror(errno) << std::endl;
+  }
+#else
+  std::cerr << "WARNING: CPU pinning is not supported on this platform" << std::endl;
+#endif
+}
+
+/**
+ * @brief Parses harness options before the first benchmark and writes results after the last.
+ */
+class BenchmarkHarness
+{
+public:
+  BenchmarkHarness()
+  {
+    auto& master = boost::unit_test::framework::master_test_suite();
+    auto& options = getOptions();
+
+    size_t warmup = 0;
+    size_t repetitions = 0;
+    int cpu = -1;
+    po::options_description description("Benchmark options");
+    description.add_options()
+      ("warmup",      po::value<size_t>(&warmup), "number of unmeasured runs")
+      ("repetitions", po::value<size_t>(&repetitions), "number of measured runs")
+      ("cpu",         po::value<int>(&cpu), "pin the benchmark thread to this CPU")
+      ("format",      po::value<std::string>(&options.format), "results format: json or csv")
+      ("output",      po::value<std::string>(&options.output), "results file, '-' for stdout")
+      ;
+    description.add(getProgramOptions());
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(master.argc, master.argv, description), vm);
+    po::notify(vm);
+
+    if (vm.count("warmup") > 0) {
+      options.warmup = warmup;
+    }
+    if (vm.count("repetitions") > 0) {
+      if (repetitions == 0) {
+        BOOST_FAIL("--repetitions must be positive");
+      }
+      options.repetitions = repetitions;
+    }
+    if (options.format != "json" && options.format != "csv") {
+      BOOST_FAIL("--format must be json or csv");
+    }
+    if (vm.count("cpu") > 0) {
+      options.cpu = cpu;
+      pinToCpu(cpu);
+    }
+
+#ifndef NDEBUG
+    std::cerr << "WARNING: benchmarks are not compiled in release mode, "
+                 "results will not be representative" << std::endl;
+#endif
+  }
+
+  ~BenchmarkHarness()
+  {
+    const auto& options = getOptions();
+    if (options.output.empty()) {
+      return;
+    }
+
+    std::ofstream file;
+    std::ostream* os = &std::cout;
+    if (options.output != "-") {
+      file.open(options.output);
+      if (!file) {
+        std::cerr << "ERROR: cannot open " << options.output << std::endl;
+        return;
+      }
+      os = &file;
+    }
+
+    if (options.format == "csv") {
+      writeCsv(*os, getResults());
+    }
+    else {
+      writeJson(*os, getResults());
+    }
+  }
+};
+
+BOOST_TEST_GLOBAL_FIXTURE(BenchmarkHarness);
+
+} // namespace
+
+Benchmark::Benchmark(std::string name, uint64_t nOperations)
+{
+  BOOST_ASSERT(nOperations > 0);
+  m_result.name = std::move(name);
+  m_result.nOperations = nOperations;
+}
+
+Benchmark::~Benchmark()
+{
+  if (!m_hasRun) {
+    return;
+  }
+  printResult(m_result);
+  getResults().push_back(std::move(m_result));
+}
+
+Benchmark&
+Benchmark::setWarmup(size_t nRuns)
+{
+  m_warmup = nRuns;
+  return *this;
+}
+
+Benchmark&
+Benchmark::setRepetitions(size_t nRuns)
+{
+  BOOST_ASSERT(nRuns > 0);
+  m_repetitions = nRuns;
+  return *this;
+}
+
+Benchmark&
+Benchmark::addAllocationMetrics(const AllocationStats& allocations)
+{
+  double nOperations = static_cast<double>(m_result.nOperations) * m_result.samples.size();
+  addMetric("allocs/op", allocations.nAllocations / nOperations);
+  addMetric("bytes/op", allocations.nBytes / nOperations);
+  return *this;
+}
+
+Benchmark&
+Benchmark::addMetric(const std::string& name, double value)
+{
+  m_result.metrics[name] = value;
+  return *this;
+}
+
+size_t
+Benchmark::getWarmup() const
+{
+  return getOptions().warmup.value_or(m_warmup);
+}
+
+size_t
+Benchmark::getRepetitions() const
+{
+  return getOptions().repetitions.value_or(m_repetitions);
+}
+
+void
+Benchmark::computeStatistics(const std::vector<time::nanoseconds>& durations)
+{
+  BOOST_ASSERT(!durations.empty());
+  auto& r = m_result;
+
+  r.samples.clear();
+  for (auto d : durations) {
+    r.samples.push_back(static_cast<double>(d.count()) / r.nOperations);
+  }
+
+  std::vector<double> sorted(r.samples);
+  std::sort(sorted.begin(), sorted.end());
+  r.min = sorted.front();
+  r.max = sorted.back();
+  r.median = computePercentile(sorted, 50);
+  r.p90 = computePercentile(sorted, 90);
+  r.p99 = computePercentile(sorted, 99);
+
+  r.mean = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+  double sumSquares = 0;
+  for (double x : sorted) {
+    sumSquares += (x - r.mean) * (x - r.mean);
+  }
+  r.stddev = sorted.size() > 1 ? std::sqrt(sumSquares / (sorted.size() - 1)) : 0;
+
+  m_hasRun = true;
+}
+
+} // namespace tests
+} // namespace ndn
+
+// Replacing the global allocation functions in the benchmark programs also counts the
+// allocations made inside libndn-cxx, which calls them through the dynamic linker.
+
+static void*
+allocate(std::size_t size) noexcept
+{
+  auto& stats = ndn::tests::t_allocations;
+  ++stats.nAllocations;
+  stats.nBytes += size;
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void*
+operator new(std::size_t size)
+{
+  void* p = allocate(size);
+  if (p == nullptr) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void*
+operator new[](std::size_t size)
+{
+  return ::operator new(size);
+}
+
+void*
+operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void*
+operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+  return allocate(size);
+}
+
+void
+operator delete(void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void* p) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void* p, std::size_t) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete(void* p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
+
+void
+operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+  std::free(p);
+}
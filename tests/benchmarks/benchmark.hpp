@@ -0,0 +1,238 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_TESTS_BENCHMARKS_BENCHMARK_HPP
+#define NDN_CXX_TESTS_BENCHMARKS_BENCHMARK_HPP
+
+#include "tests/benchmarks/timed-execute.hpp"
+
+#include <boost/program_options/options_description.hpp>
+
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @brief Benchmark harness shared by the programs in tests/benchmarks.
+ *
+ * Each benchmark program is a Boost.Test module; every benchmark within it is measured by a
+ * Benchmark object, which runs the workload a number of times for warmup, then a number of
+ * repetitions whose durations are turned into per-operation statistics. Memory allocations are
+ * counted by replacing the global operator new in the benchmark programs. Results are printed
+ * as they complete, and written in JSON or CSV format when the program exits.
+ *
+ * The harness accepts the following options after a `--` separator on the command line:
+ *
+ *   --warmup=N        number of unmeasured runs before the repetitions (default: 1)
+ *   --repetitions=N   number of measured runs (default: 10)
+ *   --cpu=N           pin the benchmark thread to CPU N (Linux only)
+ *   --format=F        format of the results file: json (default) or csv
+ *   --output=FILE     write the results to FILE; '-' writes them to stdout
+ *
+ * For example:
+ *
+ *     build/tests/benchmarks/encoding-bench -- --cpu=2 --output=results.json
+ *
+ * Results files are compared with `tests/benchmarks/compare.py`.
+ */
+
+namespace ndn {
+namespace tests {
+
+/**
+ * @brief Prevent the compiler from optimizing away the computation of @p value.
+ */
+template<typename T>
+inline void
+doNotOptimize(const T& value)
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Return the description of command-line options specific to the benchmark program.
+ *
+ * Options added before the program starts, e.g., from the initializer of a namespace-scope
+ * variable, are accepted after `--` together with the harness options.
+ */
+boost::program_options::options_description&
+getProgramOptions();
+
+/**
+ * @brief Memory allocated through operator new by the calling thread since it started.
+ */
+struct AllocationStats
+{
+  uint64_t nAllocations = 0;
+  uint64_t nBytes = 0;
+};
+
+AllocationStats
+getAllocationStats() noexcept;
+
+/**
+ * @brief Statistics of a benchmark, in nanoseconds per operation.
+ */
+struct BenchmarkResult
+{
+  std::string name;
+  uint64_t nOperations = 0;
+  /// duration per operation of each repetition
+  std::vector<double> samples;
+
+  double min = 0;
+  double max = 0;
+  double mean = 0;
+  double stddev = 0;
+  double median = 0;
+  double p90 = 0;
+  double p99 = 0;
+
+  /// additional per-operation metrics reported by the benchmark, e.g., allocations
+  std::map<std::string, double> metrics;
+};
+
+/**
+ * @brief Measures a workload and reports its statistics.
+ *
+ * @code
+ * Benchmark("Name/Decode", N_ITERATIONS).run([&] {
+ *   for (int i = 0; i < N_ITERATIONS; ++i) {
+ *     Name name(wire);
+ *     doNotOptimize(name);
+ *   }
+ * });
+ * @endcode
+ *
+ * The result is reported when the Benchmark object is destroyed, so that metrics can be added
+ * after the run. Warmup and repetition counts given on the command line override those set on
+ * the object.
+ */
+class Benchmark : noncopyable
+{
+public:
+  /**
+   * @param name benchmark name, unique within the program; '/' may be used for grouping
+   * @param nOperations number of operations performed by each run of the workload
+   */
+  explicit
+  Benchmark(std::string name, uint64_t nOperations = 1);
+
+  ~Benchmark();
+
+  Benchmark&
+  setWarmup(size_t nRuns);
+
+  Benchmark&
+  setRepetitions(size_t nRuns);
+
+  /**
+   * @brief Attach an additional metric to the result, such as allocations per operation.
+   */
+  Benchmark&
+  addMetric(const std::string& name, double value);
+
+  /**
+   * @brief Run @p f for warmup and repetitions, measuring the duration of each call.
+   *
+   * Allocations made by the calling thread during the repetitions are reported as the
+   * `allocs/op` and `bytes/op` metrics.
+   */
+  template<typename F>
+  Benchmark&
+  run(F&& f)
+  {
+    size_t nWarmup = getWarmup();
+    size_t nRuns = 0;
+    AllocationStats allocations;
+    runTimed([&] {
+      auto before = getAllocationStats();
+      auto d = timedExecute(f);
+      auto after = getAllocationStats();
+      if (nRuns++ >= nWarmup) {
+        allocations.nAllocations += after.nAllocations - before.nAllocations;
+        allocations.nBytes += after.nBytes - before.nBytes;
+      }
+      return d;
+    });
+    return addAllocationMetrics(allocations);
+  }
+
+  /**
+   * @brief Run @p f for warmup and repetitions, using its return value as the duration.
+   *
+   * This is used when the workload has to exclude setup costs from the measurement, or is
+   * measured by other means than the wall-clock duration of a function call.
+   */
+  template<typename F>
+  Benchmark&
+  runTimed(F&& f)
+  {
+    for (size_t i = 0; i < getWarmup(); ++i) {
+      f();
+    }
+    size_t nRepetitions = getRepetitions();
+    std::vector<time::nanoseconds> durations;
+    durations.reserve(nRepetitions);
+    for (size_t i = 0; i < nRepetitions; ++i) {
+      durations.push_back(f());
+    }
+    computeStatistics(durations);
+    return *this;
+  }
+
+  const BenchmarkResult&
+  getResult() const
+  {
+    return m_result;
+  }
+
+  /**
+   * @brief Return the number of warmup runs, after applying command-line options.
+   */
+  size_t
+  getWarmup() const;
+
+  /**
+   * @brief Return the number of measured runs, after applying command-line options.
+   */
+  size_t
+  getRepetitions() const;
+
+private:
+  void
+  computeStatistics(const std::vector<time::nanoseconds>& durations);
+
+  Benchmark&
+  addAllocationMetrics(const AllocationStats& allocations);
+
+private:
+  BenchmarkResult m_result;
+  size_t m_warmup = 1;
+  size_t m_repetitions = 10;
+  bool m_hasRun = false;
+};
+
+} // namespace tests
+} // namespace ndn
+
+#endif // NDN_CXX_TESTS_BENCHMARKS_BENCHMARK_HPP
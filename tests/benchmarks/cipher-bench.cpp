@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Cipher Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/transform/aead-cipher.hpp"
+#include "ndn-cxx/security/transform/aead-filter.hpp"
+#include "ndn-cxx/security/transform/block-cipher.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/util/random.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::security;
+using namespace ndn::security::transform;
+
+const size_t N_ITERATIONS = 2000;
+const size_t PAYLOAD_SIZES[] = {1024, 8192};
+
+/**
+ * @brief Run @p f once per iteration and report the throughput of @p payloadSize bytes each.
+ */
+template<typename F>
+static void
+benchmarkCipher(const std::string& name, size_t payloadSize, F&& f)
+{
+  Benchmark bm(name + "/" + to_string(payloadSize), N_ITERATIONS);
+  bm.run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      f();
+    }
+  });
+  bm.addMetric("MB/s", payloadSize * 1000.0 / bm.getResult().median);
+}
+
+class CipherFixture
+{
+protected:
+  CipherFixture()
+  {
+    random::generateSecureBytes(key);
+    random::generateSecureBytes(iv);
+  }
+
+protected:
+  std::array<uint8_t, 16> key;
+  std::array<uint8_t, 16> iv;
+  AeadNonceSequence nonces{1};
+};
+
+BOOST_FIXTURE_TEST_CASE(BlockCipherAesCbc, CipherFixture)
+{
+  for (size_t size : PAYLOAD_SIZES) {
+    Buffer payload(size);
+    benchmarkCipher("Encrypt/AES-128-CBC/BlockCipher", size, [&] {
+      OBufferStream os;
+      bufferSource(payload) >> blockCipher(BlockCipherAlgorithm::AES_CBC, CipherOperator::ENCRYPT, key, iv)
+                            >> streamSink(os);
+      doNotOptimize(os.buf());
+    });
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(AeadFilterAesGcm, CipherFixture)
+{
+  for (size_t size : PAYLOAD_SIZES) {
+    Buffer payload(size);
+    benchmarkCipher("Encrypt/AES-128-GCM/AeadFilter", size, [&] {
+      OBufferStream os;
+      auto nonce = nonces.next();
+      bufferSource(payload) >> aeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::ENCRYPT, key, nonce)
+                            >> streamSink(os);
+      doNotOptimize(os.buf());
+    });
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE(AeadCipherInPlace, CipherFixture)
+{
+  std::array<uint8_t, 32> key256;
+  random::generateSecureBytes(key256);
+
+  // AES-GCM uses the same 128-bit key as the AES-CBC and AeadFilter cases; ChaCha20-Poly1305
+  // only accepts 256-bit keys, so it is measured against AES-GCM with a 256-bit key as well
+  struct
+  {
+    AeadAlgorithm algo;
+    span<const uint8_t> key;
+    std::string name;
+  } const configs[] = {
+    {AeadAlgorithm::AES_GCM, key, "AES-128-GCM"},
+    {AeadAlgorithm::AES_GCM, key256, "AES-256-GCM"},
+    {AeadAlgorithm::CHACHA20_POLY1305, key256, "CHACHA20-POLY1305"},
+  };
+
+  for (const auto& config : configs) {
+    AeadCipher cipher(config.algo, config.key);
+    const std::string& algoName = config.name;
+
+    for (size_t size : PAYLOAD_SIZES) {
+      Buffer payload(size);
+      std::array<uint8_t, AeadCipher::TAG_SIZE> tag;
+      benchmarkCipher("Encrypt/" + algoName + "/InPlace", size, [&] {
+        cipher.encrypt(nonces.next(), {}, payload, payload, tag);
+        doNotOptimize(tag);
+      });
+
+      // decrypt a single sealed payload repeatedly
+      auto nonce = nonces.next();
+      cipher.encrypt(nonce, {}, payload, payload, tag);
+      Buffer sealed(payload);
+      benchmarkCipher("Decrypt/" + algoName + "/InPlace", size, [&] {
+        std::copy(sealed.begin(), sealed.end(), payload.begin());
+        bool ok = cipher.decrypt(nonce, {}, payload, tag, payload);
+        doNotOptimize(ok);
+      });
+    }
+  }
+}
+
+} // namespace tests
+} // namespace ndn
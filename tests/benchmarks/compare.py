@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+# -*- Mode: python; py-indent-offset: 4; indent-tabs-mode: nil; coding: utf-8; -*-
+"""
+Compare benchmark results against a baseline.
+
+Both files are JSON results written by a benchmark program with --output. Benchmarks are
+matched by program and name; a benchmark whose statistic is slower than the baseline by more
+than the threshold is reported as a regression, and causes a non-zero exit status.
+
+Example:
+
+    build/tests/benchmarks/encoding-bench -- --cpu=2 --output=baseline.json
+    (apply changes and rebuild)
+    build/tests/benchmarks/encoding-bench -- --cpu=2 --output=current.json
+    tests/benchmarks/compare.py -b baseline.json -c current.json
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(paths):
+    results = {}
+    for path in paths:
+        with open(path) as f:
+            doc = json.load(f)
+        program = doc['context']['program']
+        if doc['context']['build'] != 'release':
+            print('WARNING: %s was not produced by a release build' % path, file=sys.stderr)
+        for bench in doc['benchmarks']:
+            results[(program, bench['name'])] = bench
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-b', '--baseline', nargs='+', required=True,
+                        help='baseline results file(s)')
+    parser.add_argument('-c', '--current', nargs='+', required=True,
+                        help='current results file(s)')
+    parser.add_argument('-s', '--statistic', default='median',
+                        choices=['min', 'median', 'p90', 'p99', 'mean'],
+                        help='statistic to compare (default: %(default)s)')
+    parser.add_argument('-t', '--threshold', type=float, default=5.0,
+                        help='percentage of slowdown reported as a regression (default: %(default)s)')
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    current = load(args.current)
+
+    nRegressions = 0
+    print('%-50s %12s %12s %9s' % ('benchmark', 'baseline', 'current', 'change'))
+    for key in sorted(set(baseline) | set(current)):
+        label = '%s: %s' % key
+        if key not in baseline:
+            print('%-50s %12s %12.1f %9s' % (label, '-', current[key][args.statistic], 'new'))
+            continue
+        if key not in current:
+            print('%-50s %12.1f %12s %9s' % (label, baseline[key][args.statistic], '-', 'missing'))
+            continue
+
+        old = baseline[key][args.statistic]
+        new = current[key][args.statistic]
+        change = (new - old) / old * 100.0 if old > 0 else 0.0
+        verdict = ''
+        if change > args.threshold:
+            verdict = '  REGRESSION'
+            nRegressions += 1
+        elif change < -args.threshold:
+            verdict = '  improvement'
+        print('%-50s %12.1f %12.1f %+8.1f%%%s' % (label, old, new, change, verdict))
+
+        for metric in sorted(set(baseline[key]['metrics']) & set(current[key]['metrics'])):
+            oldValue = baseline[key]['metrics'][metric]
+            newValue = current[key]['metrics'][metric]
+            if oldValue != newValue:
+                print('%-50s %12g %12g' % ('  ' + metric, oldValue, newValue))
+
+    if nRegressions > 0:
+        print('\n%d regression(s) above %.1f%% in %s' % (nRegressions, args.threshold, args.statistic))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,105 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Data Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+#include "tests/benchmarks/workload.hpp"
+
+namespace ndn {
+namespace tests {
+
+const size_t N_PACKETS = 1000;
+const size_t N_ROUNDS = 20;
+const uint64_t N_OPERATIONS = N_PACKETS * N_ROUNDS;
+
+/**
+ * @brief Data packets signed with ECDSA, with names and content sizes drawn from the workload.
+ */
+class DataFixture
+{
+protected:
+  DataFixture()
+  {
+    WorkloadGenerator gen;
+    KeyChain keyChain("pib-memory:", "tpm-memory:");
+    auto signingInfo = security::signingByIdentity(keyChain.createIdentity("/benchmark"));
+
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      Data data(gen.makeName());
+      data.setFreshnessPeriod(gen.makeBool(0.5) ? 10_s : 1_s);
+      data.setContent(gen.makePayload(gen.makePayloadSize()));
+      keyChain.sign(data, signingInfo);
+      wires.push_back(makeWireBuffer(data.wireEncode()));
+      packets.push_back(std::move(data));
+    }
+  }
+
+protected:
+  std::vector<Data> packets;
+  std::vector<ConstBufferPtr> wires;
+};
+
+BOOST_FIXTURE_TEST_CASE(Encode, DataFixture)
+{
+  // changing the FreshnessPeriod discards the cached wire encoding, so that each wireEncode()
+  // encodes the packet with its existing signature
+  Benchmark("Data/Encode", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (auto& data : packets) {
+        data.setFreshnessPeriod(data.getFreshnessPeriod() + 1_ms);
+        doNotOptimize(data.wireEncode());
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(Decode, DataFixture)
+{
+  Benchmark("Data/Decode", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& wire : wires) {
+        Data data{Block(wire)};
+        doNotOptimize(data);
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(DecodeGetFullName, DataFixture)
+{
+  // the full name is cached in the Data, so it is computed on freshly decoded packets
+  Benchmark("Data/DecodeGetFullName", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& wire : wires) {
+        Data data{Block(wire)};
+        doNotOptimize(data.getFullName());
+      }
+    }
+  });
+}
+
+} // namespace tests
+} // namespace ndn
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2020 Regents of the University of California.
+ * Copyright (c) 2013-2022 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -23,13 +23,11 @@
 #include "tests/boost-test.hpp"
 
 #include "ndn-cxx/encoding/tlv.hpp"
-#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/benchmarks/benchmark.hpp"
 
 #include <boost/mpl/vector.hpp>
 #include <boost/mpl/vector_c.hpp>
 
-#include <iostream>
-
 namespace ndn {
 namespace tlv {
 namespace tests {
@@ -99,10 +97,9 @@ using ReadVarNumberTests = boost::mpl::vector<
 
 // Benchmark of ndn::tlv::readVarNumber with different number lengths and alignments.
 // For accurate results, it is required to compile ndn-cxx in release mode.
-// It is recommended to run the benchmark multiple times and take the average.
 BOOST_AUTO_TEST_CASE_TEMPLATE(ReadVarNumber, Test, ReadVarNumberTests)
 {
-  const int N_ITERATIONS = 100000000;
+  const int N_ITERATIONS = 10000000;
 
   alignas(8) uint8_t buffer[16];
   static_assert(Test::AlignmentOffset::value + sizeof(Test::WIRE) <= sizeof(buffer), "");
@@ -112,7 +109,9 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ReadVarNumber, Test, ReadVarNumberTests)
 
   int nOks = 0;
   int nCorrects = 0;
-  auto d = timedExecute([&] {
+  Benchmark("ReadVarNumber/size=" + to_string(sizeof(Test::WIRE)) +
+            "/offset=" + to_string(Test::AlignmentOffset::value), N_ITERATIONS).run([&] {
+    nOks = nCorrects = 0;
     uint64_t number = 0;
     for (int i = 0; i < N_ITERATIONS; ++i) {
       const uint8_t* begin2 = begin; // make a copy because readVarNumber increments the pointer
@@ -123,9 +122,6 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(ReadVarNumber, Test, ReadVarNumberTests)
   });
   BOOST_CHECK_EQUAL(nOks, N_ITERATIONS);
   BOOST_CHECK_EQUAL(nCorrects, N_ITERATIONS);
-  std::cout << "size=" << sizeof(Test::WIRE)
-            << " offset=" << Test::AlignmentOffset::value
-            << " " << d << std::endl;
 }
 
 } // namespace tests
@@ -0,0 +1,316 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Face Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/face.hpp"
+#include "ndn-cxx/face-metrics.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/transport/tcp-transport.hpp"
+#include "ndn-cxx/transport/unix-transport.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+#include "tests/benchmarks/stand-in-forwarder.hpp"
+
+#include <boost/filesystem/operations.hpp>
+
+#include <atomic>
+#include <thread>
+
+namespace ndn {
+namespace tests {
+
+namespace po = boost::program_options;
+
+/**
+ * @brief Parameters of the exchange between consumer and producer Faces.
+ */
+struct FaceBenchOptions
+{
+  size_t nConsumers = 1;
+  size_t nProducers = 1;
+  size_t payloadSize = 1024;
+  size_t window = 16;
+  size_t nExchanges = 20000;
+  std::string signing = "sha256";
+  std::string transport = "unix";
+};
+
+static FaceBenchOptions g_options;
+
+static const bool g_hasOptions = [] {
+  auto& o = g_options;
+  getProgramOptions().add_options()
+    ("consumers", po::value<size_t>(&o.nConsumers)->default_value(o.nConsumers),
+                  "number of consumer Faces")
+    ("producers", po::value<size_t>(&o.nProducers)->default_value(o.nProducers),
+                  "number of producer Faces")
+    ("payload",   po::value<size_t>(&o.payloadSize)->default_value(o.payloadSize),
+                  "Data payload size in octets")
+    ("window",    po::value<size_t>(&o.window)->default_value(o.window),
+                  "outstanding Interests per consumer")
+    ("exchanges", po::value<size_t>(&o.nExchanges)->default_value(o.nExchanges),
+                  "Interest-Data exchanges per run")
+    ("signing",   po::value<std::string>(&o.signing)->default_value(o.signing),
+                  "Data signing: none, sha256, or ecdsa")
+    ("transport", po::value<std::string>(&o.transport)->default_value(o.transport),
+                  "transport: unix or tcp")
+    ;
+  return true;
+}();
+
+/**
+ * @brief Producer and consumer Faces connected through a StandInForwarder.
+ *
+ * The forwarder and the producers each run on their own thread; the consumers run on the thread
+ * of the benchmark.
+ */
+class FaceBenchFixture
+{
+protected:
+  FaceBenchFixture()
+    : m_socketPath((boost::filesystem::temp_directory_path() /
+                    boost::filesystem::unique_path("ndn-cxx-bench-%%%%%%.sock")).string())
+    , m_forwarder(m_forwarderIo, m_socketPath)
+    , m_forwarderWork(boost::asio::make_work_guard(m_forwarderIo))
+    , m_producerWork(boost::asio::make_work_guard(m_producerIo))
+    , m_producerKeyChain("pib-memory:", "tpm-memory:")
+    , m_content(std::make_shared<Buffer>(g_options.payloadSize))
+    , m_consumerKeyChain("pib-memory:", "tpm-memory:")
+  {
+    BOOST_REQUIRE(g_options.nConsumers > 0 && g_options.nProducers > 0 && g_options.window > 0);
+
+    auto identity = m_producerKeyChain.createIdentity("/benchmark/producer");
+    if (g_options.signing == "none") {
+      // Data carry a DigestSha256 signature whose value is not computed, see produce()
+    }
+    else if (g_options.signing == "sha256") {
+      m_dataSigningInfo = signingWithSha256();
+    }
+    else if (g_options.signing == "ecdsa") {
+      m_dataSigningInfo = security::signingByIdentity(identity);
+    }
+    else {
+      BOOST_FAIL("unknown signing mode " + g_options.signing);
+    }
+
+    std::atomic<size_t> nRegistered{0};
+    std::atomic<bool> hasFailed{false};
+    for (size_t i = 0; i < g_options.nProducers; ++i) {
+      Name prefix("/benchmark");
+      prefix.append("p" + to_string(i));
+      m_prefixes.push_back(prefix);
+
+      m_producers.push_back(make_unique<Face>(makeTransport(), m_producerIo, m_producerKeyChain));
+      Face& face = *m_producers.back();
+      face.setInterestFilter(prefix,
+        [this, &face] (const auto&, const Interest& interest) { produce(face, interest); },
+        [&] (const auto&) { ++nRegistered; },
+        [&] (const auto&, const auto&) { hasFailed = true; });
+    }
+    m_forwarderThread = std::thread([this] { m_forwarderIo.run(); });
+    m_producerThread = std::thread([this] { m_producerIo.run(); });
+
+    auto deadline = time::steady_clock::now() + 10_s;
+    while (nRegistered < g_options.nProducers && !hasFailed &&
+           time::steady_clock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    if (nRegistered != g_options.nProducers) {
+      stopThreads();
+      BOOST_FAIL("prefix registration failed");
+    }
+
+    for (size_t i = 0; i < g_options.nConsumers; ++i) {
+      m_consumers.push_back({make_unique<Face>(makeTransport(), m_consumerIo, m_consumerKeyChain),
+                             Name("c" + to_string(i)), i});
+    }
+  }
+
+  ~FaceBenchFixture()
+  {
+    m_consumers.clear();
+    stopThreads();
+  }
+
+  /**
+   * @brief Run exchanges until g_options.nExchanges Interests have been answered or failed.
+   * @return the duration of the run
+   */
+  time::nanoseconds
+  runExchanges(LatencyHistogram& latency)
+  {
+    m_nIssued = m_nCompleted = 0;
+    auto start = time::steady_clock::now();
+    for (auto& consumer : m_consumers) {
+      for (size_t i = 0; i < g_options.window; ++i) {
+        expressNext(consumer, latency);
+      }
+    }
+    m_consumerIo.restart();
+    m_consumerIo.run();
+    return time::steady_clock::now() - start;
+  }
+
+private:
+  struct Consumer
+  {
+    unique_ptr<Face> face;
+    Name suffix;
+    uint64_t nextSeq;
+  };
+
+  void
+  stopThreads()
+  {
+    m_producerIo.stop();
+    if (m_producerThread.joinable()) {
+      m_producerThread.join();
+    }
+    m_producers.clear();
+
+    m_forwarderIo.stop();
+    if (m_forwarderThread.joinable()) {
+      m_forwarderThread.join();
+    }
+  }
+
+  shared_ptr<Transport>
+  makeTransport() const
+  {
+    if (g_options.transport == "unix") {
+      return make_shared<UnixTransport>(m_forwarder.getUnixSocketPath());
+    }
+    if (g_options.transport == "tcp") {
+      return make_shared<TcpTransport>("127.0.0.1", to_string(m_forwarder.getTcpPort()));
+    }
+    BOOST_FAIL("unknown transport " + g_options.transport);
+    return nullptr;
+  }
+
+  void
+  produce(Face& face, const Interest& interest)
+  {
+    Data data(interest.getName());
+    data.setContent(m_content);
+    if (g_options.signing == "none") {
+      data.setSignatureInfo(SignatureInfo(tlv::DigestSha256));
+      data.setSignatureValue(std::make_shared<Buffer>(32));
+    }
+    else {
+      m_producerKeyChain.sign(data, m_dataSigningInfo);
+    }
+    face.put(data);
+  }
+
+  void
+  expressNext(Consumer& consumer, LatencyHistogram& latency)
+  {
+    if (m_nIssued == g_options.nExchanges) {
+      return;
+    }
+    ++m_nIssued;
+
+    uint64_t seq = consumer.nextSeq++;
+    Name name(m_prefixes[seq % m_prefixes.size()]);
+    name.append(consumer.suffix).appendSequenceNumber(seq);
+
+    auto sent = time::steady_clock::now();
+    consumer.face->expressInterest(Interest(name),
+      [this, &consumer, &latency, sent] (const auto&, const auto&) {
+        latency.record(time::steady_clock::now() - sent);
+        onExchangeCompleted(consumer, latency);
+      },
+      [this, &consumer, &latency] (const auto&, const auto&) {
+        ++nFailures;
+        onExchangeCompleted(consumer, latency);
+      },
+      [this, &consumer, &latency] (const auto&) {
+        ++nFailures;
+        onExchangeCompleted(consumer, latency);
+      });
+  }
+
+  void
+  onExchangeCompleted(Consumer& consumer, LatencyHistogram& latency)
+  {
+    if (++m_nCompleted == g_options.nExchanges) {
+      m_consumerIo.stop();
+      return;
+    }
+    expressNext(consumer, latency);
+  }
+
+public:
+  /// Interests that were Nacked or timed out
+  size_t nFailures = 0;
+
+private:
+  std::string m_socketPath;
+  boost::asio::io_service m_forwarderIo;
+  StandInForwarder m_forwarder;
+  boost::asio::executor_work_guard<boost::asio::io_service::executor_type> m_forwarderWork;
+  std::thread m_forwarderThread;
+
+  boost::asio::io_service m_producerIo;
+  boost::asio::executor_work_guard<boost::asio::io_service::executor_type> m_producerWork;
+  KeyChain m_producerKeyChain;
+  security::SigningInfo m_dataSigningInfo;
+  ConstBufferPtr m_content;
+  std::vector<Name> m_prefixes;
+  std::vector<unique_ptr<Face>> m_producers;
+  std::thread m_producerThread;
+
+  boost::asio::io_service m_consumerIo;
+  KeyChain m_consumerKeyChain;
+  std::vector<Consumer> m_consumers;
+  size_t m_nIssued = 0;
+  size_t m_nCompleted = 0;
+};
+
+BOOST_FIXTURE_TEST_CASE(Throughput, FaceBenchFixture)
+{
+  const auto& o = g_options;
+  std::string name = "Face/" + o.transport + "/" + o.signing +
+                     "/payload=" + to_string(o.payloadSize) + "/window=" + to_string(o.window) +
+                     "/consumers=" + to_string(o.nConsumers) + "/producers=" + to_string(o.nProducers);
+
+  // latencies are collected from the measured runs only
+  Benchmark bench(name, o.nExchanges);
+  size_t nRuns = 0;
+  LatencyHistogram warmupLatency;
+  LatencyHistogram latency;
+  bench.runTimed([&] {
+    return runExchanges(nRuns++ < bench.getWarmup() ? warmupLatency : latency);
+  });
+
+  double packetsPerSecond = 1e9 / bench.getResult().median;
+  bench.addMetric("packets/s", packetsPerSecond)
+       .addMetric("Mbit/s", packetsPerSecond * o.payloadSize * 8 / 1e6)
+       .addMetric("p50.us", latency.getPercentile(50).count() / 1e3)
+       .addMetric("p90.us", latency.getPercentile(90).count() / 1e3)
+       .addMetric("p99.us", latency.getPercentile(99).count() / 1e3)
+       .addMetric("failures", nFailures);
+  BOOST_CHECK_EQUAL(nFailures, 0);
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Interest Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+#include "tests/benchmarks/workload.hpp"
+
+#include <boost/lexical_cast.hpp>
+
+namespace ndn {
+namespace tests {
+
+const size_t N_INTERESTS = 1000;
+const size_t N_ROUNDS = 20;
+const uint64_t N_OPERATIONS = N_INTERESTS * N_ROUNDS;
+
+enum class InterestKind {
+  PLAIN,
+  PARAMETERS,
+  SIGNED,
+};
+
+std::ostream&
+operator<<(std::ostream& os, InterestKind kind)
+{
+  switch (kind) {
+    case InterestKind::PLAIN:
+      return os << "Plain";
+    case InterestKind::PARAMETERS:
+      return os << "Parameters";
+    case InterestKind::SIGNED:
+      return os << "Signed";
+  }
+  return os;
+}
+
+const InterestKind ALL_KINDS[] = {InterestKind::PLAIN, InterestKind::PARAMETERS, InterestKind::SIGNED};
+
+/**
+ * @brief Interests of one kind, with names, selectors, and parameters drawn from the workload.
+ */
+class InterestWorkload
+{
+public:
+  explicit
+  InterestWorkload(InterestKind kind)
+  {
+    WorkloadGenerator gen;
+    KeyChain keyChain("pib-memory:", "tpm-memory:");
+    security::SigningInfo signingInfo;
+    if (kind == InterestKind::SIGNED) {
+      signingInfo = security::signingByIdentity(keyChain.createIdentity("/benchmark"));
+      signingInfo.setSignedInterestFormat(security::SignedInterestFormat::V03);
+    }
+
+    for (size_t i = 0; i < N_INTERESTS; ++i) {
+      Interest interest(gen.makeName());
+      interest.setCanBePrefix(gen.makeBool(0.3));
+      interest.setMustBeFresh(gen.makeBool(0.5));
+      interest.setInterestLifetime(gen.makeBool(0.8) ? 4_s : 1_s);
+      interest.setNonce(static_cast<uint32_t>(gen.makeInteger(0, 0xFFFFFFFF)));
+      if (kind == InterestKind::PARAMETERS) {
+        interest.setApplicationParameters(gen.makePayload(gen.makeInteger(16, 256)));
+      }
+      else if (kind == InterestKind::SIGNED) {
+        interest.setApplicationParameters(gen.makePayload(gen.makeInteger(0, 64)));
+        keyChain.sign(interest, signingInfo);
+      }
+      wires.push_back(makeWireBuffer(interest.wireEncode()));
+      interests.push_back(std::move(interest));
+    }
+  }
+
+public:
+  std::vector<Interest> interests;
+  std::vector<ConstBufferPtr> wires;
+};
+
+BOOST_AUTO_TEST_CASE(Encode)
+{
+  for (auto kind : ALL_KINDS) {
+    InterestWorkload workload(kind);
+
+    // changing the nonce discards the cached wire encoding, so that each wireEncode() encodes
+    uint32_t nonce = 0;
+    Benchmark("Interest/Encode/" + boost::lexical_cast<std::string>(kind), N_OPERATIONS).run([&] {
+      for (size_t r = 0; r < N_ROUNDS; ++r) {
+        for (auto& interest : workload.interests) {
+          interest.setNonce(++nonce);
+          doNotOptimize(interest.wireEncode());
+        }
+      }
+    });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Decode)
+{
+  for (auto kind : ALL_KINDS) {
+    InterestWorkload workload(kind);
+
+    Benchmark("Interest/Decode/" + boost::lexical_cast<std::string>(kind), N_OPERATIONS).run([&] {
+      for (size_t r = 0; r < N_ROUNDS; ++r) {
+        for (const auto& wire : workload.wires) {
+          Interest interest{Block(wire)};
+          doNotOptimize(interest);
+        }
+      }
+    });
+  }
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,467 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx KeyChain Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/security/certificate-fetcher-offline.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "ndn-cxx/security/tpm/impl/back-end-file.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/private-key.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
+#include "ndn-cxx/security/transform/signer-filter.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/security/validator-config.hpp"
+#include "ndn-cxx/security/verification-helpers.hpp"
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/util/io.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+#include "tests/benchmarks/workload.hpp"
+
+#include <openssl/opensslv.h>
+#include <boost/algorithm/string/erase.hpp>
+#include <boost/filesystem/operations.hpp>
+
+/**
+ * @file
+ *
+ * Signing is measured through KeyChain::sign() and then layer by layer below it, so that the
+ * cost of the cryptographic operation can be told apart from the rest:
+ *
+ *   Sign/<key>/<tpm>/Data             KeyChain::sign(Data) with the identity name as signer,
+ *                                     which looks up the identity and its default key in the PIB
+ *   Sign/<key>/<tpm>/Data/ByKey       KeyChain::sign(Data) with a pib::Key as signer
+ *   Sign/<key>/<tpm>/Interest         KeyChain::sign(Interest) in Packet Format v0.3
+ *   Sign/<key>/<tpm>/PibLookup        identity and default key lookup alone
+ *   Sign/<key>/<tpm>/Encode/Data      encoding steps of KeyChain::sign(Data), without signing
+ *   Sign/<key>/<tpm>/Encode/Interest  encoding steps of KeyChain::sign(Interest), without signing
+ *   Sign/<key>/<tpm>/TpmSign          Tpm::sign() on the signed portion of a Data packet,
+ *                                     i.e., key handle lookup and signature computation
+ *   Sign/<key>/tpm-file/LoadKeyHandle loading the private key from the file TPM
+ *   Sign/<key>/Crypto                 signature computation through the transform pipeline
+ *
+ * Verification is measured with the public key passed as raw bytes, which are parsed on each
+ * call, and as a transform::PublicKey parsed beforehand. ValidatorConfig is measured end to end
+ * with Data signed directly by a trust anchor, and by a certificate issued by the trust anchor.
+ */
+
+namespace ndn {
+namespace tests {
+
+using security::SigningInfo;
+using security::ValidatorConfig;
+using security::transform::PublicKey;
+
+struct KeyTypeInfo
+{
+  std::string name;
+  shared_ptr<KeyParams> params;
+  /// checker sig-type in ValidatorConfig
+  std::string sigType;
+  /// number of packets processed in each run, scaled to the cost of signing
+  size_t nPackets;
+};
+
+const std::vector<KeyTypeInfo>&
+getKeyTypes()
+{
+  static const std::vector<KeyTypeInfo> keyTypes{
+    {"ecdsa-p256", make_shared<EcKeyParams>(256), "ecdsa-sha256", 200},
+    {"ecdsa-p384", make_shared<EcKeyParams>(384), "ecdsa-sha256", 50},
+    {"ed25519", make_shared<Ed25519KeyParams>(), "ed25519", 200},
+    {"rsa-2048", make_shared<RsaKeyParams>(2048), "rsa-sha256", 50},
+    {"rsa-4096", make_shared<RsaKeyParams>(4096), "rsa-sha256", 10},
+  };
+  return keyTypes;
+}
+
+std::vector<Data>
+makeDataPackets(WorkloadGenerator& gen, const Name& prefix, size_t n)
+{
+  std::vector<Data> packets;
+  for (size_t i = 0; i < n; ++i) {
+    Data data(Name(prefix).append(gen.makeName()));
+    data.setFreshnessPeriod(1_s);
+    data.setContent(gen.makePayload(gen.makePayloadSize()));
+    packets.push_back(std::move(data));
+  }
+  return packets;
+}
+
+std::vector<Interest>
+makeInterests(WorkloadGenerator& gen, size_t n)
+{
+  std::vector<Interest> interests;
+  for (size_t i = 0; i < n; ++i) {
+    Interest interest(gen.makeName());
+    interest.setNonce(static_cast<uint32_t>(gen.makeInteger(0, 0xFFFFFFFF)));
+    interest.setApplicationParameters(gen.makePayload(gen.makeInteger(0, 64)));
+    interests.push_back(std::move(interest));
+  }
+  return interests;
+}
+
+/**
+ * @brief KeyChain with an in-memory PIB and the TPM selected by the test case.
+ *
+ * The file TPM is placed in a temporary directory that is removed afterwards.
+ */
+class KeyChainBenchFixture
+{
+protected:
+  explicit
+  KeyChainBenchFixture(bool wantFileTpm = false)
+    : m_tpmDir(boost::filesystem::temp_directory_path() /
+               boost::filesystem::unique_path("ndn-cxx-benchmark-%%%%-%%%%"))
+    , tpmLabel(wantFileTpm ? "tpm-file" : "tpm-memory")
+    , keyChain("pib-memory:", wantFileTpm ? "tpm-file:" + m_tpmDir.string() : "tpm-memory:")
+  {
+  }
+
+  ~KeyChainBenchFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(m_tpmDir, ec);
+  }
+
+  void
+  benchmarkSigning()
+  {
+    WorkloadGenerator gen;
+
+    for (const auto& keyType : getKeyTypes()) {
+      auto identity = keyChain.createIdentity(Name("/benchmark").append(keyType.name), *keyType.params);
+      auto key = identity.getDefaultKey();
+      const auto prefix = "Sign/" + keyType.name + "/" + tpmLabel;
+      const size_t n = keyType.nPackets;
+
+      auto packets = makeDataPackets(gen, identity.getName(), n);
+      auto interests = makeInterests(gen, n);
+
+      auto byIdentity = security::signingByIdentity(identity.getName());
+      Benchmark(prefix + "/Data", n).run([&] {
+        for (auto& data : packets) {
+          keyChain.sign(data, byIdentity);
+        }
+      });
+
+      auto byKey = security::signingByKey(key);
+      Benchmark(prefix + "/Data/ByKey", n).run([&] {
+        for (auto& data : packets) {
+          keyChain.sign(data, byKey);
+        }
+      });
+
+      auto interestSigningInfo = byIdentity;
+      interestSigningInfo.setSignedInterestFormat(security::SignedInterestFormat::V03);
+      Benchmark(prefix + "/Interest", n).run([&] {
+        for (auto& interest : interests) {
+          keyChain.sign(interest, interestSigningInfo);
+        }
+      });
+
+      Benchmark(prefix + "/PibLookup", n).run([&] {
+        for (size_t i = 0; i < n; ++i) {
+          doNotOptimize(keyChain.getPib().getIdentity(identity.getName()).getDefaultKey());
+        }
+      });
+
+      // repeat the encoding steps of KeyChain::sign, using the existing signatures in place of
+      // newly computed ones
+      std::vector<ConstBufferPtr> dataSigs;
+      for (const auto& data : packets) {
+        dataSigs.push_back(make_shared<Buffer>(data.getSignatureValue().value_begin(),
+                                               data.getSignatureValue().value_end()));
+      }
+      Benchmark(prefix + "/Encode/Data", n).run([&] {
+        for (size_t i = 0; i < n; ++i) {
+          auto& data = packets[i];
+          data.setSignatureInfo(data.getSignatureInfo());
+          EncodingBuffer encoder;
+          data.wireEncode(encoder, true);
+          doNotOptimize(data.wireEncode(encoder, *dataSigs[i]));
+        }
+      });
+
+      std::vector<ConstBufferPtr> interestSigs;
+      for (const auto& interest : interests) {
+        interestSigs.push_back(make_shared<Buffer>(interest.getSignatureValue().value_begin(),
+                                                   interest.getSignatureValue().value_end()));
+      }
+      Benchmark(prefix + "/Encode/Interest", n).run([&] {
+        for (size_t i = 0; i < n; ++i) {
+          auto& interest = interests[i];
+          interest.setSignatureInfo(*interest.getSignatureInfo());
+          doNotOptimize(interest.extractSignedRanges());
+          interest.setSignatureValue(interestSigs[i]);
+          doNotOptimize(interest.wireEncode());
+        }
+      });
+
+      std::vector<InputBuffers> signedRanges;
+      for (const auto& data : packets) {
+        signedRanges.push_back(data.extractSignedRanges());
+      }
+      Benchmark(prefix + "/TpmSign", n).run([&] {
+        for (const auto& ranges : signedRanges) {
+          doNotOptimize(keyChain.getTpm().sign(ranges, key.getName(), DigestAlgorithm::SHA256));
+        }
+      });
+
+      if (tpmLabel == "tpm-file") {
+        // the Tpm caches key handles, so loading from the file only happens on first use of a key
+        security::tpm::BackEndFile backEnd(m_tpmDir.string());
+        Benchmark(prefix + "/LoadKeyHandle", n).run([&] {
+          for (size_t i = 0; i < n; ++i) {
+            doNotOptimize(backEnd.getKeyHandle(key.getName()));
+          }
+        });
+      }
+      else {
+        using namespace security::transform;
+        auto privateKey = generatePrivateKey(*keyType.params);
+        Benchmark("Sign/" + keyType.name + "/Crypto", n).run([&] {
+          for (const auto& ranges : signedRanges) {
+            OBufferStream os;
+            bufferSource(ranges) >> signerFilter(DigestAlgorithm::SHA256, *privateKey) >> streamSink(os);
+            doNotOptimize(os.buf());
+          }
+        });
+      }
+    }
+  }
+
+private:
+  boost::filesystem::path m_tpmDir;
+
+protected:
+  const std::string tpmLabel;
+  KeyChain keyChain;
+};
+
+class FileTpmFixture : public KeyChainBenchFixture
+{
+protected:
+  FileTpmFixture()
+    : KeyChainBenchFixture(true)
+  {
+  }
+};
+
+BOOST_FIXTURE_TEST_CASE(SignMemoryTpm, KeyChainBenchFixture)
+{
+  benchmarkSigning();
+}
+
+BOOST_FIXTURE_TEST_CASE(SignFileTpm, FileTpmFixture)
+{
+  benchmarkSigning();
+}
+
+BOOST_FIXTURE_TEST_CASE(SignSymmetric, KeyChainBenchFixture)
+{
+  const size_t n = 1000;
+  WorkloadGenerator gen;
+  auto packets = makeDataPackets(gen, "/benchmark", n);
+  auto interests = makeInterests(gen, n);
+
+  auto sha256 = security::signingWithSha256();
+  Benchmark("Sign/sha256/Data", n).run([&] {
+    for (auto& data : packets) {
+      keyChain.sign(data, sha256);
+    }
+  });
+  sha256.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  Benchmark("Sign/sha256/Interest", n).run([&] {
+    for (auto& interest : interests) {
+      keyChain.sign(interest, sha256);
+    }
+  });
+
+#if OPENSSL_VERSION_NUMBER < 0x30000000L // FIXME #5154
+  // HMAC keys are only supported by the memory TPM
+  SigningInfo hmac(SigningInfo::SIGNER_TYPE_HMAC, keyChain.createHmacKey());
+  Benchmark("Sign/hmac-sha256/tpm-memory/Data", n).run([&] {
+    for (auto& data : packets) {
+      keyChain.sign(data, hmac);
+    }
+  });
+  hmac.setSignedInterestFormat(security::SignedInterestFormat::V03);
+  Benchmark("Sign/hmac-sha256/tpm-memory/Interest", n).run([&] {
+    for (auto& interest : interests) {
+      keyChain.sign(interest, hmac);
+    }
+  });
+#endif
+}
+
+BOOST_FIXTURE_TEST_CASE(Verify, KeyChainBenchFixture)
+{
+  WorkloadGenerator gen;
+
+  for (const auto& keyType : getKeyTypes()) {
+    auto identity = keyChain.createIdentity(Name("/benchmark").append(keyType.name), *keyType.params);
+    auto keyBits = identity.getDefaultKey().getPublicKey();
+    PublicKey publicKey;
+    publicKey.loadPkcs8(keyBits);
+    const auto prefix = "Verify/" + keyType.name;
+    const size_t n = keyType.nPackets * 4;
+
+    auto packets = makeDataPackets(gen, identity.getName(), n);
+    for (auto& data : packets) {
+      keyChain.sign(data, security::signingByIdentity(identity));
+    }
+    auto interests = makeInterests(gen, n);
+    auto interestSigningInfo = security::signingByIdentity(identity);
+    interestSigningInfo.setSignedInterestFormat(security::SignedInterestFormat::V03);
+    for (auto& interest : interests) {
+      keyChain.sign(interest, interestSigningInfo);
+    }
+
+    size_t nFailures = 0;
+    Benchmark(prefix + "/Data/RawKey", n).run([&] {
+      for (const auto& data : packets) {
+        nFailures += !security::verifySignature(data, keyBits);
+      }
+    });
+    Benchmark(prefix + "/Data/PublicKey", n).run([&] {
+      for (const auto& data : packets) {
+        nFailures += !security::verifySignature(data, publicKey);
+      }
+    });
+    Benchmark(prefix + "/Interest/RawKey", n).run([&] {
+      for (const auto& interest : interests) {
+        nFailures += !security::verifySignature(interest, keyBits);
+      }
+    });
+    Benchmark(prefix + "/Interest/PublicKey", n).run([&] {
+      for (const auto& interest : interests) {
+        nFailures += !security::verifySignature(interest, publicKey);
+      }
+    });
+    BOOST_CHECK_EQUAL(nFailures, 0);
+  }
+
+  const size_t n = 1000;
+  auto packets = makeDataPackets(gen, "/benchmark", n);
+  for (auto& data : packets) {
+    keyChain.sign(data, security::signingWithSha256());
+  }
+  size_t nFailures = 0;
+  Benchmark("Verify/sha256/Data", n).run([&] {
+    for (const auto& data : packets) {
+      nFailures += !security::verifySignature(data, nullopt);
+    }
+  });
+  BOOST_CHECK_EQUAL(nFailures, 0);
+}
+
+/**
+ * @brief Load a hierarchical trust schema rooted at @p anchor into @p validator.
+ */
+void
+loadHierarchicalPolicy(ValidatorConfig& validator, const KeyTypeInfo& keyType,
+                       const security::Certificate& anchor)
+{
+  std::ostringstream os;
+  io::save(anchor, os);
+  auto anchorBase64 = os.str();
+  boost::algorithm::erase_all(anchorBase64, "\n");
+
+  validator.load(R"CONF(
+    rule
+    {
+      id "hierarchical"
+      for data
+      checker
+      {
+        type hierarchical
+        sig-type )CONF" + keyType.sigType + R"CONF(
+      }
+    }
+    trust-anchor
+    {
+      type base64
+      base64-string ")CONF" + anchorBase64 + R"CONF("
+    }
+  )CONF", "key-chain-bench.conf");
+}
+
+void
+benchmarkValidation(ValidatorConfig& validator, const std::string& name,
+                    const std::vector<Data>& packets, bool wantColdCache = false)
+{
+  size_t nFailures = 0;
+  Benchmark(name, packets.size()).run([&] {
+    for (const auto& data : packets) {
+      if (wantColdCache) {
+        validator.resetVerifiedCertificates();
+      }
+      // with all certificates available locally, validation completes synchronously
+      validator.validate(data,
+                         [] (const Data&) {},
+                         [&] (const Data&, const security::ValidationError&) { ++nFailures; });
+    }
+  });
+  BOOST_CHECK_EQUAL(nFailures, 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(Validate, KeyChainBenchFixture)
+{
+  WorkloadGenerator gen;
+
+  for (const auto& keyType : getKeyTypes()) {
+    auto anchor = keyChain.createIdentity(Name("/benchmark").append(keyType.name), *keyType.params);
+    auto producer = keyChain.createIdentity(Name(anchor.getName()).append("producer"), *keyType.params);
+    const auto prefix = "Validate/" + keyType.name;
+    const size_t n = keyType.nPackets * 4;
+
+    ValidatorConfig validator(make_unique<security::CertificateFetcherOffline>());
+    loadHierarchicalPolicy(validator, keyType, anchor.getDefaultKey().getDefaultCertificate());
+    // the producer certificate is issued by the trust anchor, and available without fetching
+    auto producerCert = keyChain.makeCertificate(producer.getDefaultKey(),
+                                                 security::signingByIdentity(anchor));
+    keyChain.setDefaultCertificate(producer.getDefaultKey(), producerCert);
+    validator.cacheUnverifiedCert(std::move(producerCert));
+
+    auto anchorPackets = makeDataPackets(gen, anchor.getName(), n);
+    for (auto& data : anchorPackets) {
+      keyChain.sign(data, security::signingByIdentity(anchor));
+    }
+    benchmarkValidation(validator, prefix + "/Anchor", anchorPackets);
+
+    auto producerPackets = makeDataPackets(gen, producer.getName(), n);
+    for (auto& data : producerPackets) {
+      keyChain.sign(data, security::signingByIdentity(producer));
+    }
+    // the producer certificate is verified on first use, then found in the verified cache
+    benchmarkValidation(validator, prefix + "/Chain", producerPackets);
+    // the producer certificate is verified again for each packet
+    benchmarkValidation(validator, prefix + "/Chain/ColdCache", producerPackets, true);
+  }
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx LpPacket Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/impl/lp-field-tag.hpp"
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/lp/fields.hpp"
+#include "ndn-cxx/lp/nack.hpp"
+#include "ndn-cxx/lp/packet.hpp"
+#include "ndn-cxx/lp/tags.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+#include "tests/benchmarks/workload.hpp"
+
+namespace ndn {
+namespace lp {
+namespace tests {
+
+using namespace ndn::tests;
+
+const size_t N_PACKETS = 1000;
+const size_t N_ROUNDS = 20;
+const uint64_t N_OPERATIONS = N_PACKETS * N_ROUNDS;
+
+/**
+ * @brief NDNLPv2 packets as received by a Face: Nacks, and Data carrying a congestion mark.
+ */
+class LpPacketFixture
+{
+protected:
+  LpPacketFixture()
+  {
+    WorkloadGenerator gen;
+    KeyChain keyChain("pib-memory:", "tpm-memory:");
+    auto signingInfo = security::signingByIdentity(keyChain.createIdentity("/benchmark"));
+
+    const NackReason reasons[] = {NackReason::CONGESTION, NackReason::DUPLICATE, NackReason::NO_ROUTE};
+    for (size_t i = 0; i < N_PACKETS; ++i) {
+      Interest interest(gen.makeName());
+      interest.setCanBePrefix(gen.makeBool(0.3));
+      interest.setMustBeFresh(gen.makeBool(0.5));
+      interest.setNonce(static_cast<uint32_t>(gen.makeInteger(0, 0xFFFFFFFF)));
+      const Block& interestWire = interest.wireEncode();
+
+      Packet nack;
+      nack.add<NackField>(NackHeader().setReason(reasons[gen.makeInteger(0, 2)]));
+      nack.add<FragmentField>({interestWire.begin(), interestWire.end()});
+      nacks.push_back(makeWireBuffer(nack.wireEncode()));
+
+      Data data(interest.getName());
+      data.setContent(gen.makePayload(gen.makePayloadSize()));
+      keyChain.sign(data, signingInfo);
+      const Block& dataWire = data.wireEncode();
+
+      Packet marked;
+      marked.add<CongestionMarkField>(1);
+      marked.add<FragmentField>({dataWire.begin(), dataWire.end()});
+      markedData.push_back(makeWireBuffer(marked.wireEncode()));
+    }
+  }
+
+protected:
+  std::vector<ConstBufferPtr> nacks;
+  std::vector<ConstBufferPtr> markedData;
+};
+
+BOOST_FIXTURE_TEST_CASE(DecodeHeader, LpPacketFixture)
+{
+  // NDNLPv2 header fields only, leaving the fragment undecoded
+  Benchmark("LpPacket/DecodeHeader/Nack", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& wire : nacks) {
+        Packet packet{Block(wire)};
+        doNotOptimize(packet.get<NackField>());
+        doNotOptimize(packet.get<FragmentField>());
+      }
+    }
+  });
+
+  Benchmark("LpPacket/DecodeHeader/CongestionMark", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& wire : markedData) {
+        Packet packet{Block(wire)};
+        doNotOptimize(packet.get<CongestionMarkField>());
+        doNotOptimize(packet.get<FragmentField>());
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(Decode, LpPacketFixture)
+{
+  // same steps as Face::onReceiveElement, up to the dispatching of the network-layer packet
+  Benchmark("LpPacket/Decode/Nack", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& wire : nacks) {
+        Packet packet{Block(wire)};
+        auto frag = packet.get<FragmentField>();
+        Nack nack(Interest(Block({frag.first, frag.second})));
+        nack.setHeader(packet.get<NackField>());
+        doNotOptimize(nack);
+      }
+    }
+  });
+
+  Benchmark("LpPacket/Decode/CongestionMark", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& wire : markedData) {
+        Packet packet{Block(wire)};
+        auto frag = packet.get<FragmentField>();
+        Data data(Block({frag.first, frag.second}));
+        addTagFromField<CongestionMarkTag, CongestionMarkField>(data, packet);
+        doNotOptimize(data);
+      }
+    }
+  });
+}
+
+} // namespace tests
+} // namespace lp
+} // namespace ndn
@@ -0,0 +1,238 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Name Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/name-builder.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+#include "tests/benchmarks/workload.hpp"
+
+#include <array>
+
+namespace ndn {
+namespace tests {
+
+const size_t N_NAMES = 1000;
+const size_t N_ROUNDS = 100;
+const uint64_t N_OPERATIONS = N_NAMES * N_ROUNDS;
+
+class NameFixture
+{
+protected:
+  NameFixture()
+  {
+    WorkloadGenerator gen;
+    for (size_t i = 0; i < N_NAMES; ++i) {
+      names.push_back(gen.makeName());
+      uris.push_back(names.back().toUri());
+      wires.push_back(makeWireBuffer(names.back().wireEncode()));
+
+      NameRecipe recipe;
+      for (const auto& component : names.back()) {
+        if (component.isVersion()) {
+          recipe.version = component.toVersion();
+        }
+        else if (component.isSegment()) {
+          recipe.segment = component.toSegment();
+        }
+        else {
+          recipe.components.emplace_back(reinterpret_cast<const char*>(component.value()),
+                                         component.value_size());
+        }
+      }
+      recipes.push_back(std::move(recipe));
+    }
+  }
+
+protected:
+  /// how an application would construct each name
+  struct NameRecipe
+  {
+    std::vector<std::string> components;
+    optional<uint64_t> version;
+    optional<uint64_t> segment;
+  };
+
+  std::vector<Name> names;
+  std::vector<std::string> uris;
+  std::vector<ConstBufferPtr> wires;
+  std::vector<NameRecipe> recipes;
+};
+
+BOOST_FIXTURE_TEST_CASE(FromUri, NameFixture)
+{
+  Benchmark("Name/FromUri", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& uri : uris) {
+        Name name(uri);
+        doNotOptimize(name);
+      }
+    }
+  });
+  BOOST_CHECK_EQUAL(Name(uris.front()), names.front());
+}
+
+BOOST_FIXTURE_TEST_CASE(ToUri, NameFixture)
+{
+  Benchmark("Name/ToUri", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& name : names) {
+        auto uri = name.toUri();
+        doNotOptimize(uri);
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(ToUriReuseString, NameFixture)
+{
+  std::string uri;
+  Benchmark("Name/ToUri/ReuseString", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& name : names) {
+        uri.clear();
+        name.toUri(uri);
+        doNotOptimize(uri);
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(ToUriCharBuffer, NameFixture)
+{
+  std::array<char, 1024> buffer;
+  Benchmark("Name/ToUri/CharBuffer", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& name : names) {
+        doNotOptimize(name.toUri(buffer));
+        doNotOptimize(buffer);
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(Append, NameFixture)
+{
+  Benchmark("Name/Append", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& recipe : recipes) {
+        Name name;
+        for (const auto& component : recipe.components) {
+          name.append(component.data());
+        }
+        if (recipe.version) {
+          name.appendVersion(*recipe.version);
+        }
+        if (recipe.segment) {
+          name.appendSegment(*recipe.segment);
+        }
+        doNotOptimize(name);
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(Build, NameFixture)
+{
+  Benchmark("NameBuilder/Build", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& recipe : recipes) {
+        NameBuilder builder(64);
+        for (const auto& component : recipe.components) {
+          builder.append(component.data());
+        }
+        if (recipe.version) {
+          builder.appendVersion(*recipe.version);
+        }
+        if (recipe.segment) {
+          builder.appendSegment(*recipe.segment);
+        }
+        doNotOptimize(builder.build());
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(AppendSegmentToPrefix, NameFixture)
+{
+  // as in Segmenter and SegmentFetcher; the Name is encoded when the packet is encoded
+  const Name& prefix = names.front();
+  Benchmark("Name/AppendSegmentToPrefix", N_OPERATIONS).run([&] {
+    for (uint64_t i = 0; i < N_OPERATIONS; ++i) {
+      Name name = Name(prefix).appendSegment(i);
+      doNotOptimize(name.wireEncode());
+    }
+  });
+
+  const NameBuilder builder(prefix);
+  Benchmark("NameBuilder/AppendSegmentToPrefix", N_OPERATIONS).run([&] {
+    for (uint64_t i = 0; i < N_OPERATIONS; ++i) {
+      Name name = NameBuilder(builder).appendSegment(i).build();
+      doNotOptimize(name.wireEncode());
+    }
+  });
+  BOOST_CHECK_EQUAL(NameBuilder(builder).appendSegment(42).build(), Name(prefix).appendSegment(42));
+}
+
+BOOST_FIXTURE_TEST_CASE(Decode, NameFixture)
+{
+  Benchmark("Name/Decode", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& wire : wires) {
+        Name name{Block(wire)};
+        doNotOptimize(name);
+      }
+    }
+  });
+}
+
+BOOST_FIXTURE_TEST_CASE(Compare, NameFixture)
+{
+  // neighbors in canonical order share prefixes, as in a FIB or PIT lookup
+  std::sort(names.begin(), names.end());
+
+  int sum = 0;
+  Benchmark("Name/Compare", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (size_t i = 0; i < N_NAMES; ++i) {
+        sum += names[i].compare(names[(i + 1) % N_NAMES]);
+      }
+    }
+  });
+  doNotOptimize(sum);
+}
+
+BOOST_FIXTURE_TEST_CASE(Hash, NameFixture)
+{
+  size_t sum = 0;
+  Benchmark("Name/Hash", N_OPERATIONS).run([&] {
+    for (size_t r = 0; r < N_ROUNDS; ++r) {
+      for (const auto& name : names) {
+        sum += std::hash<Name>{}(name);
+      }
+    }
+  });
+  doNotOptimize(sum);
+}
+
+} // namespace tests
+} // namespace ndn
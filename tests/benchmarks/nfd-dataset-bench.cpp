@@ -0,0 +1,243 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx NFD Dataset Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/mgmt/nfd/status-dataset.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+
+namespace ndn {
+namespace nfd {
+namespace tests {
+
+using namespace ndn::tests;
+
+const size_t N_ENTRIES = 2000;
+const size_t N_ITERATIONS = 100;
+// roughly the payload size of a segment produced by NFD
+const size_t SEGMENT_SIZE = 8000;
+
+class FibDatasetFixture
+{
+protected:
+  FibDatasetFixture()
+  {
+    EncodingBuffer encoder;
+    for (size_t i = N_ENTRIES; i > 0; --i) {
+      FibEntry entry;
+      entry.setPrefix(Name("/benchmark/fib").appendNumber(i).append("entry"));
+      entry.addNextHopRecord(NextHopRecord().setFaceId(256 + i % 100).setCost(10));
+      entry.addNextHopRecord(NextHopRecord().setFaceId(356 + i % 100).setCost(20));
+      entry.wireEncode(encoder);
+    }
+
+    for (size_t offset = 0; offset < encoder.size(); offset += SEGMENT_SIZE) {
+      size_t size = std::min(SEGMENT_SIZE, encoder.size() - offset);
+      segments.push_back(make_shared<const Buffer>(encoder.data() + offset, size));
+    }
+  }
+
+  /// Reassemble the segments, as SegmentFetcher does in 'block' mode.
+  ConstBufferPtr
+  reassemble() const
+  {
+    auto payload = make_shared<Buffer>();
+    for (const auto& segment : segments) {
+      payload->insert(payload->end(), segment->begin(), segment->end());
+    }
+    return payload;
+  }
+
+protected:
+  std::vector<ConstBufferPtr> segments;
+};
+
+BOOST_FIXTURE_TEST_SUITE(Fib, FibDatasetFixture)
+
+BOOST_AUTO_TEST_CASE(ParseResult)
+{
+  FibDataset dataset;
+  uint64_t faceIds = 0;
+  Benchmark("FibDataset/ParseResult", N_ITERATIONS * N_ENTRIES).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      auto result = dataset.parseResult(reassemble());
+      for (const auto& entry : result) {
+        for (const auto& nh : entry.getNextHopRecords()) {
+          faceIds += nh.getFaceId();
+        }
+      }
+    }
+  });
+  doNotOptimize(faceIds);
+}
+
+BOOST_AUTO_TEST_CASE(Entries)
+{
+  uint64_t faceIds = 0;
+  Benchmark("FibDataset/Entries", N_ITERATIONS * N_ENTRIES).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      StatusDatasetParser parser([&] (const Block& wire) {
+        FibEntryView entry(wire);
+        entry.forEachNextHop([&] (const NextHopRecord& nh) { faceIds += nh.getFaceId(); });
+        return true;
+      });
+      for (const auto& segment : segments) {
+        parser.parse(segment);
+      }
+      parser.finish();
+    }
+  });
+  doNotOptimize(faceIds);
+}
+
+BOOST_AUTO_TEST_CASE(EntriesPrefixOnly)
+{
+  // e.g., counting the entries under a prefix, without decoding names or next hops
+  Block prefix = Name("/benchmark/fib").wireEncode();
+  size_t nMatches = 0;
+  Benchmark("FibDataset/EntriesPrefixOnly", N_ITERATIONS * N_ENTRIES).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      StatusDatasetParser parser([&] (const Block& wire) {
+        FibEntryView entry(wire);
+        auto name = entry.getPrefixWire();
+        nMatches += name.value_size() >= prefix.value_size() &&
+                    std::equal(prefix.value_begin(), prefix.value_end(), name.value_begin());
+        return true;
+      });
+      for (const auto& segment : segments) {
+        parser.parse(segment);
+      }
+    }
+  });
+  doNotOptimize(nMatches);
+}
+
+BOOST_AUTO_TEST_CASE(FirstEntry)
+{
+  // the consumer stops after finding what it looks for, without reading the later segments
+  size_t nEntries = 0;
+  Benchmark("FibDataset/FirstEntry", N_ITERATIONS).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      StatusDatasetParser parser([&] (const Block& wire) {
+        nEntries += FibEntryView(wire).getPrefix().size();
+        return false;
+      });
+      for (const auto& segment : segments) {
+        if (!parser.parse(segment)) {
+          break;
+        }
+      }
+    }
+  });
+  doNotOptimize(nEntries);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Fib
+
+BOOST_AUTO_TEST_SUITE(Records)
+
+FaceStatus
+makeFaceStatus()
+{
+  return FaceStatus()
+    .setFaceId(300)
+    .setRemoteUri("udp4://192.0.2.1:6363")
+    .setLocalUri("udp4://192.0.2.2:6363")
+    .setExpirationPeriod(10_s)
+    .setFaceScope(FACE_SCOPE_NON_LOCAL)
+    .setFacePersistency(FACE_PERSISTENCY_PERSISTENT)
+    .setLinkType(LINK_TYPE_POINT_TO_POINT)
+    .setBaseCongestionMarkingInterval(100_ms)
+    .setDefaultCongestionThreshold(65536)
+    .setMtu(8800)
+    .setNInInterests(10000)
+    .setNInData(20000)
+    .setNInNacks(30000)
+    .setNOutInterests(40000)
+    .setNOutData(50000)
+    .setNOutNacks(60000)
+    .setNInBytes(70000000)
+    .setNOutBytes(80000000)
+    .setFlags(0x3);
+}
+
+BOOST_AUTO_TEST_CASE(FaceStatusEncode)
+{
+  FaceStatus status = makeFaceStatus();
+  size_t nBytes = 0;
+  Benchmark("FaceStatus/Encode", N_ITERATIONS * N_ENTRIES).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS * N_ENTRIES; ++i) {
+      status.setNInInterests(i); // invalidates the cached wire encoding
+      nBytes += status.wireEncode().size();
+    }
+  });
+  doNotOptimize(nBytes);
+}
+
+BOOST_AUTO_TEST_CASE(FaceStatusDecode)
+{
+  Block wire = makeFaceStatus().wireEncode();
+  uint64_t nInData = 0;
+  Benchmark("FaceStatus/Decode", N_ITERATIONS * N_ENTRIES).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS * N_ENTRIES; ++i) {
+      FaceStatus status(wire);
+      nInData += status.getNInData();
+    }
+  });
+  doNotOptimize(nInData);
+}
+
+BOOST_AUTO_TEST_CASE(ForwarderStatusDecode)
+{
+  Block wire = ForwarderStatus()
+    .setNfdVersion("0.7.1")
+    .setStartTimestamp(time::fromUnixTimestamp(1_s))
+    .setCurrentTimestamp(time::fromUnixTimestamp(1000_s))
+    .setNNameTreeEntries(1849943160)
+    .setNFibEntries(621739248)
+    .setNPitEntries(482129741)
+    .setNMeasurementsEntries(1771725298)
+    .setNCsEntries(1264968688)
+    .setNInInterests(612811615)
+    .setNInData(1843576050)
+    .setNInNacks(1234)
+    .setNOutInterests(952144445)
+    .setNOutData(138198826)
+    .setNOutNacks(4321)
+    .setNSatisfiedInterests(961)
+    .setNUnsatisfiedInterests(333)
+    .wireEncode();
+  uint64_t nInData = 0;
+  Benchmark("ForwarderStatus/Decode", N_ITERATIONS * N_ENTRIES).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS * N_ENTRIES; ++i) {
+      ForwarderStatus status(wire);
+      nInData += status.getNInData();
+    }
+  });
+  doNotOptimize(nInData);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Records
+
+} // namespace tests
+} // namespace nfd
+} // namespace ndn
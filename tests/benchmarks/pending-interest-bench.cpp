@@ -0,0 +1,71 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx PendingInterest Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/impl/pending-interest.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+
+#include <boost/asio/io_service.hpp>
+
+namespace ndn {
+namespace tests {
+
+const size_t N_INTERESTS = 100000;
+
+BOOST_AUTO_TEST_CASE(Outstanding)
+{
+  boost::asio::io_service io;
+  Scheduler scheduler(io);
+  MetricsCounter nTimeouts;
+  PendingInterestTimer timer(scheduler, nTimeouts);
+
+  std::vector<shared_ptr<const Interest>> interests;
+  interests.reserve(N_INTERESTS);
+  for (size_t i = 0; i < N_INTERESTS; ++i) {
+    auto interest = make_shared<Interest>(Name("/bench/pit").appendNumber(i));
+    interest->setInterestLifetime(4_s);
+    interests.push_back(std::move(interest));
+  }
+
+  // the Interests themselves are not counted; allocs/op and bytes/op are what the PIT spends
+  // on each outstanding Interest expressed through Face::expressInterest
+  uint64_t nCalls = 0;
+  Benchmark("PendingInterest/Outstanding", N_INTERESTS).run([&] {
+    {
+      detail::RecordContainer<PendingInterest> pit;
+      for (const auto& interest : interests) {
+        PendingInterestCallbacks callbacks{
+          [&nCalls] (const Interest&, const Data&) { ++nCalls; },
+          [&nCalls] (const Interest&, const lp::Nack&) { ++nCalls; },
+          [&nCalls] (const Interest&) { ++nCalls; }};
+        pit.insert(interest, std::move(callbacks), timer);
+      }
+      doNotOptimize(pit);
+    }
+    timer.cancel();
+  }).addMetric("sizeof", sizeof(PendingInterest));
+  doNotOptimize(nCalls);
+}
+
+} // namespace tests
+} // namespace ndn
@@ -1,6 +1,6 @@
 /* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
 /*
- * Copyright (c) 2013-2020 Regents of the University of California.
+ * Copyright (c) 2013-2022 Regents of the University of California.
  *
  * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
  *
@@ -23,10 +23,9 @@
 #include "tests/boost-test.hpp"
 
 #include "ndn-cxx/util/scheduler.hpp"
-#include "tests/benchmarks/timed-execute.hpp"
+#include "tests/benchmarks/benchmark.hpp"
 
 #include <boost/asio/io_service.hpp>
-#include <iostream>
 
 namespace ndn {
 namespace scheduler {
@@ -36,54 +35,64 @@ using namespace ndn::tests;
 
 BOOST_AUTO_TEST_CASE(ScheduleCancel)
 {
-  boost::asio::io_service io;
-  Scheduler sched(io);
-
   const size_t nEvents = 1000000;
   std::vector<EventId> eventIds(nEvents);
 
-  auto d1 = timedExecute([&] {
-    for (size_t i = 0; i < nEvents; ++i) {
-      eventIds[i] = sched.schedule(1_s, []{});
-    }
+  Benchmark("Schedule", nEvents).runTimed([&] {
+    boost::asio::io_service io;
+    Scheduler sched(io);
+    auto d = timedExecute([&] {
+      for (size_t i = 0; i < nEvents; ++i) {
+        eventIds[i] = sched.schedule(1_s, []{});
+      }
+    });
+    sched.cancelAllEvents();
+    return d;
   });
 
-  auto d2 = timedExecute([&] {
+  Benchmark("Cancel", nEvents).runTimed([&] {
+    boost::asio::io_service io;
+    Scheduler sched(io);
     for (size_t i = 0; i < nEvents; ++i) {
-      eventIds[i].cancel();
+      eventIds[i] = sched.schedule(1_s, []{});
     }
+    return timedExecute([&] {
+      for (size_t i = 0; i < nEvents; ++i) {
+        eventIds[i].cancel();
+      }
+    });
   });
-
-  std::cout << "schedule " << nEvents << " events: " << d1 << std::endl;
-  std::cout << "cancel " << nEvents << " events: " << d2 << std::endl;
 }
 
 BOOST_AUTO_TEST_CASE(Execute)
 {
-  boost::asio::io_service io;
-  Scheduler sched(io);
-
   const size_t nEvents = 1000000;
-  size_t nExpired = 0;
 
-  // Events should expire at t1, but execution finishes at t2. The difference is the overhead.
-  time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s;
-  time::steady_clock::TimePoint t2;
-  // +1ms ensures this extra event is executed last. In case the overhead is less than 1ms,
-  // it will be reported as 1ms.
-  sched.schedule(t1 - time::steady_clock::now() + 1_ms, [&] {
-    t2 = time::steady_clock::now();
-    BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  });
+  // Each run takes several seconds, so fewer repetitions are made by default.
+  Benchmark("Execute", nEvents).setWarmup(0).setRepetitions(3).runTimed([&] {
+    boost::asio::io_service io;
+    Scheduler sched(io);
+    size_t nExpired = 0;
+
+    // Events should expire at t1, but execution finishes at t2. The difference is the overhead.
+    time::steady_clock::TimePoint t1 = time::steady_clock::now() + 5_s;
+    time::steady_clock::TimePoint t2;
+    // +1ms ensures this extra event is executed last. In case the overhead is less than 1ms,
+    // it will be reported as 1ms.
+    sched.schedule(t1 - time::steady_clock::now() + 1_ms, [&] {
+      t2 = time::steady_clock::now();
+      BOOST_REQUIRE_EQUAL(nExpired, nEvents);
+    });
 
-  for (size_t i = 0; i < nEvents; ++i) {
-    sched.schedule(t1 - time::steady_clock::now(), [&] { ++nExpired; });
-  }
+    for (size_t i = 0; i < nEvents; ++i) {
+      sched.schedule(t1 - time::steady_clock::now(), [&] { ++nExpired; });
+    }
 
-  io.run();
+    io.run();
 
-  BOOST_REQUIRE_EQUAL(nExpired, nEvents);
-  std::cout << "execute " << nEvents << " events: " << (t2 - t1) << std::endl;
+    BOOST_REQUIRE_EQUAL(nExpired, nEvents);
+    return time::duration_cast<time::nanoseconds>(t2 - t1);
+  });
 }
 
 } // namespace tests
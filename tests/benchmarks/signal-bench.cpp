@@ -0,0 +1,84 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Signal Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/util/signal.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+
+namespace ndn {
+namespace util {
+namespace signal {
+namespace tests {
+
+using namespace ndn::tests;
+
+const uint64_t N_OPERATIONS = 1000000;
+
+class Owner
+{
+public:
+  void
+  emit(uint64_t value)
+  {
+    sig(value);
+  }
+
+public:
+  Signal<Owner, uint64_t> sig;
+};
+
+BOOST_AUTO_TEST_CASE(ConnectDisconnect)
+{
+  // a signal of a short-lived object, such as a SegmentFetcher, with two handlers
+  Benchmark("Signal/ConnectDisconnect", N_OPERATIONS).run([&] {
+    for (uint64_t i = 0; i < N_OPERATIONS; ++i) {
+      Owner owner;
+      ScopedConnection c1 = owner.sig.connect([] (uint64_t v) { doNotOptimize(v); });
+      ScopedConnection c2 = owner.sig.connect([] (uint64_t v) { doNotOptimize(v); });
+      doNotOptimize(owner);
+    }
+  });
+}
+
+BOOST_AUTO_TEST_CASE(Emit)
+{
+  for (size_t nHandlers : {0, 1, 2}) {
+    Owner owner;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < nHandlers; ++i) {
+      owner.sig.connect([&sum] (uint64_t v) { sum += v; });
+    }
+
+    Benchmark("Signal/Emit/" + to_string(nHandlers), N_OPERATIONS).run([&] {
+      for (uint64_t i = 0; i < N_OPERATIONS; ++i) {
+        owner.emit(i);
+      }
+    });
+    doNotOptimize(sum);
+  }
+}
+
+} // namespace tests
+} // namespace signal
+} // namespace util
+} // namespace ndn
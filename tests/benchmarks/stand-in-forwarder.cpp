@@ -0,0 +1,423 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tests/benchmarks/stand-in-forwarder.hpp"
+
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/lp/packet.hpp"
+#include "ndn-cxx/mgmt/nfd/control-parameters.hpp"
+#include "ndn-cxx/mgmt/nfd/control-response.hpp"
+#include "ndn-cxx/security/signing-helpers.hpp"
+
+#include <boost/asio/write.hpp>
+
+#include <cstdio>
+#include <deque>
+
+namespace ndn {
+namespace tests {
+
+using Socket = boost::asio::generic::stream_protocol::socket;
+
+static const Name COMMAND_PREFIX("/localhost/nfd");
+
+class StandInForwarder::Connection : public std::enable_shared_from_this<Connection>
+{
+public:
+  Connection(StandInForwarder& forwarder, uint64_t faceId, Socket socket)
+    : m_forwarder(forwarder)
+    , m_faceId(faceId)
+    , m_socket(std::move(socket))
+  {
+  }
+
+  uint64_t
+  getFaceId() const
+  {
+    return m_faceId;
+  }
+
+  void
+  start()
+  {
+    receive();
+  }
+
+  void
+  send(Block wire)
+  {
+    m_sendQueue.push_back(std::move(wire));
+    if (m_writing.empty()) {
+      write();
+    }
+  }
+
+  void
+  close()
+  {
+    boost::system::error_code ec;
+    m_socket.close(ec);
+  }
+
+private:
+  void
+  receive()
+  {
+    auto buffer = boost::asio::buffer(m_buffer + m_bufferSize, MAX_NDN_PACKET_SIZE - m_bufferSize);
+    m_socket.async_receive(buffer,
+      [this, self = shared_from_this()] (const boost::system::error_code& error, size_t nBytesRecvd) {
+        if (error) {
+          if (error != boost::asio::error::operation_aborted) {
+            m_forwarder.removeConnection(*this);
+          }
+          return;
+        }
+
+        m_bufferSize += nBytesRecvd;
+        size_t offset = 0;
+        while (offset < m_bufferSize) {
+          bool isOk = false;
+          Block element;
+          std::tie(isOk, element) = Block::fromBuffer({m_buffer + offset, m_bufferSize - offset});
+          if (!isOk) {
+            break;
+          }
+          offset += element.size();
+          m_forwarder.processElement(self, element);
+        }
+
+        if (offset == 0 && m_bufferSize == MAX_NDN_PACKET_SIZE) {
+          // the peer sent an element that cannot be decoded
+          m_forwarder.removeConnection(*this);
+          return;
+        }
+        std::copy(m_buffer + offset, m_buffer + m_bufferSize, m_buffer);
+        m_bufferSize -= offset;
+        receive();
+      });
+  }
+
+  void
+  write()
+  {
+    BOOST_ASSERT(m_writing.empty());
+    if (m_sendQueue.empty()) {
+      return;
+    }
+
+    std::vector<boost::asio::const_buffer> buffers;
+    for (auto& wire : m_sendQueue) {
+      buffers.emplace_back(wire.data(), wire.size());
+      m_writing.push_back(std::move(wire));
+    }
+    m_sendQueue.clear();
+
+    boost::asio::async_write(m_socket, buffers,
+      [this, self = shared_from_this()] (const boost::system::error_code& error, size_t) {
+        m_writing.clear();
+        if (error) {
+          if (error != boost::asio::error::operation_aborted) {
+            m_forwarder.removeConnection(*this);
+          }
+          return;
+        }
+        write();
+      });
+  }
+
+private:
+  StandInForwarder& m_forwarder;
+  const uint64_t m_faceId;
+  Socket m_socket;
+  uint8_t m_buffer[MAX_NDN_PACKET_SIZE];
+  size_t m_bufferSize = 0;
+  std::deque<Block> m_sendQueue;
+  std::vector<Block> m_writing;
+};
+
+StandInForwarder::StandInForwarder(boost::asio::io_service& io, const std::string& unixSocketPath)
+  : m_scheduler(io)
+  , m_keyChain("pib-memory:", "tpm-memory:")
+  , m_unixSocketPath(unixSocketPath)
+  , m_unixAcceptor(io)
+  , m_tcpAcceptor(io, {boost::asio::ip::address_v4::loopback(), 0})
+{
+  std::remove(m_unixSocketPath.c_str());
+  m_unixAcceptor.open();
+  m_unixAcceptor.bind(m_unixSocketPath);
+  m_unixAcceptor.listen();
+
+  acceptUnix();
+  acceptTcp();
+}
+
+StandInForwarder::~StandInForwarder()
+{
+  m_unixAcceptor.close();
+  m_tcpAcceptor.close();
+  for (auto& connection : m_connections) {
+    connection.second->close();
+  }
+  std::remove(m_unixSocketPath.c_str());
+}
+
+void
+StandInForwarder::acceptUnix()
+{
+  m_unixAcceptor.async_accept(
+    [this] (const boost::system::error_code& error, boost::asio::local::stream_protocol::socket socket) {
+      if (error) {
+        return;
+      }
+      addConnection(Socket(std::move(socket)));
+      acceptUnix();
+    });
+}
+
+void
+StandInForwarder::acceptTcp()
+{
+  m_tcpAcceptor.async_accept(
+    [this] (const boost::system::error_code& error, boost::asio::ip::tcp::socket socket) {
+      if (error) {
+        return;
+      }
+      boost::system::error_code ec;
+      socket.set_option(boost::asio::ip::tcp::no_delay(true), ec);
+      addConnection(Socket(std::move(socket)));
+      acceptTcp();
+    });
+}
+
+void
+StandInForwarder::addConnection(Socket socket)
+{
+  auto faceId = ++m_lastFaceId;
+  auto connection = make_shared<Connection>(*this, faceId, std::move(socket));
+  m_connections.emplace(faceId, connection);
+  connection->start();
+}
+
+void
+StandInForwarder::removeConnection(Connection& connection)
+{
+  connection.close();
+  // routes and PIT entries pointing to the connection expire with its last shared_ptr
+  m_connections.erase(connection.getFaceId());
+}
+
+void
+StandInForwarder::processElement(const shared_ptr<Connection>& connection, const Block& element)
+{
+  try {
+    if (element.type() == tlv::Interest) {
+      processInterest(connection, element);
+      return;
+    }
+    if (element.type() == tlv::Data) {
+      processData(element);
+      return;
+    }
+
+    lp::Packet lpPacket(element);
+    if (!lpPacket.has<lp::FragmentField>()) {
+      return; // IDLE packet
+    }
+    auto frag = lpPacket.get<lp::FragmentField>();
+    Block packet({frag.first, frag.second});
+    if (packet.type() == tlv::Interest) {
+      if (lpPacket.has<lp::NackField>()) {
+        processNack(element, Interest(packet));
+      }
+      else {
+        processInterest(connection, packet);
+      }
+    }
+    else if (packet.type() == tlv::Data) {
+      processData(packet);
+    }
+  }
+  catch (const tlv::Error&) {
+    // drop malformed packet
+  }
+}
+
+void
+StandInForwarder::processInterest(const shared_ptr<Connection>& connection, const Block& packet)
+{
+  Interest interest(packet);
+  const Name& name = interest.getName();
+  if (COMMAND_PREFIX.isPrefixOf(name)) {
+    processCommand(connection, interest);
+    return;
+  }
+
+  auto it = m_pit.find(name);
+  if (it != m_pit.end()) {
+    // aggregated with a pending Interest
+    it->second.downstreams.push_back(connection);
+    return;
+  }
+
+  auto nextHop = findNextHop(name, *connection);
+  if (nextHop == nullptr) {
+    ++nNoRouteNacks;
+    sendNack(*connection, interest, lp::NackReason::NO_ROUTE);
+    return;
+  }
+
+  auto& entry = m_pit[name];
+  entry.downstreams.push_back(connection);
+  entry.expiry = m_scheduler.schedule(interest.getInterestLifetime(),
+                                      [this, name] { m_pit.erase(name); });
+  ++nForwardedInterests;
+  nextHop->send(packet);
+}
+
+void
+StandInForwarder::processCommand(const shared_ptr<Connection>& connection, const Interest& interest)
+{
+  const Name& name = interest.getName();
+  if (name.size() <= COMMAND_PREFIX.size() + 2) {
+    return;
+  }
+
+  nfd::ControlResponse response(200, "OK");
+  nfd::ControlParameters parameters;
+  try {
+    parameters.wireDecode(name[COMMAND_PREFIX.size() + 2].blockFromValue());
+  }
+  catch (const tlv::Error& e) {
+    response.setCode(400).setText(e.what());
+  }
+
+  auto module = name[COMMAND_PREFIX.size()].toUri();
+  auto verb = name[COMMAND_PREFIX.size() + 1].toUri();
+  if (response.getCode() != 200) {
+    // malformed parameters
+  }
+  else if (module != "rib" || (verb != "register" && verb != "unregister") ||
+           !parameters.hasName()) {
+    response.setCode(501).setText("Not implemented");
+  }
+  else {
+    parameters.setFaceId(connection->getFaceId());
+    if (!parameters.hasOrigin()) {
+      parameters.setOrigin(nfd::ROUTE_ORIGIN_APP);
+    }
+
+    auto& nextHops = m_fib[parameters.getName()];
+    nextHops.erase(std::remove_if(nextHops.begin(), nextHops.end(),
+                                  [&] (const auto& nh) {
+                                    auto c = nh.lock();
+                                    return c == nullptr || c == connection;
+                                  }),
+                   nextHops.end());
+    if (verb == "register") {
+      nextHops.push_back(connection);
+      if (!parameters.hasCost()) {
+        parameters.setCost(0);
+      }
+      if (!parameters.hasFlags()) {
+        parameters.setFlags(nfd::ROUTE_FLAG_CHILD_INHERIT);
+      }
+    }
+    else if (nextHops.empty()) {
+      m_fib.erase(parameters.getName());
+    }
+    response.setBody(parameters.wireEncode());
+  }
+
+  Data data(name);
+  data.setContent(response.wireEncode());
+  m_keyChain.sign(data, security::signingWithSha256());
+  connection->send(data.wireEncode());
+}
+
+void
+StandInForwarder::processData(const Block& packet)
+{
+  packet.parse();
+  Name name(packet.get(tlv::Name));
+
+  // satisfy pending Interests whose name is the Data name or a prefix of it
+  for (size_t len = name.size() + 1; len-- > 0;) {
+    auto it = m_pit.find(len == name.size() ? name : name.getPrefix(len));
+    if (it == m_pit.end()) {
+      continue;
+    }
+    for (const auto& downstream : it->second.downstreams) {
+      auto connection = downstream.lock();
+      if (connection != nullptr) {
+        ++nReturnedData;
+        connection->send(packet);
+      }
+    }
+    m_pit.erase(it);
+  }
+}
+
+void
+StandInForwarder::processNack(const Block& lpPacket, const Interest& interest)
+{
+  auto it = m_pit.find(interest.getName());
+  if (it == m_pit.end()) {
+    return;
+  }
+  for (const auto& downstream : it->second.downstreams) {
+    auto connection = downstream.lock();
+    if (connection != nullptr) {
+      connection->send(lpPacket);
+    }
+  }
+  m_pit.erase(it);
+}
+
+shared_ptr<StandInForwarder::Connection>
+StandInForwarder::findNextHop(const Name& name, const Connection& incoming)
+{
+  for (size_t len = name.size() + 1; len-- > 0;) {
+    auto it = m_fib.find(len == name.size() ? name : name.getPrefix(len));
+    if (it == m_fib.end()) {
+      continue;
+    }
+    for (const auto& nextHop : it->second) {
+      auto connection = nextHop.lock();
+      if (connection != nullptr && connection.get() != &incoming) {
+        return connection;
+      }
+    }
+  }
+  return nullptr;
+}
+
+void
+StandInForwarder::sendNack(Connection& connection, const Interest& interest, lp::NackReason reason)
+{
+  const Block& wire = interest.wireEncode();
+  lp::Packet lpPacket;
+  lpPacket.add<lp::NackField>(lp::NackHeader().setReason(reason));
+  lpPacket.add<lp::FragmentField>({wire.begin(), wire.end()});
+  connection.send(lpPacket.wireEncode());
+}
+
+} // namespace tests
+} // namespace ndn
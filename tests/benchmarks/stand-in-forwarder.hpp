@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_TESTS_BENCHMARKS_STAND_IN_FORWARDER_HPP
+#define NDN_CXX_TESTS_BENCHMARKS_STAND_IN_FORWARDER_HPP
+
+#include "ndn-cxx/interest.hpp"
+#include "ndn-cxx/lp/nack-header.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/util/scheduler.hpp"
+
+#include <boost/asio/generic/stream_protocol.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+
+#include <map>
+
+namespace ndn {
+namespace tests {
+
+/**
+ * @brief Minimal in-process stand-in for NFD, for benchmarks that exercise real transports.
+ *
+ * The forwarder accepts Face connections on a Unix stream socket and on a TCP port of the
+ * loopback interface. It answers `rib/register` and `rib/unregister` commands, forwards each
+ * Interest to the first connection whose registered prefix is the longest match of the Interest
+ * name, aggregates Interests with the same name in a PIT, and returns Data and Nacks along the
+ * reverse path. Interests without a route are answered with a Nack. There is no content store,
+ * forwarding strategy, or loop detection.
+ *
+ * All operations happen on the io_service passed to the constructor, which may be run on a
+ * separate thread from the Faces connecting to it. The forwarder must be destroyed after that
+ * io_service has stopped running, and its counters should only be read at that time.
+ */
+class StandInForwarder : noncopyable
+{
+public:
+  /**
+   * @brief Start listening on @p unixSocketPath and on an ephemeral TCP port on 127.0.0.1.
+   */
+  StandInForwarder(boost::asio::io_service& io, const std::string& unixSocketPath);
+
+  ~StandInForwarder();
+
+  const std::string&
+  getUnixSocketPath() const
+  {
+    return m_unixSocketPath;
+  }
+
+  uint16_t
+  getTcpPort() const
+  {
+    return m_tcpAcceptor.local_endpoint().port();
+  }
+
+public:
+  /// Interests forwarded to a producer
+  uint64_t nForwardedInterests = 0;
+  /// Interests answered with a Nack because there is no route
+  uint64_t nNoRouteNacks = 0;
+  /// Data returned to a consumer, counting each downstream separately
+  uint64_t nReturnedData = 0;
+
+private:
+  class Connection;
+
+  struct PitEntry
+  {
+    std::vector<weak_ptr<Connection>> downstreams;
+    scheduler::ScopedEventId expiry;
+  };
+
+  void
+  acceptUnix();
+
+  void
+  acceptTcp();
+
+  void
+  addConnection(boost::asio::generic::stream_protocol::socket socket);
+
+  void
+  removeConnection(Connection& connection);
+
+  void
+  processElement(const shared_ptr<Connection>& connection, const Block& element);
+
+  void
+  processInterest(const shared_ptr<Connection>& connection, const Block& packet);
+
+  void
+  processCommand(const shared_ptr<Connection>& connection, const Interest& interest);
+
+  void
+  processData(const Block& packet);
+
+  void
+  processNack(const Block& lpPacket, const Interest& interest);
+
+  shared_ptr<Connection>
+  findNextHop(const Name& name, const Connection& incoming);
+
+  void
+  sendNack(Connection& connection, const Interest& interest, lp::NackReason reason);
+
+private:
+  Scheduler m_scheduler;
+  KeyChain m_keyChain;
+
+  std::string m_unixSocketPath;
+  boost::asio::local::stream_protocol::acceptor m_unixAcceptor;
+  boost::asio::ip::tcp::acceptor m_tcpAcceptor;
+
+  uint64_t m_lastFaceId = 255;
+  std::map<uint64_t, shared_ptr<Connection>> m_connections;
+  std::map<Name, std::vector<weak_ptr<Connection>>> m_fib;
+  std::map<Name, PitEntry> m_pit;
+};
+
+} // namespace tests
+} // namespace ndn
+
+#endif // NDN_CXX_TESTS_BENCHMARKS_STAND_IN_FORWARDER_HPP
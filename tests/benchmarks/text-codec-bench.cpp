@@ -0,0 +1,190 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#define BOOST_TEST_MODULE ndn-cxx Text Codec Benchmark
+#include "tests/boost-test.hpp"
+
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/key-chain.hpp"
+#include "ndn-cxx/security/transform/base64-decode.hpp"
+#include "ndn-cxx/security/transform/base64-encode.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+#include "ndn-cxx/util/io.hpp"
+#include "ndn-cxx/util/string-helper.hpp"
+#include "tests/benchmarks/benchmark.hpp"
+
+#include <openssl/bio.h>
+#include <openssl/evp.h>
+
+#include <sstream>
+
+namespace ndn {
+namespace tests {
+
+namespace tr = security::transform;
+
+const size_t N_ITERATIONS = 2000;
+const size_t INPUT_SIZES[] = {32, 1024, 65536};
+
+static Buffer
+makeInput(size_t size)
+{
+  Buffer input(size);
+  for (size_t i = 0; i < size; ++i) {
+    input[i] = static_cast<uint8_t>(i * 31 + 7);
+  }
+  return input;
+}
+
+/**
+ * @brief Run @p f once per iteration and report the throughput of @p inputSize bytes each.
+ */
+template<typename F>
+static void
+benchmarkCodec(const std::string& name, size_t inputSize, F&& f)
+{
+  size_t nIterations = std::max<size_t>(1, N_ITERATIONS * 1024 / std::max<size_t>(inputSize, 1024));
+  Benchmark bm(name + "/" + to_string(inputSize), nIterations);
+  bm.run([&] {
+    for (size_t i = 0; i < nIterations; ++i) {
+      f();
+    }
+  });
+  bm.addMetric("MB/s", inputSize * 1000.0 / bm.getResult().median);
+}
+
+BOOST_AUTO_TEST_CASE(Hex)
+{
+  for (size_t size : INPUT_SIZES) {
+    auto input = makeInput(size);
+    auto hex = toHex(input);
+
+    benchmarkCodec("Hex/Encode/String", size, [&] {
+      doNotOptimize(toHex(input));
+    });
+
+    std::string output(size * 2, '\0');
+    benchmarkCodec("Hex/Encode/Span", size, [&] {
+      doNotOptimize(toHex(input, {&output[0], output.size()}));
+    });
+
+    benchmarkCodec("Hex/Encode/Ostream", size, [&] {
+      std::ostringstream os;
+      printHex(os, input);
+      doNotOptimize(os);
+    });
+
+    benchmarkCodec("Hex/Decode/Buffer", size, [&] {
+      doNotOptimize(fromHex(hex));
+    });
+
+    Buffer decoded(size);
+    benchmarkCodec("Hex/Decode/Span", size, [&] {
+      doNotOptimize(fromHex(hex, decoded));
+    });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Base64)
+{
+  for (size_t size : INPUT_SIZES) {
+    auto input = makeInput(size);
+    auto base64 = toBase64(input);
+
+    benchmarkCodec("Base64/Encode/String", size, [&] {
+      doNotOptimize(toBase64(input));
+    });
+
+    benchmarkCodec("Base64/Encode/Transform", size, [&] {
+      OBufferStream os;
+      tr::bufferSource(input) >> tr::base64Encode() >> tr::streamSink(os);
+      doNotOptimize(os.buf());
+    });
+
+    // reference: OpenSSL's base64 BIO, previously used by transform::Base64Encode
+    benchmarkCodec("Base64/Encode/OpenSslBio", size, [&] {
+      BIO* b64 = BIO_new(BIO_f_base64());
+      BIO* sink = BIO_new(BIO_s_mem());
+      BIO_push(b64, sink);
+      BIO_write(b64, input.data(), static_cast<int>(input.size()));
+      (void)BIO_flush(b64);
+      char* data = nullptr;
+      doNotOptimize(BIO_get_mem_data(sink, &data));
+      BIO_free_all(b64);
+    });
+
+    benchmarkCodec("Base64/Decode/Buffer", size, [&] {
+      doNotOptimize(fromBase64(base64));
+    });
+
+    benchmarkCodec("Base64/Decode/Transform", size, [&] {
+      OBufferStream os;
+      tr::bufferSource(base64) >> tr::base64Decode() >> tr::streamSink(os);
+      doNotOptimize(os.buf());
+    });
+
+    benchmarkCodec("Base64/Decode/OpenSslBio", size, [&] {
+      BIO* b64 = BIO_new(BIO_f_base64());
+      BIO* source = BIO_new_mem_buf(base64.data(), static_cast<int>(base64.size()));
+      BIO_push(b64, source);
+      Buffer decoded(size);
+      doNotOptimize(BIO_read(b64, decoded.data(), static_cast<int>(decoded.size())));
+      BIO_free_all(b64);
+    });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Certificate)
+{
+  KeyChain keyChain("pib-memory:", "tpm-memory:");
+  auto cert = keyChain.createIdentity("/benchmark").getDefaultKey().getDefaultCertificate();
+
+  std::ostringstream saved;
+  io::save(cert, saved);
+  const std::string certBase64 = saved.str();
+
+  Benchmark("Certificate/Save", N_ITERATIONS).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      std::ostringstream os;
+      io::save(cert, os);
+      doNotOptimize(os);
+    }
+  });
+
+  Benchmark("Certificate/Load", N_ITERATIONS).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      std::istringstream is(certBase64);
+      doNotOptimize(io::load<security::Certificate>(is));
+    }
+  });
+
+  Benchmark("Certificate/Print", N_ITERATIONS).run([&] {
+    for (size_t i = 0; i < N_ITERATIONS; ++i) {
+      std::ostringstream os;
+      os << cert;
+      doNotOptimize(os);
+    }
+  });
+}
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "tests/benchmarks/workload.hpp"
+
+namespace ndn {
+namespace tests {
+
+static const char* const PREFIX_VOCABULARY[] = {
+  "ndn", "edu", "com", "org", "ucla", "arizona", "memphis", "wustl", "localhop",
+  "video", "chat", "sensor", "repo", "nlsr", "sync", "file", "camera", "printer",
+};
+
+WorkloadGenerator::WorkloadGenerator(uint32_t seed)
+  : m_rng(seed)
+{
+}
+
+Name
+WorkloadGenerator::makeName()
+{
+  Name name;
+
+  size_t nPrefixComponents = makeInteger(1, 3);
+  for (size_t i = 0; i < nPrefixComponents; ++i) {
+    auto index = makeInteger(0, sizeof(PREFIX_VOCABULARY) / sizeof(PREFIX_VOCABULARY[0]) - 1);
+    name.append(PREFIX_VOCABULARY[index]);
+  }
+
+  size_t nAppComponents = makeInteger(1, 4);
+  for (size_t i = 0; i < nAppComponents; ++i) {
+    std::string component(makeInteger(3, 20), '\0');
+    for (auto& c : component) {
+      static const char ALPHABET[] = "abcdefghijklmnopqrstuvwxyz0123456789-_";
+      c = ALPHABET[makeInteger(0, sizeof(ALPHABET) - 2)];
+    }
+    name.append(component.c_str());
+  }
+
+  if (makeBool(0.5)) {
+    name.appendVersion(makeInteger(1500000000000000, 1700000000000000));
+    if (makeBool(0.8)) {
+      name.appendSegment(makeInteger(0, 2000));
+    }
+  }
+  return name;
+}
+
+size_t
+WorkloadGenerator::makePayloadSize()
+{
+  double p = std::uniform_real_distribution<double>(0.0, 1.0)(m_rng);
+  if (p < 0.2) {
+    return makeInteger(0, 64);
+  }
+  if (p < 0.5) {
+    return makeInteger(65, 1400);
+  }
+  return makeInteger(1401, 8000);
+}
+
+std::vector<uint8_t>
+WorkloadGenerator::makePayload(size_t size)
+{
+  std::vector<uint8_t> payload(size);
+  for (auto& b : payload) {
+    b = static_cast<uint8_t>(m_rng());
+  }
+  return payload;
+}
+
+size_t
+WorkloadGenerator::makeInteger(size_t min, size_t max)
+{
+  return std::uniform_int_distribution<size_t>(min, max)(m_rng);
+}
+
+bool
+WorkloadGenerator::makeBool(double p)
+{
+  return std::bernoulli_distribution(p)(m_rng);
+}
+
+ConstBufferPtr
+makeWireBuffer(const Block& block)
+{
+  return std::make_shared<Buffer>(block.begin(), block.end());
+}
+
+} // namespace tests
+} // namespace ndn
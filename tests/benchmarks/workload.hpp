@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_CXX_TESTS_BENCHMARKS_WORKLOAD_HPP
+#define NDN_CXX_TESTS_BENCHMARKS_WORKLOAD_HPP
+
+#include "ndn-cxx/name.hpp"
+
+#include <random>
+
+namespace ndn {
+namespace tests {
+
+/**
+ * @brief Deterministic generator of names and payloads for codec benchmarks.
+ *
+ * The generated names resemble application names, i.e., a routable prefix drawn from a small
+ * vocabulary, a few application-specific components, and often a version and a segment number.
+ * Payload sizes are a mix of small control messages, packets that fit in an Ethernet frame,
+ * and large segments. The same seed always produces the same sequence.
+ */
+class WorkloadGenerator
+{
+public:
+  explicit
+  WorkloadGenerator(uint32_t seed = 1);
+
+  /**
+   * @brief Generate a name of 2 to 9 components.
+   */
+  Name
+  makeName();
+
+  /**
+   * @brief Generate a payload size between 0 and 8000 octets.
+   */
+  size_t
+  makePayloadSize();
+
+  /**
+   * @brief Generate a payload of @p size random octets.
+   */
+  std::vector<uint8_t>
+  makePayload(size_t size);
+
+  /**
+   * @brief Return a uniformly distributed integer between @p min and @p max inclusive.
+   */
+  size_t
+  makeInteger(size_t min, size_t max);
+
+  /**
+   * @brief Return true with probability @p p.
+   */
+  bool
+  makeBool(double p);
+
+private:
+  std::mt19937 m_rng;
+};
+
+/**
+ * @brief Copy the wire encoding of @p block into a buffer of its exact size.
+ *
+ * The buffer of an encoded Block may contain other octets before and after the element, and
+ * thus cannot be decoded with the Block(const ConstBufferPtr&) constructor.
+ */
+ConstBufferPtr
+makeWireBuffer(const Block& block);
+
+} // namespace tests
+} // namespace ndn
+
+#endif // NDN_CXX_TESTS_BENCHMARKS_WORKLOAD_HPP
@@ -37,26 +37,19 @@ BOOST_AUTO_TEST_CASE(CongestionMark)
 
   BOOST_CHECK_EQUAL(interest.getCongestionMark(), 0);
 
-  auto tag = interest.getTag<lp::CongestionMarkTag>();
-  BOOST_CHECK(!tag);
+  BOOST_CHECK(interest.getTagValue<lp::CongestionMarkTag>() == nullopt);
 
   interest.setCongestionMark(true);
-  tag = interest.getTag<lp::CongestionMarkTag>();
-  BOOST_REQUIRE(tag);
-  BOOST_CHECK_EQUAL(*tag, 1);
+  BOOST_CHECK(interest.getTagValue<lp::CongestionMarkTag>() == 1U);
 
   interest.setCongestionMark(false);
-  tag = interest.getTag<lp::CongestionMarkTag>();
-  BOOST_CHECK(!tag);
+  BOOST_CHECK(interest.getTagValue<lp::CongestionMarkTag>() == nullopt);
 
   interest.setCongestionMark(300);
-  tag = interest.getTag<lp::CongestionMarkTag>();
-  BOOST_REQUIRE(tag);
-  BOOST_CHECK_EQUAL(*tag, 300);
+  BOOST_CHECK(interest.getTagValue<lp::CongestionMarkTag>() == 300U);
 
   interest.setCongestionMark(0);
-  tag = interest.getTag<lp::CongestionMarkTag>();
-  BOOST_CHECK(!tag);
+  BOOST_CHECK(interest.getTagValue<lp::CongestionMarkTag>() == nullopt);
 }
 
 BOOST_AUTO_TEST_SUITE_END() // TestPacketBase
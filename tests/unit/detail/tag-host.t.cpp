@@ -81,6 +81,84 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Basic, T, Fixtures, T)
   BOOST_CHECK(this->template getTag<TestTag2>() == nullptr);
 }
 
+using InlineTag = SimpleTag<uint64_t, 3>;
+template<int TypeId>
+using U64Tag = SimpleTag<uint64_t, TypeId>;
+using ObjectTag = SimpleTag<std::string, 4>;
+
+static_assert(detail::IsInlineTag<InlineTag>::value, "");
+static_assert(!detail::IsInlineTag<ObjectTag>::value, "");
+static_assert(!detail::IsInlineTag<TestTag>::value, "");
+
+BOOST_AUTO_TEST_CASE(InlineValue)
+{
+  TagHost host;
+  BOOST_CHECK(host.getTagValue<InlineTag>() == nullopt);
+
+  host.setTagValue<InlineTag>(42);
+  BOOST_CHECK(host.getTagValue<InlineTag>() == 42U);
+
+  // a Tag object is created on each access, without modifying the host
+  auto tag = host.getTag<InlineTag>();
+  BOOST_REQUIRE(tag != nullptr);
+  BOOST_CHECK_EQUAL(tag->get(), 42U);
+  BOOST_CHECK_NE(host.getTag<InlineTag>(), tag);
+  BOOST_CHECK_EQUAL(host.getTag<InlineTag>()->get(), 42U);
+
+  // replacing the value does not modify the Tag object previously returned
+  host.setTagValue<InlineTag>(43);
+  BOOST_CHECK_EQUAL(tag->get(), 42U);
+  BOOST_CHECK_EQUAL(host.getTag<InlineTag>()->get(), 43U);
+  BOOST_CHECK(host.getTagValue<InlineTag>() == 43U);
+
+  host.setTag(make_shared<InlineTag>(44));
+  BOOST_CHECK(host.getTagValue<InlineTag>() == 44U);
+
+  TagHost copy(host);
+  host.removeTag<InlineTag>();
+  BOOST_CHECK(host.getTag<InlineTag>() == nullptr);
+  BOOST_CHECK(host.getTagValue<InlineTag>() == nullopt);
+  BOOST_CHECK(copy.getTagValue<InlineTag>() == 44U);
+}
+
+BOOST_AUTO_TEST_CASE(ObjectValue)
+{
+  TagHost host;
+  host.setTagValue<ObjectTag>("value");
+  BOOST_CHECK(host.getTagValue<ObjectTag>() == "value"s);
+  auto tag = host.getTag<ObjectTag>();
+  BOOST_REQUIRE(tag != nullptr);
+  BOOST_CHECK_EQUAL(tag->get(), "value");
+  BOOST_CHECK_EQUAL(host.getTag<ObjectTag>(), tag);
+
+  host.removeTag<ObjectTag>();
+  BOOST_CHECK(host.getTagValue<ObjectTag>() == nullopt);
+}
+
+BOOST_AUTO_TEST_CASE(ManyTags)
+{
+  TagHost host;
+  host.setTagValue<U64Tag<10>>(10);
+  host.setTagValue<U64Tag<11>>(11);
+  host.setTagValue<U64Tag<12>>(12);
+  host.setTag(make_shared<TestTag>());
+  host.setTagValue<U64Tag<1000>>(1000);
+
+  BOOST_CHECK(host.getTagValue<U64Tag<10>>() == 10U);
+  BOOST_CHECK(host.getTagValue<U64Tag<11>>() == 11U);
+  BOOST_CHECK(host.getTagValue<U64Tag<12>>() == 12U);
+  BOOST_CHECK(host.getTag<TestTag>() != nullptr);
+  BOOST_CHECK(host.getTagValue<U64Tag<1000>>() == 1000U);
+
+  host.removeTag<U64Tag<11>>();
+  host.setTag<TestTag>(nullptr);
+  BOOST_CHECK(host.getTagValue<U64Tag<10>>() == 10U);
+  BOOST_CHECK(host.getTagValue<U64Tag<11>>() == nullopt);
+  BOOST_CHECK(host.getTagValue<U64Tag<12>>() == 12U);
+  BOOST_CHECK(host.getTag<TestTag>() == nullptr);
+  BOOST_CHECK(host.getTagValue<U64Tag<1000>>() == 1000U);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestTagHost
 BOOST_AUTO_TEST_SUITE_END() // Detail
 
@@ -0,0 +1,206 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2018 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/detail/tlv-schema.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+using namespace ndn::detail;
+
+BOOST_AUTO_TEST_SUITE(Detail)
+BOOST_AUTO_TEST_SUITE(TestTlvSchema)
+
+enum class Color : uint8_t {
+  RED = 1,
+  BLUE = 2,
+};
+
+struct Record
+{
+  class Error : public tlv::Error
+  {
+  public:
+    using tlv::Error::Error;
+  };
+
+  uint64_t id = 0;
+  Color color = Color::RED;
+  std::string label;
+  Name prefix;
+  Name strategy;
+  optional<time::milliseconds> lifetime;
+  time::system_clock::TimePoint timestamp;
+  std::bitset<3> flags;
+  optional<uint64_t> cost;
+};
+
+struct RecordSchema
+{
+  static constexpr auto
+  describe()
+  {
+    return tlvStruct(0x80, "Record",
+      tlvField(0x81, "Id", &Record::id),
+      tlvField(0x82, "Color", &Record::color),
+      tlvField(0x83, "Label", &Record::label),
+      tlvField(tlv::Name, "Name", &Record::prefix),
+      tlvField(0x84, "Strategy", &Record::strategy),
+      tlvField(0x85, "Lifetime", &Record::lifetime),
+      tlvField(0x86, "Timestamp", &Record::timestamp),
+      tlvField(0x87, "Flags", &Record::flags),
+      tlvField(0x88, "Cost", &Record::cost));
+  }
+};
+
+using RecordCodec = TlvCodec<RecordSchema, Record>;
+
+static_assert(RecordSchema::describe().hasDistinctTypes(), "");
+static_assert(!tlvStruct(0x80, "Duplicate",
+                         tlvField(0x81, "A", &Record::id),
+                         tlvField(0x82, "B", &Record::label),
+                         tlvField(0x81, "C", &Record::cost)).hasDistinctTypes(), "");
+
+static Record
+makeRecord()
+{
+  Record r;
+  r.id = 300;
+  r.color = Color::BLUE;
+  r.label = "lbl";
+  r.prefix = "/A";
+  r.strategy = "/S";
+  r.lifetime = 4_s;
+  r.timestamp = time::fromUnixTimestamp(1_s);
+  r.flags = 0b101;
+  return r;
+}
+
+const uint8_t RECORD_WIRE[] = {
+  0x80, 0x23,
+        0x81, 0x02, 0x01, 0x2c, // Id
+        0x82, 0x01, 0x02, // Color
+        0x83, 0x03, 0x6c, 0x62, 0x6c, // Label
+        0x07, 0x03, 0x08, 0x01, 0x41, // Name
+        0x84, 0x05, 0x07, 0x03, 0x08, 0x01, 0x53, // Strategy
+        0x85, 0x02, 0x0f, 0xa0, // Lifetime
+        0x86, 0x02, 0x03, 0xe8, // Timestamp
+        0x87, 0x01, 0x05, // Flags
+};
+
+BOOST_AUTO_TEST_CASE(Encode)
+{
+  Record r = makeRecord();
+  BOOST_CHECK_EQUAL(RecordCodec::size(r), sizeof(RECORD_WIRE));
+
+  Block wire = RecordCodec::encode(r);
+  BOOST_CHECK_EQUAL_COLLECTIONS(wire.begin(), wire.end(), RECORD_WIRE, RECORD_WIRE + sizeof(RECORD_WIRE));
+
+  EncodingEstimator estimator;
+  BOOST_CHECK_EQUAL(RecordCodec::prepend(estimator, r), sizeof(RECORD_WIRE));
+
+  // optional field with a value
+  r.cost = 0;
+  wire = RecordCodec::encode(r);
+  BOOST_CHECK_EQUAL(wire.size(), sizeof(RECORD_WIRE) + 3);
+  BOOST_CHECK_EQUAL(RecordCodec::size(r), wire.size());
+}
+
+BOOST_AUTO_TEST_CASE(Decode)
+{
+  Block wire(RECORD_WIRE);
+  Record r;
+  r.cost = 7;
+  RecordCodec::decode(wire, r);
+  BOOST_CHECK_EQUAL(r.id, 300);
+  BOOST_CHECK(r.color == Color::BLUE);
+  BOOST_CHECK_EQUAL(r.label, "lbl");
+  BOOST_CHECK_EQUAL(r.prefix, "/A");
+  BOOST_CHECK_EQUAL(r.strategy, "/S");
+  BOOST_CHECK(r.lifetime == 4_s);
+  BOOST_CHECK(r.timestamp == time::fromUnixTimestamp(1_s));
+  BOOST_CHECK_EQUAL(r.flags.to_ulong(), 0b101);
+  BOOST_CHECK(!r.cost); // absent optional field is reset
+
+  Record r2 = makeRecord();
+  r2.lifetime = nullopt;
+  r2.cost = 9000;
+  RecordCodec::decode(RecordCodec::encode(r2), r);
+  BOOST_CHECK(!r.lifetime);
+  BOOST_CHECK(r.cost == 9000U);
+}
+
+BOOST_AUTO_TEST_CASE(DecodeIgnoreTrailing)
+{
+  Buffer buf(RECORD_WIRE, sizeof(RECORD_WIRE));
+  buf[1] += 3;
+  buf.insert(buf.end(), {0xF0, 0x01, 0x00});
+  Record r;
+  BOOST_CHECK_NO_THROW(RecordCodec::decode(Block(buf), r));
+  BOOST_CHECK_EQUAL(r.label, "lbl");
+}
+
+BOOST_AUTO_TEST_CASE(DecodeError)
+{
+  Record r;
+
+  // wrong TLV-TYPE
+  BOOST_CHECK_THROW(RecordCodec::decode(makeEmptyBlock(0x90), r), Record::Error);
+
+  // missing required field
+  BOOST_CHECK_EXCEPTION(RecordCodec::decode(makeEmptyBlock(0x80), r), Record::Error,
+                        [] (const auto& e) { return e.what() == "missing required Id field"s; });
+
+  // out of order
+  static const uint8_t outOfOrder[] = {
+    0x80, 0x07,
+          0x82, 0x01, 0x02, // Color
+          0x81, 0x02, 0x01, 0x2c, // Id
+  };
+  BOOST_CHECK_THROW(RecordCodec::decode(Block(outOfOrder), r), Record::Error);
+
+  // value out of range
+  Buffer buf(RECORD_WIRE, sizeof(RECORD_WIRE));
+  buf[7] = 0x02; // Color is 0x0300
+  buf[8] = 0x03;
+  buf.insert(buf.begin() + 9, 0x00);
+  buf[1] += 1;
+  BOOST_CHECK_THROW(RecordCodec::decode(Block(buf), r), tlv::Error);
+
+  // Strategy does not contain a Name
+  static const uint8_t noStrategyName[] = {
+    0x80, 0x13,
+          0x81, 0x02, 0x01, 0x2c, // Id
+          0x82, 0x01, 0x02, // Color
+          0x83, 0x03, 0x6c, 0x62, 0x6c, // Label
+          0x07, 0x03, 0x08, 0x01, 0x41, // Name
+          0x84, 0x00, // Strategy
+  };
+  BOOST_CHECK_THROW(RecordCodec::decode(Block(noStrategyName), r), Record::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestTlvSchema
+BOOST_AUTO_TEST_SUITE_END() // Detail
+
+} // namespace tests
+} // namespace ndn
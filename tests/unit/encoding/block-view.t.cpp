@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/block-view.hpp"
+#include "ndn-cxx/encoding/block-helpers.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <iterator>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Encoding)
+BOOST_AUTO_TEST_SUITE(TestBlockView)
+
+const uint8_t PACKET[] = {
+  0x06, 0x15, // Data
+        0x07, 0x0a, // Name
+              0x08, 0x05, 0x68, 0x65, 0x6c, 0x6c, 0x6f, // GenericNameComponent 'hello'
+              0x08, 0x01, 0x31, // GenericNameComponent '1'
+        0x14, 0x03, // MetaInfo
+              0x19, 0x01, 0x0a, // FreshnessPeriod 10
+        0x15, 0x00, // Content empty
+        0x17, 0x00, // SignatureValue empty
+  0xff, 0xff, // trailing bytes
+};
+
+BOOST_AUTO_TEST_CASE(Default)
+{
+  BlockView v;
+  BOOST_CHECK_EQUAL(v.isValid(), false);
+  BOOST_CHECK_EQUAL(v.hasWire(), false);
+  BOOST_CHECK_EQUAL(v.value_size(), 0);
+  BOOST_CHECK(v.value() == nullptr);
+  BOOST_CHECK(v.elements_begin() == v.elements_end());
+}
+
+BOOST_AUTO_TEST_CASE(FromBuffer)
+{
+  BlockView v(PACKET);
+  BOOST_CHECK_EQUAL(v.isValid(), true);
+  BOOST_CHECK_EQUAL(v.hasWire(), true);
+  BOOST_CHECK_EQUAL(v.type(), tlv::Data);
+  BOOST_CHECK_EQUAL(v.size(), 23);
+  BOOST_CHECK(v.begin() == PACKET);
+  BOOST_CHECK(v.value_begin() == PACKET + 2);
+  BOOST_CHECK_EQUAL(v.value_size(), 21);
+
+  const uint8_t TRUNCATED[] = {0x06, 0x05, 0x07, 0x00};
+  BOOST_CHECK_THROW(BlockView{TRUNCATED}, tlv::Error);
+  BOOST_CHECK_THROW(BlockView{span<const uint8_t>{}}, tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(FromBlock)
+{
+  Block b(PACKET);
+  BlockView v(b);
+  BOOST_CHECK_EQUAL(v.type(), tlv::Data);
+  BOOST_CHECK(v.begin() == b.data());
+  BOOST_CHECK_EQUAL(v.size(), b.size());
+  BOOST_CHECK_EQUAL_COLLECTIONS(v.value_begin(), v.value_end(), b.value_begin(), b.value_end());
+
+  Block valueOnly(tlv::Content, std::make_shared<Buffer>(3));
+  BlockView v2(valueOnly);
+  BOOST_CHECK_EQUAL(v2.type(), tlv::Content);
+  BOOST_CHECK_EQUAL(v2.hasWire(), false);
+  BOOST_CHECK_EQUAL(v2.value_size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(Elements)
+{
+  BlockView v(PACKET);
+  BOOST_CHECK_EQUAL(std::distance(v.elements_begin(), v.elements_end()), 4);
+
+  std::vector<uint32_t> types;
+  for (const BlockView& element : v.elements()) {
+    types.push_back(element.type());
+  }
+  std::vector<uint32_t> expectedTypes{tlv::Name, tlv::MetaInfo, tlv::Content, tlv::SignatureValue};
+  BOOST_CHECK_EQUAL_COLLECTIONS(types.begin(), types.end(), expectedTypes.begin(), expectedTypes.end());
+
+  auto name = v.elements_begin();
+  BOOST_CHECK_EQUAL(std::distance(name->elements_begin(), name->elements_end()), 2);
+  BOOST_CHECK_EQUAL(name->elements_begin()->value_size(), 5);
+
+  BOOST_CHECK_EQUAL(readNonNegativeInteger(v.get(tlv::MetaInfo).get(tlv::FreshnessPeriod)), 10);
+  BOOST_CHECK(v.find(tlv::Content) == std::next(v.elements_begin(), 2));
+  BOOST_CHECK(v.find(tlv::SignatureInfo) == v.elements_end());
+  BOOST_CHECK_EXCEPTION(v.get(tlv::SignatureInfo), Block::Error, [] (const auto& e) {
+    return e.what() == "No sub-element of type 22 found in block of type 6"s;
+  });
+
+  const uint8_t MALFORMED[] = {
+    // TLV-LENGTH of second nested element is greater than TLV-LENGTH of enclosing element
+    0x05, 0x06, 0x08, 0x00, 0x07, 0x07, 0x08, 0x05
+  };
+  BlockView bad(MALFORMED);
+  auto it = bad.elements_begin();
+  BOOST_CHECK_EQUAL(it->type(), 0x08);
+  BOOST_CHECK_EXCEPTION(++it, Block::Error, [] (const auto& e) {
+    return e.what() == "TLV-LENGTH of sub-element of type 7 exceeds TLV-VALUE boundary of parent block"s;
+  });
+}
+
+BOOST_AUTO_TEST_CASE(ToBlock)
+{
+  Block b(PACKET);
+  BlockView v(b);
+  Block metaInfo(b, v.get(tlv::MetaInfo));
+  BOOST_CHECK(metaInfo.getBuffer() == b.getBuffer());
+  BOOST_CHECK_EQUAL(metaInfo.type(), tlv::MetaInfo);
+  BOOST_CHECK_EQUAL(metaInfo.size(), 5);
+  BOOST_CHECK(metaInfo.data() == b.data() + 14);
+  metaInfo.parse();
+  BOOST_CHECK_EQUAL(metaInfo.elements_size(), 1);
+
+  Block other("0600"_block);
+  BOOST_CHECK_THROW(Block(other, v.get(tlv::MetaInfo)), std::invalid_argument);
+  BOOST_CHECK_THROW(Block(b, BlockView()), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBlockView
+BOOST_AUTO_TEST_SUITE_END() // Encoding
+
+} // namespace tests
+} // namespace ndn
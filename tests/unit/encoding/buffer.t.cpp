@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/buffer.hpp"
+#include "ndn-cxx/data.hpp"
+#include "ndn-cxx/encoding/encoding-buffer.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <array>
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Encoding)
+BOOST_AUTO_TEST_SUITE(TestBuffer)
+
+BOOST_AUTO_TEST_CASE(NoInit)
+{
+  Buffer zero(4);
+  BOOST_TEST(zero == Buffer({0, 0, 0, 0}));
+
+  Buffer noInit(4, Buffer::NoInit{});
+  BOOST_CHECK_EQUAL(noInit.size(), 4);
+  BOOST_CHECK_GE(noInit.capacity(), 4);
+
+  Buffer buf{0xAA};
+  buf.resize(3);
+  BOOST_TEST(buf == Buffer({0xAA, 0x00, 0x00}));
+  buf.resize(5, 0xBB);
+  BOOST_TEST(buf == Buffer({0xAA, 0x00, 0x00, 0xBB, 0xBB}));
+  buf.resize(8, Buffer::NoInit{});
+  BOOST_CHECK_EQUAL(buf.size(), 8);
+  BOOST_TEST(Buffer(buf.begin(), buf.begin() + 5) == Buffer({0xAA, 0x00, 0x00, 0xBB, 0xBB}));
+  buf.resize(2, Buffer::NoInit{});
+  BOOST_TEST(buf == Buffer({0xAA, 0x00}));
+
+  // growth is geometric
+  Buffer grown;
+  for (size_t i = 1; i <= 1000; ++i) {
+    grown.resize(i, Buffer::NoInit{});
+    grown.back() = static_cast<uint8_t>(i);
+  }
+  BOOST_CHECK_EQUAL(grown.size(), 1000);
+  BOOST_CHECK_LT(grown.capacity(), 2048);
+  BOOST_CHECK_EQUAL(grown[254], 255);
+}
+
+BOOST_AUTO_TEST_CASE(External)
+{
+  auto memory = std::make_shared<std::array<uint8_t, 5>>();
+  *memory = {0x00, 0x15, 0x02, 0xC0, 0xFF};
+  bool isReleased = false;
+  shared_ptr<const void> owner(memory.get(), [memory, &isReleased] (const void*) mutable {
+    memory.reset();
+    isReleased = true;
+  });
+  const uint8_t* bytes = memory->data();
+
+  auto buf = makeExternalBuffer(*memory, std::move(owner));
+  memory.reset();
+  BOOST_CHECK_EQUAL(buf->size(), 5);
+  BOOST_TEST(*buf == Buffer({0x00, 0x15, 0x02, 0xC0, 0xFF}));
+#ifdef NDN_CXX_BUFFER_HAS_STORAGE_ACCESS
+  BOOST_CHECK(buf->data() == bytes);
+  BOOST_CHECK(isExternalBuffer(buf));
+#endif // NDN_CXX_BUFFER_HAS_STORAGE_ACCESS
+  BOOST_CHECK(!isExternalBuffer(make_shared<const Buffer>(*buf)));
+
+  // a copy does not refer to the external memory
+  Buffer copy(*buf);
+  BOOST_CHECK(copy.data() != buf->data());
+  BOOST_TEST(copy == *buf);
+
+  // usable wherever a ConstBufferPtr is accepted
+  Block block(buf, buf->begin() + 1, buf->end());
+  BOOST_CHECK_EQUAL(block.type(), tlv::Content);
+  BOOST_CHECK(block.data() == buf->data() + 1);
+  Data data("/A");
+  data.setContent(buf);
+  BOOST_CHECK(data.getContent().value() == buf->data());
+
+  // an Encoder does not write into the external memory, even if it has room in front
+  EncodingBuffer encoder(block);
+  encoder.prependVarNumber(0x16);
+  BOOST_TEST(Buffer(encoder.begin(), encoder.end()) == Buffer({0x16, 0x15, 0x02, 0xC0, 0xFF}));
+  BOOST_TEST(*buf == Buffer({0x00, 0x15, 0x02, 0xC0, 0xFF}));
+
+  BOOST_CHECK_EQUAL(isReleased, false);
+  buf.reset();
+  block = {};
+  data = Data();
+  BOOST_CHECK_EQUAL(isReleased, true);
+  static_cast<void>(bytes);
+
+  BOOST_CHECK_EQUAL(makeExternalBuffer({}, nullptr)->size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestBuffer
+BOOST_AUTO_TEST_SUITE_END() // Encoding
+
+} // namespace tests
+} // namespace ndn
@@ -0,0 +1,89 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/face-metrics.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(TestFaceMetrics)
+
+BOOST_AUTO_TEST_CASE(Counter)
+{
+  MetricsCounter counter;
+  BOOST_CHECK_EQUAL(counter, 0);
+  ++counter;
+  counter.add(41);
+  BOOST_CHECK_EQUAL(counter.get(), 42);
+}
+
+BOOST_AUTO_TEST_CASE(BucketIndex)
+{
+  using H = LatencyHistogram;
+  for (uint64_t ns : {0, 1, 31}) {
+    BOOST_CHECK_EQUAL(H::getBucketIndex(ns), ns);
+    BOOST_CHECK_EQUAL(H::getBucketLowerBound(ns), ns);
+  }
+
+  // every bucket covers a contiguous range with bounded relative width
+  for (size_t i = 2 * H::SUB_BUCKET_COUNT; i < H::BUCKET_COUNT - 1; ++i) {
+    uint64_t lower = H::getBucketLowerBound(i);
+    uint64_t next = H::getBucketLowerBound(i + 1);
+    BOOST_REQUIRE_GT(next, lower);
+    BOOST_CHECK_EQUAL(H::getBucketIndex(lower), i);
+    BOOST_CHECK_EQUAL(H::getBucketIndex(next - 1), i);
+    BOOST_CHECK_LE((next - lower) * H::SUB_BUCKET_COUNT, lower);
+  }
+  BOOST_CHECK_EQUAL(H::getBucketIndex(std::numeric_limits<uint64_t>::max()), H::BUCKET_COUNT - 1);
+}
+
+BOOST_AUTO_TEST_CASE(Histogram)
+{
+  LatencyHistogram h;
+  BOOST_CHECK_EQUAL(h.getCount(), 0);
+  BOOST_CHECK_EQUAL(h.getMean(), 0_ns);
+  BOOST_CHECK_EQUAL(h.getPercentile(50), 0_ns);
+
+  for (int i = 1; i <= 100; ++i) {
+    h.record(time::microseconds(i));
+  }
+  h.record(-1_ns);
+  BOOST_CHECK_EQUAL(h.getCount(), 101);
+  BOOST_CHECK_EQUAL(h.getBucketCount(0), 1);
+  BOOST_CHECK_EQUAL(h.getMax(), 100_us);
+  BOOST_CHECK_EQUAL(h.getMean(), 50_us);
+
+  auto p50 = h.getPercentile(50);
+  BOOST_CHECK_GE(p50, 50_us);
+  BOOST_CHECK_LE(p50, 50_us + 50_us / LatencyHistogram::SUB_BUCKET_COUNT);
+  auto p99 = h.getPercentile(99);
+  BOOST_CHECK_GE(p99, 99_us);
+  BOOST_CHECK_LE(p99, 100_us);
+  BOOST_CHECK_EQUAL(h.getPercentile(100), 100_us);
+  BOOST_CHECK_EQUAL(h.getPercentile(0), 0_ns);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestFaceMetrics
+
+} // namespace tests
+} // namespace ndn
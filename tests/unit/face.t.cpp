@@ -32,6 +32,8 @@
 
 #include <boost/logic/tribool.hpp>
 
+#include <thread>
+
 namespace ndn {
 namespace tests {
 
@@ -320,6 +322,86 @@ BOOST_AUTO_TEST_CASE(Handle)
   BOOST_CHECK(true);
 }
 
+BOOST_AUTO_TEST_CASE(Batch)
+{
+  std::vector<Interest> interests{*makeInterest("/A/0", false, 50_ms),
+                                  *makeInterest("/A/1", false, 50_ms),
+                                  *makeInterest("/A/2", false, 50_ms)};
+  std::vector<Name> satisfied;
+  size_t nNacks = 0, nTimeouts = 0;
+  auto hdls = face.expressInterests(interests,
+                                    [&] (const Interest& i, const Data&) { satisfied.push_back(i.getName()); },
+                                    [&] (const Interest&, const lp::Nack&) { ++nNacks; },
+                                    [&] (const Interest&) { ++nTimeouts; });
+  BOOST_REQUIRE_EQUAL(hdls.size(), 3);
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 3);
+  for (size_t i = 0; i < interests.size(); ++i) {
+    BOOST_CHECK_EQUAL(face.sentInterests[i].getName(), interests[i].getName());
+  }
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 3);
+
+  hdls[1].cancel();
+  face.receive(*makeData("/A/2"));
+  face.receive(makeNack(face.sentInterests[0], lp::NackReason::NO_ROUTE));
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(satisfied.size(), 1);
+  BOOST_CHECK_EQUAL(satisfied[0], "/A/2");
+  BOOST_CHECK_EQUAL(nNacks, 1);
+
+  advanceClocks(200_ms, 5);
+  BOOST_CHECK_EQUAL(nTimeouts, 0);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CancelBehindFullBatch)
+{
+  // more Interests than are processed by one drain of the submission queue
+  const size_t nInterests = 300;
+  std::vector<PendingInterestHandle> hdls;
+  for (size_t i = 0; i < nInterests - 1; ++i) {
+    hdls.push_back(face.expressInterest(*makeInterest(Name("/A").appendNumber(i), false, 50_ms),
+                                        nullptr, nullptr, nullptr));
+  }
+  hdls.push_back(face.expressInterest(*makeInterest(Name("/A").appendNumber(nInterests - 1), false, 50_ms),
+                                      bind([] { BOOST_FAIL("Unexpected data"); }),
+                                      bind([] { BOOST_FAIL("Unexpected nack"); }),
+                                      bind([] { BOOST_FAIL("Unexpected timeout"); })));
+  hdls.back().cancel();
+
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), nInterests - 1);
+  BOOST_CHECK(std::none_of(face.sentInterests.begin(), face.sentInterests.end(),
+                           [] (const Interest& i) { return i.getName() == Name("/A").appendNumber(nInterests - 1); }));
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), nInterests - 1);
+
+  face.receive(*makeData(Name("/A").appendNumber(nInterests - 1)));
+  advanceClocks(200_ms, 5);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(CancelAfterSend)
+{
+  auto hdl = face.expressInterest(*makeInterest("/Hello/World", false, 50_ms),
+                                  bind([] { BOOST_FAIL("Unexpected data"); }),
+                                  bind([] { BOOST_FAIL("Unexpected nack"); }),
+                                  bind([] { BOOST_FAIL("Unexpected timeout"); }));
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), 1);
+
+  // the first drain sends 256 Data, the cancellation is processed after the remaining ones
+  for (size_t i = 0; i < 300; ++i) {
+    face.put(*makeData(Name("/B").appendNumber(i)));
+  }
+  hdl.cancel();
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 300);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+
+  face.receive(*makeData("/Hello/World"));
+  advanceClocks(200_ms, 5);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ExpressInterest
 
 BOOST_AUTO_TEST_CASE(RemoveAllPendingInterests)
@@ -365,9 +447,9 @@ BOOST_AUTO_TEST_CASE(PutData)
   advanceClocks(10_ms);
   BOOST_REQUIRE_EQUAL(face.sentData.size(), 2);
   BOOST_CHECK(face.sentData[0].getTag<lp::CachePolicyTag>() == nullptr);
-  BOOST_CHECK(face.sentData[0].getTag<lp::CongestionMarkTag>() == nullptr);
+  BOOST_CHECK(face.sentData[0].getTagValue<lp::CongestionMarkTag>() == nullopt);
   BOOST_CHECK(face.sentData[1].getTag<lp::CachePolicyTag>() != nullptr);
-  BOOST_CHECK(face.sentData[1].getTag<lp::CongestionMarkTag>() != nullptr);
+  BOOST_CHECK(face.sentData[1].getTagValue<lp::CongestionMarkTag>() == 1U);
 }
 
 BOOST_AUTO_TEST_CASE(PutDataLoopback)
@@ -420,6 +502,47 @@ BOOST_AUTO_TEST_CASE(PutMultipleData)
   BOOST_CHECK_EQUAL(face.sentData.size(), 1); // additional Data are ignored
 }
 
+BOOST_AUTO_TEST_CASE(PutDataBatch)
+{
+  std::vector<Data> batch{*makeData("/B/0"), *makeData("/B/1"), *makeData("/B/2")};
+  face.put(batch);
+  BOOST_CHECK_EQUAL(face.sentData.size(), 0);
+
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), 3);
+  for (size_t i = 0; i < batch.size(); ++i) {
+    BOOST_CHECK_EQUAL(face.sentData[i].getName(), batch[i].getName());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(PutDataFromMultipleThreads)
+{
+  const size_t nThreads = 4;
+  const size_t nPerThread = 300; // more than the submission ring can hold
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < nThreads; ++t) {
+    threads.emplace_back([this, t, nPerThread] {
+      for (size_t i = 0; i < nPerThread; ++i) {
+        face.put(*makeData(Name("/T").appendNumber(t).appendNumber(i)));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  advanceClocks(1_ms, 10);
+  BOOST_REQUIRE_EQUAL(face.sentData.size(), nThreads * nPerThread);
+
+  // packets submitted by each thread are sent in submission order
+  std::vector<size_t> nextSeq(nThreads, 0);
+  for (const auto& data : face.sentData) {
+    auto t = data.getName().at(1).toNumber();
+    BOOST_REQUIRE_LT(t, nThreads);
+    BOOST_CHECK_EQUAL(data.getName().at(2).toNumber(), nextSeq[t]++);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(PutNack)
 {
   face.setInterestFilter("/", bind([]{})); // register one Interest destination so that face can accept Nacks
@@ -442,7 +565,7 @@ BOOST_AUTO_TEST_CASE(PutNack)
   advanceClocks(10_ms);
   BOOST_REQUIRE_EQUAL(face.sentNacks.size(), 1);
   BOOST_CHECK_EQUAL(face.sentNacks[0].getReason(), lp::NackReason::DUPLICATE);
-  BOOST_CHECK(face.sentNacks[0].getTag<lp::CongestionMarkTag>() == nullptr);
+  BOOST_CHECK(face.sentNacks[0].getTagValue<lp::CongestionMarkTag>() == nullopt);
 
   auto nack = makeNack(*interest2, lp::NackReason::NO_ROUTE);
   nack.setTag(make_shared<lp::CongestionMarkTag>(1));
@@ -450,7 +573,7 @@ BOOST_AUTO_TEST_CASE(PutNack)
   advanceClocks(10_ms);
   BOOST_REQUIRE_EQUAL(face.sentNacks.size(), 2);
   BOOST_CHECK_EQUAL(face.sentNacks[1].getReason(), lp::NackReason::NO_ROUTE);
-  BOOST_CHECK(face.sentNacks[1].getTag<lp::CongestionMarkTag>() != nullptr);
+  BOOST_CHECK(face.sentNacks[1].getTagValue<lp::CongestionMarkTag>() == 1U);
 }
 
 BOOST_AUTO_TEST_CASE(PutMultipleNack)
@@ -823,6 +946,61 @@ BOOST_AUTO_TEST_CASE(Handle)
 
 BOOST_AUTO_TEST_SUITE_END() // SetInterestFilter
 
+BOOST_AUTO_TEST_CASE(Metrics)
+{
+  const FaceMetrics& metrics = face.getMetrics();
+  BOOST_CHECK_EQUAL(metrics.nOutInterests, 0);
+  BOOST_CHECK_EQUAL(metrics.getSendQueueLength(), 0);
+
+  face.expressInterest(*makeInterest("/A", true, 50_ms), nullptr, nullptr, nullptr);
+  face.expressInterest(*makeInterest("/B", false, 50_ms), nullptr, nullptr, nullptr);
+  face.expressInterest(*makeInterest("/C", false, 50_ms), nullptr, nullptr, nullptr);
+  advanceClocks(10_ms);
+  face.receive(*makeData("/A/1"));
+  face.receive(makeNack(face.sentInterests.at(1), lp::NackReason::NO_ROUTE));
+  advanceClocks(10_ms);
+
+  face.setInterestFilter("/P", [&] (const auto&, const Interest& interest) {
+    face.put(*makeData(interest.getName()));
+  });
+  face.setInterestFilter("/Q", nullptr);
+  advanceClocks(10_ms);
+  face.receive(*makeInterest("/P/1"));
+  face.receive(*makeInterest("/P/2"));
+  face.receive(*makeInterest("/Q", false, nullopt, 1));
+  advanceClocks(10_ms);
+  face.put(makeNack(*makeInterest("/Q", false, nullopt, 1), lp::NackReason::CONGESTION));
+  advanceClocks(50_ms, 2);
+
+  BOOST_CHECK_EQUAL(metrics.nOutInterests, 3);
+  BOOST_CHECK_EQUAL(metrics.nInData, 1);
+  BOOST_CHECK_EQUAL(metrics.nInNacks, 1);
+  BOOST_CHECK_EQUAL(metrics.nInInterests, 3);
+  BOOST_CHECK_EQUAL(metrics.nOutData, 2);
+  BOOST_CHECK_EQUAL(metrics.nOutNacks, 1);
+  BOOST_CHECK_EQUAL(metrics.nTimeouts, 1);
+  BOOST_CHECK_EQUAL(metrics.nOversizedDrops, 0);
+
+  size_t nOutBytes = 0;
+  for (const auto& interest : face.sentInterests) {
+    nOutBytes += interest.wireEncode().size();
+  }
+  for (const auto& data : face.sentData) {
+    nOutBytes += data.wireEncode().size();
+  }
+  BOOST_CHECK_GT(metrics.nOutBytes, nOutBytes); // the Nack has an NDNLP header
+  BOOST_CHECK_GT(metrics.nInBytes, 0);
+
+  BOOST_CHECK_EQUAL(metrics.interestDataLatency.getCount(), 1);
+  BOOST_CHECK_LE(metrics.interestDataLatency.getMax(), 10_ms);
+
+  auto tooLarge = makeData("/too-large");
+  tooLarge->setContent(std::make_shared<Buffer>(MAX_NDN_PACKET_SIZE));
+  face.put(*tooLarge);
+  BOOST_CHECK_THROW(advanceClocks(1_ms), Face::OversizedPacketError);
+  BOOST_CHECK_EQUAL(metrics.nOversizedDrops, 1);
+}
+
 BOOST_AUTO_TEST_CASE(ProcessEvents)
 {
   face.processEvents(time::milliseconds(-1)); // io_service::reset()/poll() inside
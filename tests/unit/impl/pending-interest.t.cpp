@@ -0,0 +1,147 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/pending-interest.hpp"
+
+#include "tests/boost-test.hpp"
+#include "tests/unit/io-fixture.hpp"
+
+namespace ndn {
+namespace tests {
+
+class PendingInterestTimerFixture : public IoFixture
+{
+protected:
+  PendingInterest&
+  addInterest(const Name& name, time::milliseconds lifetime,
+              PendingInterestOrigin origin = PendingInterestOrigin::APP)
+  {
+    auto interest = make_shared<Interest>(name);
+    interest->setInterestLifetime(lifetime);
+    if (origin == PendingInterestOrigin::FORWARDER) {
+      return pit.insert(std::move(interest), timer);
+    }
+
+    PendingInterestCallbacks callbacks;
+    callbacks.afterTimeout = [this] (const Interest& i) { timedOut.push_back(i.getName()); };
+    return pit.insert(std::move(interest), std::move(callbacks), timer);
+  }
+
+protected:
+  Scheduler scheduler{m_io};
+  MetricsCounter nTimeouts;
+  PendingInterestTimer timer{scheduler, nTimeouts};
+  detail::RecordContainer<PendingInterest> pit;
+  std::vector<Name> timedOut;
+};
+
+BOOST_AUTO_TEST_SUITE(Impl)
+BOOST_FIXTURE_TEST_SUITE(TestPendingInterestTimer, PendingInterestTimerFixture)
+
+BOOST_AUTO_TEST_CASE(ExpiryOrder)
+{
+  addInterest("/A", 300_ms);
+  addInterest("/B", 100_ms);
+  addInterest("/C", 200_ms);
+  addInterest("/D", 100_ms);
+  BOOST_CHECK_EQUAL(pit.size(), 4);
+
+  advanceClocks(10_ms, 15);
+  // records with the same expiry time time out in insertion order
+  BOOST_TEST(timedOut == (std::vector<Name>{"/B", "/D"}), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(pit.size(), 2);
+
+  advanceClocks(10_ms, 20);
+  BOOST_TEST(timedOut == (std::vector<Name>{"/B", "/D", "/C", "/A"}), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(nTimeouts, 4);
+  BOOST_CHECK(pit.empty());
+}
+
+BOOST_AUTO_TEST_CASE(EarlierExpiryAddedLater)
+{
+  addInterest("/A", 1_s);
+  advanceClocks(10_ms, 10);
+  // the Scheduler event must be moved earlier
+  addInterest("/B", 100_ms);
+
+  advanceClocks(10_ms, 11);
+  BOOST_TEST(timedOut == (std::vector<Name>{"/B"}), boost::test_tools::per_element());
+
+  advanceClocks(10_ms, 80);
+  BOOST_TEST(timedOut == (std::vector<Name>{"/B", "/A"}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Cancel)
+{
+  detail::RecordId a = addInterest("/A", 100_ms).getId();
+  addInterest("/B", 200_ms);
+  detail::RecordId c = addInterest("/C", 300_ms).getId();
+
+  // erasing a record removes it from the timer, including the earliest one
+  pit.erase(a);
+  pit.erase(c);
+  advanceClocks(10_ms, 35);
+  BOOST_TEST(timedOut == (std::vector<Name>{"/B"}), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(nTimeouts, 1);
+
+  // cancel the pending Scheduler event once all records are gone
+  detail::RecordId d = addInterest("/D", 100_ms).getId();
+  pit.erase(d);
+  timer.cancel();
+  advanceClocks(10_ms, 20);
+  BOOST_CHECK_EQUAL(timedOut.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(ForwarderOrigin)
+{
+  addInterest("/A", 100_ms, PendingInterestOrigin::FORWARDER);
+  addInterest("/B", 200_ms);
+
+  advanceClocks(10_ms, 25);
+  // the record from the forwarder is removed, but not counted as a timeout of the application
+  BOOST_CHECK(pit.empty());
+  BOOST_TEST(timedOut == (std::vector<Name>{"/B"}), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(nTimeouts, 1);
+}
+
+BOOST_AUTO_TEST_CASE(SharedCallbacks)
+{
+  // callbacks of a Face::expressInterests batch are shared by its records
+  shared_ptr<const PendingInterestCallbacks> callbacks = make_shared<PendingInterestCallbacks>(
+    PendingInterestCallbacks{nullptr, nullptr,
+                             [this] (const Interest& i) { timedOut.push_back(i.getName()); }});
+  for (const char* name : {"/A", "/B"}) {
+    auto interest = make_shared<Interest>(name);
+    interest->setInterestLifetime(100_ms);
+    pit.insert(std::move(interest), callbacks, timer);
+  }
+  BOOST_CHECK_EQUAL(callbacks.use_count(), 3);
+
+  advanceClocks(10_ms, 15);
+  BOOST_TEST(timedOut == (std::vector<Name>{"/A", "/B"}), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(callbacks.use_count(), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestPendingInterestTimer
+BOOST_AUTO_TEST_SUITE_END() // Impl
+
+} // namespace tests
+} // namespace ndn
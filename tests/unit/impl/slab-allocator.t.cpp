@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/slab-allocator.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <cstring>
+#include <map>
+#include <set>
+
+namespace ndn {
+namespace detail {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Impl)
+BOOST_AUTO_TEST_SUITE(TestSlabAllocator)
+
+BOOST_AUTO_TEST_CASE(Reuse)
+{
+  SlabArena arena(4);
+  void* p1 = arena.allocate(40);
+  void* p2 = arena.allocate(40);
+  BOOST_CHECK_NE(p1, p2);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 1);
+
+  // the most recently freed block is reused first
+  arena.deallocate(p1, 40);
+  BOOST_CHECK_EQUAL(arena.allocate(40), p1);
+  arena.deallocate(p2, 40);
+  arena.deallocate(p1, 40);
+  BOOST_CHECK_EQUAL(arena.allocate(40), p1);
+  BOOST_CHECK_EQUAL(arena.allocate(40), p2);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 1);
+
+  // sizes that round up to the same block size share a pool
+  arena.deallocate(p1, 40);
+  BOOST_CHECK_EQUAL(arena.allocate(33), p1);
+}
+
+BOOST_AUTO_TEST_CASE(Growth)
+{
+  SlabArena arena(4);
+  std::set<char*> blocks;
+  for (int i = 0; i < 9; ++i) {
+    auto p = static_cast<char*>(arena.allocate(64));
+    // blocks must not overlap
+    auto next = blocks.lower_bound(p);
+    BOOST_CHECK(next == blocks.end() || *next >= p + 64);
+    BOOST_CHECK(next == blocks.begin() || *std::prev(next) + 64 <= p);
+    blocks.insert(p);
+    std::memset(p, 0xFF, 64);
+  }
+  BOOST_CHECK_EQUAL(blocks.size(), 9);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 3);
+
+  // slabs are kept after the blocks are freed, and reused without growing
+  for (char* p : blocks) {
+    arena.deallocate(p, 64);
+  }
+  for (int i = 0; i < 9; ++i) {
+    BOOST_CHECK_EQUAL(blocks.count(static_cast<char*>(arena.allocate(64))), 1);
+  }
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 3);
+
+  // another block size has its own slabs
+  arena.allocate(128);
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(Container)
+{
+  SlabArena arena(16);
+  using Allocator = SlabAllocator<std::pair<const int, std::string>>;
+  std::map<int, std::string, std::less<int>, Allocator> map{Allocator(arena)};
+
+  for (int i = 0; i < 100; ++i) {
+    map.emplace(i, to_string(i));
+  }
+  size_t nSlabs = arena.getNSlabs();
+  BOOST_CHECK_GE(nSlabs, 100 / 16);
+
+  for (int i = 0; i < 100; i += 2) {
+    map.erase(i);
+  }
+  for (int i = 100; i < 150; ++i) {
+    map.emplace(i, to_string(i));
+  }
+  BOOST_CHECK_EQUAL(map.size(), 100);
+  BOOST_CHECK_EQUAL(map.at(149), "149");
+  BOOST_CHECK_EQUAL(arena.getNSlabs(), nSlabs);
+
+  SlabArena arena2;
+  BOOST_CHECK(Allocator(arena) == SlabAllocator<int>(arena));
+  BOOST_CHECK(Allocator(arena) != Allocator(arena2));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSlabAllocator
+BOOST_AUTO_TEST_SUITE_END() // Impl
+
+} // namespace tests
+} // namespace detail
+} // namespace ndn
@@ -0,0 +1,94 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/impl/submission-queue.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace ndn {
+namespace detail {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Impl)
+BOOST_AUTO_TEST_SUITE(TestSubmissionQueue)
+
+BOOST_AUTO_TEST_CASE(SingleThread)
+{
+  SubmissionQueue<int> queue(4);
+  // the last three items spill into the overflow list
+  for (int i = 0; i < 7; ++i) {
+    queue.push(int(i));
+  }
+
+  std::vector<int> items;
+  BOOST_CHECK_EQUAL(queue.drain(5, [&] (int item) { items.push_back(item); }), 5);
+  queue.push(7);
+  BOOST_CHECK_EQUAL(queue.drain(100, [&] (int item) { items.push_back(item); }), 3);
+  BOOST_CHECK_EQUAL(queue.drain(100, [&] (int item) { items.push_back(item); }), 0);
+  BOOST_TEST(items == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(PerProducerOrder)
+{
+  const int N_PRODUCERS = 4;
+  const int N_ITEMS = 20000;
+
+  // a tiny ring makes producers race for cells and spill into the overflow list
+  SubmissionQueue<std::pair<int, int>> queue(2);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < N_PRODUCERS; ++p) {
+    producers.emplace_back([&queue, p] {
+      for (int i = 0; i < N_ITEMS; ++i) {
+        queue.push({p, i});
+      }
+    });
+  }
+
+  std::vector<int> nextItem(N_PRODUCERS, 0);
+  int nReceived = 0;
+  int nOutOfOrder = 0;
+  while (nReceived < N_PRODUCERS * N_ITEMS) {
+    // drain() may return early while a producer is writing into a cell; just try again
+    nReceived += queue.drain(64, [&] (const std::pair<int, int>& item) {
+      if (item.second != nextItem[item.first]) {
+        ++nOutOfOrder;
+      }
+      nextItem[item.first] = item.second + 1;
+    });
+  }
+  for (auto& t : producers) {
+    t.join();
+  }
+
+  BOOST_CHECK_EQUAL(nOutOfOrder, 0);
+  BOOST_TEST(nextItem == std::vector<int>(N_PRODUCERS, N_ITEMS), boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(queue.drain(64, [] (const std::pair<int, int>&) {}), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSubmissionQueue
+BOOST_AUTO_TEST_SUITE_END() // Impl
+
+} // namespace tests
+} // namespace detail
+} // namespace ndn
@@ -203,6 +203,49 @@ BOOST_AUTO_TEST_CASE(Print)
                     "         )");
 }
 
+BOOST_AUTO_TEST_CASE(View)
+{
+  FibEntry entry = makeFibEntry();
+  const Block& wire = entry.wireEncode();
+
+  FibEntryView view(wire);
+  BOOST_CHECK_EQUAL(view.getPrefix(), "/this/is/a/test");
+  BOOST_CHECK_EQUAL(view.getPrefixWire().type(), tlv::Name);
+  BOOST_CHECK(view.getPrefixWire().begin() == wire.value());
+  BOOST_CHECK(view.wireEncode() == wire);
+  BOOST_CHECK_EQUAL(view.decode(), entry);
+
+  std::vector<NextHopRecord> nexthops;
+  view.forEachNextHop([&] (const NextHopRecord& nh) { nexthops.push_back(nh); });
+  BOOST_CHECK_EQUAL_COLLECTIONS(nexthops.begin(), nexthops.end(),
+                                entry.getNextHopRecords().begin(), entry.getNextHopRecords().end());
+
+  // no next hops
+  FibEntryView view2(FibEntry().setPrefix("/A").wireEncode());
+  BOOST_CHECK_EQUAL(view2.getPrefix(), "/A");
+  view2.forEachNextHop([] (const NextHopRecord&) { BOOST_ERROR("unexpected next hop"); });
+}
+
+BOOST_AUTO_TEST_CASE(ViewDecodeError)
+{
+  // not a FibEntry
+  BOOST_CHECK_THROW(FibEntryView(Name("/A").wireEncode()), tlv::Error);
+
+  // missing Name
+  static const uint8_t noName[] = {0x80, 0x00};
+  BOOST_CHECK_THROW(FibEntryView(Block(noName)), tlv::Error);
+
+  // NextHopRecord without Cost
+  static const uint8_t noCost[] = {
+    0x80, 0x0a,
+          0x07, 0x03, 0x08, 0x01, 0x41,
+          0x81, 0x03, 0x69, 0x01, 0x0a,
+  };
+  FibEntryView view(Block{noCost});
+  BOOST_CHECK_EQUAL(view.getPrefix(), "/A");
+  BOOST_CHECK_THROW(view.forEachNextHop([] (const NextHopRecord&) {}), tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestFibEntry
 BOOST_AUTO_TEST_SUITE_END() // Nfd
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
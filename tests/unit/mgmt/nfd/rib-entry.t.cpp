@@ -231,6 +231,49 @@ BOOST_AUTO_TEST_CASE(Print)
                     "         )");
 }
 
+BOOST_AUTO_TEST_CASE(View)
+{
+  RibEntry entry = makeRibEntry();
+  entry.addRoute(makeRoute().setFaceId(2).setOrigin(ROUTE_ORIGIN_STATIC));
+  const Block& wire = entry.wireEncode();
+
+  RibEntryView view(wire);
+  BOOST_CHECK_EQUAL(view.getName(), "/hello/world");
+  BOOST_CHECK_EQUAL(view.getNameWire().type(), tlv::Name);
+  BOOST_CHECK(view.getNameWire().begin() == wire.value());
+  BOOST_CHECK(view.wireEncode() == wire);
+  BOOST_CHECK_EQUAL(view.decode(), entry);
+
+  std::vector<Route> routes;
+  view.forEachRoute([&] (const Route& route) { routes.push_back(route); });
+  BOOST_CHECK_EQUAL_COLLECTIONS(routes.begin(), routes.end(),
+                                entry.getRoutes().begin(), entry.getRoutes().end());
+  BOOST_REQUIRE_EQUAL(routes.size(), 2);
+  BOOST_CHECK(routes[0].hasExpirationPeriod());
+  BOOST_CHECK(!routes[1].hasExpirationPeriod());
+}
+
+BOOST_AUTO_TEST_CASE(ViewDecodeError)
+{
+  // not a RibEntry
+  BOOST_CHECK_THROW(RibEntryView(Name("/A").wireEncode()), tlv::Error);
+
+  // missing Name
+  static const uint8_t noName[] = {0x80, 0x00};
+  BOOST_CHECK_THROW(RibEntryView(Block(noName)), tlv::Error);
+
+  // Route with Origin too large
+  static const uint8_t badOrigin[] = {
+    0x80, 0x16,
+          0x07, 0x03, 0x08, 0x01, 0x41,
+          0x81, 0x0f, 0x69, 0x01, 0x01, 0x6f, 0x04, 0x00, 0x01, 0x00, 0x00,
+                      0x6a, 0x01, 0x00, 0x6c, 0x01, 0x00,
+  };
+  RibEntryView view(Block{badOrigin});
+  BOOST_CHECK_EQUAL(view.getName(), "/A");
+  BOOST_CHECK_THROW(view.forEachRoute([] (const Route&) {}), tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestRibEntry
 BOOST_AUTO_TEST_SUITE_END() // Nfd
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
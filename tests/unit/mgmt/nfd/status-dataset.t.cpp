@@ -79,6 +79,25 @@ protected:
     face.receive(*signData(data));
   }
 
+  /** \brief Send a payload as Data replies of at most \p segmentSize octets each.
+   *  \param prefix dataset prefix without version and segment
+   */
+  void
+  sendSegmentedDataset(const Name& prefix, span<const uint8_t> payload, size_t segmentSize)
+  {
+    Name versionedName = Name(prefix).appendVersion();
+    uint64_t lastSegment = (payload.size() - 1) / segmentSize;
+    for (uint64_t seg = 0; seg <= lastSegment; ++seg) {
+      auto data = make_shared<Data>(Name(versionedName).appendSegment(seg));
+      data->setFreshnessPeriod(1_s);
+      data->setFinalBlock(name::Component::fromSegment(lastSegment));
+      size_t offset = seg * segmentSize;
+      data->setContent(payload.subspan(offset, std::min(segmentSize, payload.size() - offset)));
+      face.receive(*signData(data));
+      this->advanceClocks(1_ms);
+    }
+  }
+
 private:
   shared_ptr<Data>
   prepareDatasetReply(const Name& prefix)
@@ -480,7 +499,308 @@ BOOST_AUTO_TEST_CASE(RibListWithOptions)
 
 BOOST_AUTO_TEST_SUITE_END() // Datasets
 
+BOOST_AUTO_TEST_SUITE(Entries)
+
+BOOST_AUTO_TEST_CASE(FibList)
+{
+  std::vector<Name> prefixes;
+  std::vector<NextHopRecord> nexthops;
+  bool hasResult = false;
+  controller.fetch<FibDataset>(
+    [&] (const FibEntryView& entry) {
+      prefixes.push_back(entry.getPrefix());
+      entry.forEachNextHop([&] (const NextHopRecord& nh) { nexthops.push_back(nh); });
+      return true;
+    },
+    [&hasResult] { hasResult = true; },
+    datasetFailCallback);
+  this->advanceClocks(500_ms);
+
+  FibEntry payload1;
+  payload1.setPrefix("/wYs7fzYcfG");
+  payload1.addNextHopRecord(NextHopRecord().setFaceId(262).setCost(10));
+  FibEntry payload2;
+  payload2.setPrefix("/LKvmnzY5S");
+  this->sendDataset("/localhost/nfd/fib/list", payload1, payload2);
+  this->advanceClocks(500_ms);
+
+  BOOST_CHECK(hasResult);
+  BOOST_CHECK_EQUAL(failCodes.size(), 0);
+  BOOST_CHECK_EQUAL(controller.m_fetchers.size(), 0);
+  BOOST_REQUIRE_EQUAL(prefixes.size(), 2);
+  BOOST_CHECK_EQUAL(prefixes[0], "/wYs7fzYcfG");
+  BOOST_CHECK_EQUAL(prefixes[1], "/LKvmnzY5S");
+  BOOST_REQUIRE_EQUAL(nexthops.size(), 1);
+  BOOST_CHECK_EQUAL(nexthops[0].getFaceId(), 262);
+}
+
+BOOST_AUTO_TEST_CASE(RibListSegmented)
+{
+  std::vector<RibEntry> entries;
+  bool hasResult = false;
+  controller.fetch<RibDataset>(
+    [&] (const RibEntryView& entry) {
+      // entries of a dataset do not arrive before the previous ones have been delivered
+      BOOST_CHECK(!hasResult);
+      entries.push_back(entry.decode());
+      return true;
+    },
+    [&hasResult] { hasResult = true; },
+    datasetFailCallback);
+  this->advanceClocks(500_ms);
+
+  std::vector<RibEntry> expected;
+  EncodingBuffer buffer;
+  for (int i = 0; i < 5; ++i) {
+    expected.push_back(RibEntry()
+                       .setName(Name("/rib").appendNumber(i))
+                       .addRoute(Route().setFaceId(300 + i).setOrigin(ROUTE_ORIGIN_CLIENT)));
+  }
+  for (auto it = expected.rbegin(); it != expected.rend(); ++it) {
+    it->wireEncode(buffer);
+  }
+  // the entries and their headers are split across segments
+  this->sendSegmentedDataset("/localhost/nfd/rib/list", buffer, 7);
+  this->advanceClocks(500_ms);
+
+  BOOST_CHECK(hasResult);
+  BOOST_CHECK_EQUAL(failCodes.size(), 0);
+  BOOST_CHECK_EQUAL_COLLECTIONS(entries.begin(), entries.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(FaceQuery)
+{
+  FaceQueryFilter filter;
+  filter.setUriScheme("udp4");
+  std::vector<uint64_t> faceIds;
+  bool hasResult = false;
+  controller.fetch<FaceQueryDataset>(
+    filter,
+    [&faceIds] (const FaceStatus& entry) {
+      faceIds.push_back(entry.getFaceId());
+      return true;
+    },
+    [&hasResult] { hasResult = true; },
+    datasetFailCallback);
+  this->advanceClocks(500_ms);
+
+  Name prefix("/localhost/nfd/faces/query");
+  prefix.append(filter.wireEncode());
+  FaceStatus payload;
+  payload.setFaceId(8795);
+  this->sendDataset(prefix, payload);
+  this->advanceClocks(500_ms);
+
+  BOOST_CHECK(hasResult);
+  BOOST_CHECK_EQUAL(failCodes.size(), 0);
+  BOOST_REQUIRE_EQUAL(faceIds.size(), 1);
+  BOOST_CHECK_EQUAL(faceIds[0], 8795);
+}
+
+BOOST_AUTO_TEST_CASE(StopEarly)
+{
+  int nEntries = 0;
+  controller.fetch<StrategyChoiceDataset>(
+    [&nEntries] (const StrategyChoice&) {
+      ++nEntries;
+      return false;
+    },
+    [] { BOOST_FAIL("fetchDataset should not succeed"); },
+    datasetFailCallback);
+  this->advanceClocks(500_ms);
+
+  StrategyChoice payload1;
+  payload1.setName("/8MLz6N3B");
+  StrategyChoice payload2;
+  payload2.setName("/svqcBu0YwU");
+  this->sendDataset("/localhost/nfd/strategy-choice/list", payload1, payload2);
+  this->advanceClocks(500_ms);
+
+  BOOST_CHECK_EQUAL(nEntries, 1);
+  BOOST_CHECK_EQUAL(failCodes.size(), 0);
+  BOOST_CHECK_EQUAL(controller.m_fetchers.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(ParseError)
+{
+  int nEntries = 0;
+  controller.fetch<ChannelDataset>(
+    [&nEntries] (const ChannelStatus&) {
+      ++nEntries;
+      return true;
+    },
+    [] { BOOST_FAIL("fetchDataset should not succeed"); },
+    datasetFailCallback);
+  this->advanceClocks(500_ms);
+
+  ChannelStatus payload1;
+  payload1.setLocalUri("tcp4://192.0.2.1:6363");
+  Name payload2; // Name is not valid ChannelStatus
+  this->sendDataset("/localhost/nfd/faces/channels", payload1, payload2);
+  this->advanceClocks(500_ms);
+
+  BOOST_CHECK_EQUAL(nEntries, 1);
+  BOOST_REQUIRE_EQUAL(failCodes.size(), 1);
+  BOOST_CHECK_EQUAL(failCodes.back(), Controller::ERROR_SERVER);
+  BOOST_CHECK_EQUAL(controller.m_fetchers.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Truncated)
+{
+  controller.fetch<FibDataset>(
+    [] (const FibEntryView&) { return true; },
+    [] { BOOST_FAIL("fetchDataset should not succeed"); },
+    datasetFailCallback);
+  this->advanceClocks(500_ms);
+
+  Block wire = FibEntry().setPrefix("/wYs7fzYcfG").wireEncode();
+  this->sendSegmentedDataset("/localhost/nfd/fib/list",
+                             make_span(wire.data(), wire.size() - 1), 100);
+  this->advanceClocks(500_ms);
+
+  BOOST_REQUIRE_EQUAL(failCodes.size(), 1);
+  BOOST_CHECK_EQUAL(failCodes.back(), Controller::ERROR_SERVER);
+  BOOST_CHECK_EQUAL(controller.m_fetchers.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(Timeout)
+{
+  CommandOptions options;
+  options.setTimeout(3000_ms);
+  controller.fetch<FaceDataset>(
+    [] (const FaceStatus&) { return true; },
+    [] { BOOST_FAIL("fetchDataset should not succeed"); },
+    datasetFailCallback,
+    options);
+  this->advanceClocks(500_ms);
+  BOOST_CHECK_EQUAL(controller.m_fetchers.size(), 1);
+
+  this->advanceClocks(500_ms, 6);
+  BOOST_CHECK_EQUAL(controller.m_fetchers.size(), 0);
+  BOOST_REQUIRE_EQUAL(failCodes.size(), 1);
+  BOOST_CHECK_EQUAL(failCodes.back(), Controller::ERROR_TIMEOUT);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Entries
+
 BOOST_AUTO_TEST_SUITE_END() // TestStatusDataset
+
+BOOST_AUTO_TEST_SUITE(TestStatusDatasetParser)
+
+static std::vector<Block>
+makeParserEntries()
+{
+  return {
+    makeStringBlock(tlv::GenericNameComponent, "udp4://192.0.2.1:6363"),
+    makeBinaryBlock(tlv::Content, std::vector<uint8_t>(300, 0xEE)), // 3-octet TLV-LENGTH
+    makeNonNegativeIntegerBlock(0x2F1A, 12345), // 3-octet TLV-TYPE
+    makeEmptyBlock(tlv::MustBeFresh),
+  };
+}
+
+static Buffer
+concatenate(const std::vector<Block>& blocks)
+{
+  Buffer payload;
+  for (const auto& block : blocks) {
+    payload.insert(payload.end(), block.begin(), block.end());
+  }
+  return payload;
+}
+
+BOOST_AUTO_TEST_CASE(SinglePiece)
+{
+  auto expected = makeParserEntries();
+  auto payload = make_shared<const Buffer>(concatenate(expected));
+
+  std::vector<Block> entries;
+  StatusDatasetParser parser([&] (const Block& entry) {
+    // the entry shares the buffer of the piece
+    BOOST_CHECK(entry.data() >= payload->data());
+    BOOST_CHECK(entry.data() + entry.size() <= payload->data() + payload->size());
+    entries.push_back(entry);
+    return true;
+  });
+  BOOST_CHECK_EQUAL(parser.parse(payload), true);
+  BOOST_CHECK_NO_THROW(parser.finish());
+  BOOST_CHECK_EQUAL_COLLECTIONS(entries.begin(), entries.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(SplitPieces)
+{
+  auto expected = makeParserEntries();
+  auto payload = concatenate(expected);
+
+  for (size_t split = 0; split <= payload.size(); ++split) {
+    BOOST_TEST_CONTEXT("split at " << split) {
+      std::vector<Block> entries;
+      StatusDatasetParser parser([&] (const Block& entry) {
+        entries.push_back(entry);
+        return true;
+      });
+      BOOST_CHECK(parser.parse(make_shared<const Buffer>(payload.begin(), payload.begin() + split)));
+      BOOST_CHECK(parser.parse(make_shared<const Buffer>(payload.begin() + split, payload.end())));
+      BOOST_CHECK_NO_THROW(parser.finish());
+      BOOST_CHECK_EQUAL_COLLECTIONS(entries.begin(), entries.end(), expected.begin(), expected.end());
+    }
+  }
+
+  // one octet at a time
+  std::vector<Block> entries;
+  StatusDatasetParser parser([&] (const Block& entry) {
+    entries.push_back(entry);
+    return true;
+  });
+  for (uint8_t octet : payload) {
+    BOOST_CHECK(parser.parse(make_shared<const Buffer>(Buffer{octet})));
+  }
+  BOOST_CHECK_NO_THROW(parser.finish());
+  BOOST_CHECK_EQUAL_COLLECTIONS(entries.begin(), entries.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(Stop)
+{
+  auto entries = makeParserEntries();
+  auto payload = concatenate(entries);
+  // the second piece starts in the middle of the third entry
+  size_t half = entries[0].size() + entries[1].size() + 2;
+
+  int nEntries = 0;
+  StatusDatasetParser parser([&] (const Block&) {
+    return ++nEntries < 2;
+  });
+  BOOST_CHECK_EQUAL(parser.parse(make_shared<const Buffer>(payload.begin(), payload.begin() + half)),
+                    false);
+  BOOST_CHECK_EQUAL(parser.parse(make_shared<const Buffer>(payload.begin() + half, payload.end())),
+                    false);
+  BOOST_CHECK_EQUAL(nEntries, 2);
+  BOOST_CHECK_NO_THROW(parser.finish());
+}
+
+BOOST_AUTO_TEST_CASE(Truncated)
+{
+  auto payload = concatenate(makeParserEntries());
+
+  int nEntries = 0;
+  StatusDatasetParser parser([&] (const Block&) {
+    ++nEntries;
+    return true;
+  });
+  BOOST_CHECK(parser.parse(make_shared<const Buffer>(payload.begin(), payload.end() - 1)));
+  BOOST_CHECK_EQUAL(nEntries, 3);
+  BOOST_CHECK_THROW(parser.finish(), StatusDataset::ParseResultError);
+}
+
+BOOST_AUTO_TEST_CASE(Malformed)
+{
+  StatusDatasetParser parser([] (const Block&) {
+    BOOST_ERROR("unexpected entry");
+    return true;
+  });
+  BOOST_CHECK_THROW(parser.parse(make_shared<const Buffer>(Buffer{0x00, 0x01, 0x00})), tlv::Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestStatusDatasetParser
 BOOST_AUTO_TEST_SUITE_END() // Nfd
 BOOST_AUTO_TEST_SUITE_END() // Mgmt
 
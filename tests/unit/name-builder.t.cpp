@@ -0,0 +1,183 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/name-builder.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace ndn {
+namespace tests {
+
+using Component = name::Component;
+
+BOOST_AUTO_TEST_SUITE(TestNameBuilder)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  NameBuilder builder;
+  BOOST_CHECK(builder.empty());
+  BOOST_CHECK_EQUAL(builder.size(), 0);
+  BOOST_CHECK_EQUAL(builder.build().wireEncode(), "0700"_block);
+
+  NameBuilder fromEmpty(Name{});
+  BOOST_CHECK_EQUAL(fromEmpty.build().wireEncode(), "0700"_block);
+}
+
+BOOST_AUTO_TEST_CASE(AppendComponent)
+{
+  NameBuilder builder;
+  builder.append(Component("Emid"))
+         .append(25042, {'P', '3'})
+         .append("xKh")
+         .append(PartialName("/6=C/D"));
+  BOOST_CHECK_EQUAL(builder.size(), 5);
+
+  Name name = builder.build();
+  BOOST_CHECK(name.hasWire());
+  BOOST_CHECK_EQUAL(name.size(), 5);
+  BOOST_CHECK_EQUAL(name.wireEncode(), "0717 0804456D6964 FD61D2025033 0803784B68 060143 080144"_block);
+  BOOST_CHECK_EQUAL(name, Name("/Emid/25042=P3/xKh/6=C/D"));
+
+  BOOST_CHECK_THROW(builder.append(0, {'A'}), Component::Error);
+  BOOST_CHECK_THROW(builder.append(65536, {'A'}), Component::Error);
+  BOOST_CHECK_THROW(builder.appendImplicitSha256Digest(std::vector<uint8_t>(31)), Component::Error);
+  BOOST_CHECK_THROW(builder.appendParametersSha256Digest(std::vector<uint8_t>(33)), Component::Error);
+  BOOST_CHECK_EQUAL(builder.size(), 5);
+  BOOST_CHECK_EQUAL(builder.build(), name);
+}
+
+BOOST_AUTO_TEST_CASE(AppendNumber)
+{
+  NameBuilder builder;
+  builder.appendNumber(0)
+         .appendNumber(0x1234)
+         .appendNumberWithMarker(0xAA, 0x567890)
+         .appendImplicitSha256Digest(std::vector<uint8_t>(32, 0x01));
+
+  Name expected;
+  expected.appendNumber(0)
+          .appendNumber(0x1234)
+          .appendNumberWithMarker(0xAA, 0x567890)
+          .appendImplicitSha256Digest(std::vector<uint8_t>(32, 0x01));
+  BOOST_CHECK_EQUAL(builder.build().wireEncode(), expected.wireEncode());
+}
+
+BOOST_AUTO_TEST_CASE(AppendLong)
+{
+  // TLV-LENGTH of both the components and the name need more than one octet
+  std::vector<uint8_t> value(300, 'x');
+  NameBuilder builder(8);
+  Name expected;
+  for (int i = 0; i < 3; ++i) {
+    builder.append(value);
+    expected.append(value);
+    BOOST_CHECK_EQUAL(builder.build().wireEncode(), expected.wireEncode());
+  }
+}
+
+class ConventionMarker
+{
+public:
+  ConventionMarker()
+  {
+    name::setConventionEncoding(name::Convention::MARKER);
+  }
+
+  ~ConventionMarker()
+  {
+    name::setConventionEncoding(name::Convention::TYPED);
+  }
+};
+
+class ConventionTyped
+{
+};
+
+using Conventions = boost::mpl::vector<ConventionTyped, ConventionMarker>;
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(AppendConvention, Convention, Conventions, Convention)
+{
+  auto timestamp = time::getUnixEpoch() + time::microseconds(1234567890123456);
+
+  NameBuilder builder(Name("/P"));
+  builder.appendSegment(10)
+         .appendByteOffset(0xFFFF)
+         .appendVersion(1)
+         .appendTimestamp(timestamp)
+         .appendSequenceNumber(std::numeric_limits<uint64_t>::max());
+
+  Name expected("/P");
+  expected.appendSegment(10)
+          .appendByteOffset(0xFFFF)
+          .appendVersion(1)
+          .appendTimestamp(timestamp)
+          .appendSequenceNumber(std::numeric_limits<uint64_t>::max());
+  BOOST_CHECK_EQUAL(builder.build().wireEncode(), expected.wireEncode());
+
+  Name name = NameBuilder().appendVersion().appendTimestamp().build();
+  BOOST_CHECK(name[0].isVersion());
+  BOOST_CHECK(name[1].isTimestamp());
+}
+
+BOOST_AUTO_TEST_CASE(BuiltNameIsStable)
+{
+  NameBuilder builder;
+  builder.append("A");
+  Name a = builder.build();
+  builder.append("B");
+  Name ab = builder.build();
+  builder.append(std::vector<uint8_t>(1000, 'x')); // reallocates
+  Name abx = builder.build();
+
+  BOOST_CHECK_EQUAL(a.wireEncode(), "0703 080141"_block);
+  BOOST_CHECK_EQUAL(ab.wireEncode(), "0706 080141 080142"_block);
+  BOOST_CHECK_EQUAL(abx.size(), 3);
+  BOOST_CHECK_EQUAL(abx.getPrefix(2), ab);
+}
+
+BOOST_AUTO_TEST_CASE(Derive)
+{
+  NameBuilder prefix(Name("/A/B"));
+  Name prefixName = prefix.build();
+
+  NameBuilder copy1(prefix);
+  NameBuilder copy2(prefix);
+  Name name1 = copy1.appendSegment(1).build();
+  Name name2 = copy2.appendSegment(2).append("C").build();
+  Name name3 = NameBuilder(prefix).appendSegment(3).build();
+
+  BOOST_CHECK_EQUAL(prefix.size(), 2);
+  BOOST_CHECK_EQUAL(prefix.build(), prefixName);
+  BOOST_CHECK_EQUAL(prefixName, Name("/A/B"));
+  BOOST_CHECK_EQUAL(name1, Name("/A/B").appendSegment(1));
+  BOOST_CHECK_EQUAL(name2, Name("/A/B").appendSegment(2).append("C"));
+  BOOST_CHECK_EQUAL(name3, Name("/A/B").appendSegment(3));
+
+  // the copy made for a single append is exactly sized
+  BOOST_CHECK(name1.wireEncode().end() == name1.wireEncode().getBuffer()->end());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestNameBuilder
+
+} // namespace tests
+} // namespace ndn
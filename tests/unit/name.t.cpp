@@ -23,6 +23,7 @@
 
 #include "tests/boost-test.hpp"
 
+#include <array>
 #include <unordered_map>
 
 namespace ndn {
@@ -94,6 +95,46 @@ BOOST_AUTO_TEST_CASE(ParseUri)
   BOOST_CHECK_THROW(Name("/hello//world"), name::Component::Error);
   BOOST_CHECK_THROW(Name("/hello/./world"), name::Component::Error);
   BOOST_CHECK_THROW(Name("/hello/../world"), name::Component::Error);
+  BOOST_CHECK_THROW(Name("/hello/unknown=world"), name::Component::Error);
+  BOOST_CHECK_THROW(Name("/hello/v=01"), name::Component::Error);
+  BOOST_CHECK_THROW(Name("/hello/sha256digest=0415"), name::Component::Error);
+  BOOST_CHECK_THROW(Name("/hello/1=%04%15"), name::Component::Error);
+
+  // URI with typed components: same encoding as constructing the components individually
+  BOOST_CHECK_EQUAL(Name("/hello/v=1/seg=18446744073709551615/32=%00%2E").wireEncode(),
+                    Name("hello").appendVersion(1).appendSegment(std::numeric_limits<uint64_t>::max())
+                      .append(Component("2002002E"_block)).wireEncode());
+
+  // URI with long components: multi-octet TLV-LENGTH in both the components and the name
+  std::string longValue(300, 'x');
+  Name longName("/" + longValue + "/" + longValue);
+  BOOST_REQUIRE_EQUAL(longName.size(), 2);
+  BOOST_CHECK_EQUAL(longName[0], Component(longValue));
+  BOOST_CHECK_EQUAL(longName.wireEncode().value_size(), 2 * (3 + 1 + 300));
+  BOOST_CHECK_EQUAL(longName.toUri(), "/" + longValue + "/" + longValue);
+}
+
+BOOST_AUTO_TEST_CASE(ToUriOutput)
+{
+  Name name("/hello/v=3/%00%FF");
+
+  std::string str = "name=";
+  name.toUri(str);
+  BOOST_CHECK_EQUAL(str, "name=/hello/v=3/%00%FF");
+  name.toUri(str, UriFormat::CANONICAL);
+  BOOST_CHECK_EQUAL(str, "name=/hello/v=3/%00%FF/8=hello/54=%03/8=%00%FF");
+
+  std::array<char, 32> buffer;
+  buffer.fill('#');
+  BOOST_CHECK_EQUAL(name.toUri(buffer), 17);
+  BOOST_CHECK_EQUAL(std::string(buffer.data(), 18), "/hello/v=3/%00%FF#");
+
+  buffer.fill('#');
+  BOOST_CHECK_EQUAL(name.toUri(make_span(buffer).first(8)), 17);
+  BOOST_CHECK_EQUAL(std::string(buffer.data(), 9), "/hello/v#");
+
+  BOOST_CHECK_EQUAL(Name().toUri(buffer), 1);
+  BOOST_CHECK_EQUAL(buffer[0], '/');
 }
 
 BOOST_AUTO_TEST_CASE(DeepCopy)
@@ -80,8 +80,8 @@ public:
     interest.setTag(make_shared<lp::IncomingFaceIdTag>(123));
 
     processInterest = [this] (const Interest& interest) {
-      auto nextHopFaceIdTag = interest.template getTag<lp::NextHopFaceIdTag>();
-      if (nextHopFaceIdTag == nullptr) {
+      auto nextHopFaceId = interest.template getTagValue<lp::NextHopFaceIdTag>();
+      if (!nextHopFaceId) {
         if (responseType == ResponseType::INFRASTRUCTURE || responseType == ResponseType::BOTH) {
           makeResponse(interest);
         }
@@ -144,14 +144,14 @@ BOOST_FIXTURE_TEST_CASE(ValidateSuccessData, CertificateFetcherDirectFetchFixtur
 
   // odd interests
   for (const auto& sentInterest : this->face.sentInterests | boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() != nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() != nullopt);
   }
 
   // even interests
   for (const auto& sentInterest : this->face.sentInterests |
                                     boost::adaptors::sliced(1, this->face.sentInterests.size()) |
                                     boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() == nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() == nullopt);
   }
 }
 
@@ -164,7 +164,7 @@ BOOST_FIXTURE_TEST_CASE(ValidateSuccessDataDirectOnly, CertificateFetcherDirectF
   BOOST_CHECK_EQUAL(this->face.sentInterests.size(), 2);
 
   for (const auto& sentInterest : this->face.sentInterests) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() != nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() != nullopt);
   }
 }
 
@@ -178,14 +178,14 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailureData, T, Failures, CertificateFe
 
   // odd interests
   for (const auto& sentInterest : this->face.sentInterests | boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() != nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() != nullopt);
   }
 
   // even interests
   for (const auto& sentInterest : this->face.sentInterests |
                                     boost::adaptors::sliced(1, this->face.sentInterests.size()) |
                                     boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() == nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() == nullopt);
   }
 }
 
@@ -201,7 +201,7 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailureDataDirectOnly, T, Failures, Cer
   BOOST_TEST(this->face.sentInterests.size() == 4);
 
   for (const auto& sentInterest : this->face.sentInterests) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() != nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() != nullopt);
   }
 }
 
@@ -225,14 +225,14 @@ BOOST_FIXTURE_TEST_CASE(ValidateSuccessInterest, CertificateFetcherDirectFetchFi
 
   // odd interests
   for (const auto& sentInterest : this->face.sentInterests | boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() != nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() != nullopt);
   }
 
   // even interests
   for (const auto& sentInterest : this->face.sentInterests |
                                     boost::adaptors::sliced(1, this->face.sentInterests.size()) |
                                     boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() == nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() == nullopt);
   }
 }
 
@@ -246,14 +246,14 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(ValidateFailureInterest, T, Failures, Certifica
 
   // odd interests
   for (const auto& sentInterest : this->face.sentInterests | boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() != nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() != nullopt);
   }
 
   // even interests
   for (const auto& sentInterest : this->face.sentInterests |
                                     boost::adaptors::sliced(1, this->face.sentInterests.size()) |
                                     boost::adaptors::strided(2)) {
-    BOOST_CHECK(sentInterest.template getTag<lp::NextHopFaceIdTag>() == nullptr);
+    BOOST_CHECK(sentInterest.template getTagValue<lp::NextHopFaceIdTag>() == nullopt);
   }
 }
 
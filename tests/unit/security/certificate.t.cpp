@@ -23,6 +23,7 @@
 
 #include "ndn-cxx/security/certificate.hpp"
 #include "ndn-cxx/encoding/block-helpers.hpp"
+#include "ndn-cxx/security/transform/public-key.hpp"
 #include "ndn-cxx/util/io.hpp"
 
 #include "tests/boost-test.hpp"
@@ -161,6 +162,57 @@ BOOST_AUTO_TEST_CASE(Construction)
   BOOST_CHECK_EQUAL(certificate, certificate2);
 }
 
+BOOST_AUTO_TEST_CASE(ModifyAfterDecoding)
+{
+  Certificate certificate(Block{CERT});
+  BOOST_CHECK_EQUAL(certificate.isValid(time::fromIsoString("20150815T000000")), true);
+
+  // fields decoded at construction must not be used once the packet is modified
+  certificate.setName("/ndn/site2/KEY/ksk-1416425377094/0123/%FD%00%00%01I%C9%8B");
+  SignatureInfo info = certificate.getSignatureInfo();
+  info.setValidityPeriod(ValidityPeriod(time::fromIsoString("20160101T000000"),
+                                        time::fromIsoString("20161231T235959")));
+  certificate.setSignatureInfo(info);
+  BOOST_CHECK_EQUAL(certificate.getKeyName(), "/ndn/site2/KEY/ksk-1416425377094");
+  BOOST_CHECK_EQUAL(certificate.getIdentity(), "/ndn/site2");
+  BOOST_CHECK_EQUAL(certificate.isValid(time::fromIsoString("20150815T000000")), false);
+  BOOST_CHECK_EQUAL(certificate.isValid(time::fromIsoString("20160815T000000")), true);
+
+  certificate.wireEncode();
+  BOOST_CHECK_EQUAL(certificate.getIdentity(), "/ndn/site2");
+  BOOST_CHECK_EQUAL(certificate.getValidityPeriod().getPeriod().first,
+                    time::fromIsoString("20160101T000000"));
+
+  // a certificate without ValidityPeriod
+  info.setValidityPeriod(nullopt);
+  certificate.setSignatureInfo(info);
+  Certificate certificate2(Block{certificate.wireEncode()});
+  BOOST_CHECK_EQUAL(certificate2.getKeyName(), "/ndn/site2/KEY/ksk-1416425377094");
+  BOOST_CHECK_THROW(certificate2.getValidityPeriod(), tlv::Error);
+  BOOST_CHECK_THROW(certificate2.isValid(), tlv::Error);
+}
+
+BOOST_AUTO_TEST_CASE(LoadedPublicKey)
+{
+  Certificate certificate(Block{CERT});
+  auto key = certificate.getLoadedPublicKey();
+  BOOST_REQUIRE(key != nullptr);
+  BOOST_CHECK_EQUAL(key->getKeyType(), KeyType::RSA);
+
+  // loaded once, and shared with copies
+  BOOST_CHECK_EQUAL(certificate.getLoadedPublicKey(), key);
+  Certificate copy(certificate);
+  BOOST_CHECK_EQUAL(copy.getLoadedPublicKey(), key);
+
+  // the cached key must not be used once the packet is modified
+  certificate.setContent(make_span(PUBLIC_KEY).first(10));
+  BOOST_CHECK(certificate.getLoadedPublicKey() == nullptr);
+  BOOST_CHECK_EQUAL(copy.getLoadedPublicKey(), key);
+
+  Certificate empty;
+  BOOST_CHECK(empty.getLoadedPublicKey() == nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(Setters)
 {
   Certificate certificate;
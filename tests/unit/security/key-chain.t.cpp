@@ -471,6 +471,9 @@ using RsaSigning = AsymmetricSigning<PacketType, RsaKeyParams, tlv::SignatureSha
 template<typename PacketType>
 using EcdsaSigning = AsymmetricSigning<PacketType, EcKeyParams, tlv::SignatureSha256WithEcdsa>;
 
+template<typename PacketType>
+using Ed25519Signing = AsymmetricSigning<PacketType, Ed25519KeyParams, tlv::SignatureEd25519>;
+
 template<typename PacketType>
 struct SigningWithNonDefaultIdentity : protected AsymmetricSigningBase<PacketType, NonDefaultIdentity>
 {
@@ -540,6 +543,9 @@ using SigningTests = boost::mpl::vector<
   EcdsaSigning<DataPkt>,
   EcdsaSigning<InterestV02Pkt>,
   EcdsaSigning<InterestV03Pkt>,
+  Ed25519Signing<DataPkt>,
+  Ed25519Signing<InterestV02Pkt>,
+  Ed25519Signing<InterestV03Pkt>,
 #if OPENSSL_VERSION_NUMBER < 0x30000000L // FIXME #5154
   HmacSigning<DataPkt>,
   HmacSigning<InterestV02Pkt>,
@@ -78,6 +78,28 @@ BOOST_AUTO_TEST_CASE(Ec)
   BOOST_CHECK_EQUAL(params4.getKeyId(), keyId);
 }
 
+BOOST_AUTO_TEST_CASE(Ed25519)
+{
+  Ed25519KeyParams params;
+  BOOST_CHECK_EQUAL(params.getKeyType(), KeyType::ED25519);
+  BOOST_CHECK_EQUAL(params.getKeySize(), 256);
+  BOOST_CHECK_EQUAL(params.getKeyIdType(), KeyIdType::RANDOM);
+
+  Ed25519KeyParams params2(256, KeyIdType::SHA256);
+  BOOST_CHECK_EQUAL(params2.getKeyType(), KeyType::ED25519);
+  BOOST_CHECK_EQUAL(params2.getKeySize(), 256);
+  BOOST_CHECK_EQUAL(params2.getKeyIdType(), KeyIdType::SHA256);
+
+  BOOST_CHECK_THROW(Ed25519KeyParams(448), KeyParams::Error);
+
+  name::Component keyId("keyId");
+  Ed25519KeyParams params3(keyId);
+  BOOST_CHECK_EQUAL(params3.getKeyType(), KeyType::ED25519);
+  BOOST_CHECK_EQUAL(params3.getKeySize(), 256);
+  BOOST_CHECK_EQUAL(params3.getKeyIdType(), KeyIdType::USER_SPECIFIED);
+  BOOST_CHECK_EQUAL(params3.getKeyId(), keyId);
+}
+
 BOOST_AUTO_TEST_CASE(Aes)
 {
   name::Component keyId("keyId");
@@ -148,6 +170,7 @@ BOOST_AUTO_TEST_CASE(KeyTypeToString)
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(KeyType::EC), "EC");
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(KeyType::AES), "AES");
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(KeyType::HMAC), "HMAC");
+  BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(KeyType::ED25519), "Ed25519");
   BOOST_CHECK_EQUAL(boost::lexical_cast<std::string>(static_cast<KeyType>(12345)), "12345");
 }
 
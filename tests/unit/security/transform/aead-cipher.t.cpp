@@ -0,0 +1,219 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/transform/aead-cipher.hpp"
+
+#include "ndn-cxx/util/string-helper.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <set>
+
+namespace ndn {
+namespace security {
+namespace transform {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_AUTO_TEST_SUITE(Transform)
+BOOST_AUTO_TEST_SUITE(TestAeadCipher)
+
+struct AesGcmTestVector
+{
+  // Test Case 4 from "The Galois/Counter Mode of Operation (GCM)", McGrew and Viega
+  static constexpr AeadAlgorithm algo = AeadAlgorithm::AES_GCM;
+  const std::string key = "feffe9928665731c6d6a8f9467308308";
+  const std::string nonce = "cafebabefacedbaddecaf888";
+  const std::string aad = "feedfacedeadbeeffeedfacedeadbeefabaddad2";
+  const std::string plaintext =
+    "d9313225f88406e5a55909c5aff5269a86a7a9531534f7da2e4c303d8a318a72"
+    "1c3c0c95956809532fcf0e2449a6b525b16aedf5aa0de657ba637b39";
+  const std::string ciphertext =
+    "42831ec2217774244b7221b784d0d49ce3aa212f2c02a4e035c17e2329aca12e"
+    "21d514b25466931c7d8f6a5aac84aa051ba30b396a0aac973d58e091";
+  const std::string tag = "5bc94fbc3221a5db94fae95ae7121a47";
+};
+constexpr AeadAlgorithm AesGcmTestVector::algo;
+
+struct ChaCha20Poly1305TestVector
+{
+  // RFC 8439, Section 2.8.2
+  static constexpr AeadAlgorithm algo = AeadAlgorithm::CHACHA20_POLY1305;
+  const std::string key = "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f";
+  const std::string nonce = "070000004041424344454647";
+  const std::string aad = "50515253c0c1c2c3c4c5c6c7";
+  const std::string plaintext =
+    "4c616469657320616e642047656e746c656d656e206f662074686520636c6173"
+    "73206f66202739393a204966204920636f756c64206f6666657220796f75206f"
+    "6e6c79206f6e652074697020666f7220746865206675747572652c2073756e73"
+    "637265656e20776f756c642062652069742e";
+  const std::string ciphertext =
+    "d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d6"
+    "3dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b36"
+    "92ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc"
+    "3ff4def08e4b7a9de576d26586cec64b6116";
+  const std::string tag = "1ae10b594f09e26a7e902ecbd0600691";
+};
+constexpr AeadAlgorithm ChaCha20Poly1305TestVector::algo;
+
+using TestVectors = boost::mpl::vector<AesGcmTestVector, ChaCha20Poly1305TestVector>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(EncryptDecrypt, T, TestVectors)
+{
+  T tv;
+  auto key = fromHex(tv.key);
+  auto nonce = fromHex(tv.nonce);
+  auto aad = fromHex(tv.aad);
+  auto plaintext = fromHex(tv.plaintext);
+  auto ciphertext = fromHex(tv.ciphertext);
+  auto tag = fromHex(tv.tag);
+
+  AeadCipher cipher(T::algo, *key);
+  BOOST_CHECK_EQUAL(cipher.getAlgorithm(), T::algo);
+
+  // into separate buffers
+  Buffer out(plaintext->size());
+  Buffer outTag(AeadCipher::TAG_SIZE);
+  cipher.encrypt(*nonce, *aad, *plaintext, out, outTag);
+  BOOST_TEST(out == *ciphertext, boost::test_tools::per_element());
+  BOOST_TEST(outTag == *tag, boost::test_tools::per_element());
+
+  Buffer decrypted(ciphertext->size());
+  BOOST_CHECK_EQUAL(cipher.decrypt(*nonce, *aad, *ciphertext, *tag, decrypted), true);
+  BOOST_TEST(decrypted == *plaintext, boost::test_tools::per_element());
+
+  // in place
+  Buffer inPlace(*plaintext);
+  cipher.encrypt(*nonce, *aad, inPlace, inPlace, outTag);
+  BOOST_TEST(inPlace == *ciphertext, boost::test_tools::per_element());
+  BOOST_CHECK_EQUAL(cipher.decrypt(*nonce, *aad, inPlace, outTag, inPlace), true);
+  BOOST_TEST(inPlace == *plaintext, boost::test_tools::per_element());
+
+  // allocating variants
+  auto sealed = cipher.encrypt(*nonce, *aad, *plaintext);
+  BOOST_REQUIRE_EQUAL(sealed->size(), ciphertext->size() + AeadCipher::TAG_SIZE);
+  BOOST_CHECK(std::equal(ciphertext->begin(), ciphertext->end(), sealed->begin()));
+  BOOST_CHECK(std::equal(tag->begin(), tag->end(), sealed->begin() + ciphertext->size()));
+  auto opened = cipher.decrypt(*nonce, *aad, *sealed);
+  BOOST_REQUIRE(opened != nullptr);
+  BOOST_TEST(*opened == *plaintext, boost::test_tools::per_element());
+
+  // empty plaintext and associated data
+  auto emptySealed = cipher.encrypt(*nonce, {}, {});
+  BOOST_CHECK_EQUAL(emptySealed->size(), AeadCipher::TAG_SIZE);
+  auto emptyOpened = cipher.decrypt(*nonce, {}, *emptySealed);
+  BOOST_REQUIRE(emptyOpened != nullptr);
+  BOOST_CHECK_EQUAL(emptyOpened->size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(AuthenticationFailure, T, TestVectors)
+{
+  T tv;
+  auto key = fromHex(tv.key);
+  auto nonce = fromHex(tv.nonce);
+  auto aad = fromHex(tv.aad);
+  auto ciphertext = fromHex(tv.ciphertext);
+  auto tag = fromHex(tv.tag);
+  AeadCipher cipher(T::algo, *key);
+
+  Buffer plaintext(ciphertext->size());
+  Buffer badCiphertext(*ciphertext);
+  badCiphertext[0] ^= 0x01;
+  BOOST_CHECK_EQUAL(cipher.decrypt(*nonce, *aad, badCiphertext, *tag, plaintext), false);
+  BOOST_CHECK(std::all_of(plaintext.begin(), plaintext.end(), [] (uint8_t b) { return b == 0; }));
+
+  Buffer badTag(*tag);
+  badTag.back() ^= 0x80;
+  BOOST_CHECK_EQUAL(cipher.decrypt(*nonce, *aad, *ciphertext, badTag, plaintext), false);
+
+  Buffer badAad(*aad);
+  badAad.push_back(0x00);
+  BOOST_CHECK_EQUAL(cipher.decrypt(*nonce, badAad, *ciphertext, *tag, plaintext), false);
+
+  Buffer badNonce(*nonce);
+  badNonce[0] ^= 0xff;
+  BOOST_CHECK_EQUAL(cipher.decrypt(badNonce, *aad, *ciphertext, *tag, plaintext), false);
+
+  // the cipher can be used again after a failure
+  BOOST_CHECK_EQUAL(cipher.decrypt(*nonce, *aad, *ciphertext, *tag, plaintext), true);
+
+  const uint8_t tooShort[AeadCipher::TAG_SIZE - 1] = {};
+  BOOST_CHECK(cipher.decrypt(*nonce, *aad, tooShort) == nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidParameters)
+{
+  const uint8_t key16[16] = {};
+  const uint8_t key32[32] = {};
+  const uint8_t key20[20] = {};
+  BOOST_CHECK_THROW(AeadCipher(AeadAlgorithm::NONE, key16), AeadCipher::Error);
+  BOOST_CHECK_THROW(AeadCipher(AeadAlgorithm::AES_GCM, key20), AeadCipher::Error);
+  BOOST_CHECK_THROW(AeadCipher(AeadAlgorithm::CHACHA20_POLY1305, key16), AeadCipher::Error);
+
+  AeadCipher cipher(AeadAlgorithm::AES_GCM, key32);
+  const uint8_t nonce[AeadCipher::NONCE_SIZE] = {};
+  const uint8_t badNonce[8] = {};
+  const uint8_t plaintext[10] = {};
+  uint8_t ciphertext[10];
+  uint8_t shortOutput[9];
+  uint8_t tag[AeadCipher::TAG_SIZE];
+  uint8_t shortTag[8];
+  BOOST_CHECK_THROW(cipher.encrypt(badNonce, {}, plaintext, ciphertext, tag), AeadCipher::Error);
+  BOOST_CHECK_THROW(cipher.encrypt(nonce, {}, plaintext, shortOutput, tag), AeadCipher::Error);
+  BOOST_CHECK_THROW(cipher.encrypt(nonce, {}, plaintext, ciphertext, shortTag), AeadCipher::Error);
+  BOOST_CHECK_NO_THROW(cipher.encrypt(nonce, {}, plaintext, ciphertext, tag));
+  bool ok = false;
+  BOOST_CHECK_THROW(ok = cipher.decrypt(nonce, {}, ciphertext, shortTag, ciphertext), AeadCipher::Error);
+  BOOST_CHECK_THROW(ok = cipher.decrypt(nonce, {}, ciphertext, tag, shortOutput), AeadCipher::Error);
+  BOOST_CHECK(!ok);
+}
+
+BOOST_AUTO_TEST_CASE(NonceSequence)
+{
+  AeadNonceSequence seq(0x01020304, 0xfffffffffffffffe);
+  BOOST_CHECK_EQUAL(seq.getFixedField(), 0x01020304);
+  BOOST_CHECK_EQUAL(seq.getCounter(), 0xfffffffffffffffe);
+
+  auto n1 = seq.next();
+  BOOST_CHECK_EQUAL(toHex(n1), "01020304FFFFFFFFFFFFFFFE");
+  auto n2 = seq.next();
+  BOOST_CHECK_EQUAL(toHex(n2), "01020304FFFFFFFFFFFFFFFF");
+  BOOST_CHECK_EQUAL(seq.getCounter(), 0);
+  BOOST_CHECK_THROW(seq.next(), AeadCipher::Error);
+
+  // the fixed field must be chosen by the caller
+  static_assert(!std::is_default_constructible<AeadNonceSequence>::value, "");
+  AeadNonceSequence seq2(0xa0b0c0d0);
+  std::set<AeadNonceSequence::Nonce> nonces;
+  for (int i = 0; i < 100; ++i) {
+    BOOST_CHECK(nonces.insert(seq2.next()).second);
+  }
+  BOOST_CHECK_EQUAL(seq2.getCounter(), 100);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestAeadCipher
+BOOST_AUTO_TEST_SUITE_END() // Transform
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // namespace transform
+} // namespace security
+} // namespace ndn
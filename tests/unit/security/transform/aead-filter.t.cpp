@@ -0,0 +1,122 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/security/transform/aead-filter.hpp"
+
+#include "ndn-cxx/encoding/buffer-stream.hpp"
+#include "ndn-cxx/security/transform/aead-cipher.hpp"
+#include "ndn-cxx/security/transform/buffer-source.hpp"
+#include "ndn-cxx/security/transform/step-source.hpp"
+#include "ndn-cxx/security/transform/stream-sink.hpp"
+
+#include "tests/boost-test.hpp"
+
+namespace ndn {
+namespace security {
+namespace transform {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Security)
+BOOST_AUTO_TEST_SUITE(Transform)
+BOOST_AUTO_TEST_SUITE(TestAeadFilter)
+
+const uint8_t KEY[] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+const uint8_t NONCE[] = {
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+};
+const uint8_t AAD[] = {0x06, 0x03, 0x08, 0x01, 0x41};
+const uint8_t PLAINTEXT[] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+  0x10, 0x11, 0x12, 0x13, 0x14,
+};
+
+BOOST_AUTO_TEST_CASE(AesGcm)
+{
+  // encrypting in several steps produces the same result as AeadCipher
+  OBufferStream os;
+  StepSource source;
+  source >> aeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::ENCRYPT, KEY, NONCE, AAD)
+         >> streamSink(os);
+  source.write(make_span(PLAINTEXT).first(7));
+  source.write(make_span(PLAINTEXT).subspan(7));
+  source.end();
+
+  AeadCipher cipher(AeadAlgorithm::AES_GCM, KEY);
+  auto expected = cipher.encrypt(NONCE, AAD, PLAINTEXT);
+  auto sealed = os.buf();
+  BOOST_TEST(*sealed == *expected, boost::test_tools::per_element());
+
+  // decrypt
+  OBufferStream os2;
+  bufferSource(*sealed)
+    >> aeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::DECRYPT, KEY, NONCE, AAD)
+    >> streamSink(os2);
+  auto buf2 = os2.buf();
+  BOOST_CHECK_EQUAL_COLLECTIONS(PLAINTEXT, PLAINTEXT + sizeof(PLAINTEXT), buf2->begin(), buf2->end());
+
+  // tampered input
+  Buffer tampered(*sealed);
+  tampered[3] ^= 0x01;
+  OBufferStream os3;
+  BOOST_CHECK_THROW(bufferSource(tampered)
+                      >> aeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::DECRYPT, KEY, NONCE, AAD)
+                      >> streamSink(os3),
+                    Error);
+  BOOST_CHECK_EQUAL(os3.buf()->size(), 0);
+
+  // wrong associated data
+  OBufferStream os4;
+  BOOST_CHECK_THROW(bufferSource(*sealed)
+                      >> aeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::DECRYPT, KEY, NONCE)
+                      >> streamSink(os4),
+                    Error);
+
+  // input shorter than the tag
+  OBufferStream os5;
+  BOOST_CHECK_THROW(bufferSource(make_span(*sealed).first(AeadCipher::TAG_SIZE - 1))
+                      >> aeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::DECRYPT, KEY, NONCE, AAD)
+                      >> streamSink(os5),
+                    Error);
+}
+
+BOOST_AUTO_TEST_CASE(InvalidParameters)
+{
+  const uint8_t badKey[] = {0x00, 0x01, 0x02, 0x03};
+  BOOST_CHECK_THROW(AeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::ENCRYPT, badKey, NONCE), Error);
+
+  const uint8_t badNonce[] = {0x00, 0x01, 0x02, 0x03};
+  BOOST_CHECK_THROW(AeadFilter(AeadAlgorithm::AES_GCM, CipherOperator::ENCRYPT, KEY, badNonce), Error);
+
+  BOOST_CHECK_THROW(AeadFilter(AeadAlgorithm::NONE, CipherOperator::DECRYPT, KEY, NONCE), Error);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestAeadFilter
+BOOST_AUTO_TEST_SUITE_END() // Transform
+BOOST_AUTO_TEST_SUITE_END() // Security
+
+} // namespace tests
+} // namespace transform
+} // namespace security
+} // namespace ndn
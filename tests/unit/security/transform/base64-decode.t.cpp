@@ -169,6 +169,25 @@ BOOST_AUTO_TEST_CASE(EmptyInput)
   BOOST_CHECK_EQUAL(os.buf()->size(), 0);
 }
 
+BOOST_AUTO_TEST_CASE(Whitespace)
+{
+  // whitespace anywhere, missing padding
+  const std::string in = " Zm9v\r\n\tYm\nE";
+  OBufferStream os;
+  bufferSource(in) >> base64Decode() >> streamSink(os);
+
+  auto buf = os.buf();
+  BOOST_CHECK_EQUAL(std::string(buf->begin(), buf->end()), "fooba");
+}
+
+BOOST_AUTO_TEST_CASE(InvalidInput)
+{
+  for (const std::string in : {"Zm9v*mFy", "Zm9vY", "Zg==Zg=="}) {
+    OBufferStream os;
+    BOOST_CHECK_THROW(bufferSource(in) >> base64Decode() >> streamSink(os), Error);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestBase64Decode
 BOOST_AUTO_TEST_SUITE_END() // Transform
 BOOST_AUTO_TEST_SUITE_END() // Security
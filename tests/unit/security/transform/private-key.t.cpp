@@ -36,7 +36,9 @@
 
 #include <openssl/opensslv.h>
 #include <boost/mpl/vector.hpp>
+#include <array>
 #include <sstream>
+#include <thread>
 
 namespace ndn {
 namespace security {
@@ -637,6 +639,23 @@ public:
   }
 };
 
+class Ed25519KeyGenParams
+{
+public:
+  using Params = Ed25519KeyParams;
+  using hasPublicKey = std::true_type;
+  using canSavePkcs1 = std::true_type; // saved as unencrypted PKCS #8
+
+  static void
+  checkPublicKey(const Buffer& bits)
+  {
+    // OBJECT IDENTIFIER 1.3.101.112 id-Ed25519 (RFC 8410)
+    const uint8_t oid[] = {0x06, 0x03, 0x2B, 0x65, 0x70};
+    BOOST_CHECK_MESSAGE(std::search(bits.begin(), bits.end(), oid, oid + sizeof(oid)) != bits.end(),
+                        "OID not found in " << toHex(bits));
+  }
+};
+
 class HmacKeyGenParams
 {
 public:
@@ -655,7 +674,8 @@ using KeyGenParams = boost::mpl::vector<
   HmacKeyGenParams,
 #endif
   RsaKeyGenParams,
-  EcKeyGenParams
+  EcKeyGenParams,
+  Ed25519KeyGenParams
 >;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(GenerateKey, T, KeyGenParams)
@@ -707,6 +727,84 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(GenerateKey, T, KeyGenParams)
   }
 }
 
+BOOST_AUTO_TEST_CASE_TEMPLATE(SignVerify, T, KeyGenParams)
+{
+  typename T::Params params;
+  auto sKey = generatePrivateKey(params);
+  const size_t maxSigSize = sKey->getMaxSignatureSize(DigestAlgorithm::SHA256);
+
+  const uint8_t data1[] = {0x01, 0x02, 0x03, 0x04};
+  const uint8_t data2[] = {0x05, 0x06, 0x07, 0x08};
+  const InputBuffers bufs{data1, data2};
+
+  auto sig1 = sKey->sign(DigestAlgorithm::SHA256, bufs);
+  BOOST_REQUIRE(sig1 != nullptr);
+  BOOST_CHECK_LE(sig1->size(), maxSigSize);
+
+  // the second signature is computed with a copy of the same signing context
+  Buffer sig2(maxSigSize);
+  sig2.resize(sKey->sign(DigestAlgorithm::SHA256, bufs, sig2));
+
+  uint8_t tooSmall[8];
+  BOOST_CHECK_THROW(sKey->sign(DigestAlgorithm::SHA256, bufs, tooSmall), PrivateKey::Error);
+
+  // signatures computed without a transformation chain are verified by VerifierFilter
+  bool result = false;
+  if (typename T::hasPublicKey()) {
+    PublicKey pKey;
+    pKey.loadPkcs8(*sKey->derivePublicKey());
+    BOOST_CHECK_NO_THROW(bufferSource(bufs) >>
+                         verifierFilter(DigestAlgorithm::SHA256, pKey, *sig1) >>
+                         boolSink(result));
+
+    BOOST_CHECK_EQUAL(pKey.verify(DigestAlgorithm::SHA256, bufs, *sig1), true);
+    BOOST_CHECK_EQUAL(pKey.verify(DigestAlgorithm::SHA256, bufs, sig2), true);
+    BOOST_CHECK_EQUAL(pKey.verify(DigestAlgorithm::SHA256, {data1}, *sig1), false);
+    BOOST_CHECK_THROW(sKey->verify(DigestAlgorithm::SHA256, bufs, *sig1), PrivateKey::Error);
+  }
+  else {
+    BOOST_CHECK_NO_THROW(bufferSource(bufs) >>
+                         verifierFilter(DigestAlgorithm::SHA256, *sKey, *sig1) >>
+                         boolSink(result));
+    BOOST_CHECK_EQUAL_COLLECTIONS(sig1->begin(), sig1->end(), sig2.begin(), sig2.end());
+
+    BOOST_CHECK_EQUAL(sKey->verify(DigestAlgorithm::SHA256, bufs, *sig1), true);
+    BOOST_CHECK_EQUAL(sKey->verify(DigestAlgorithm::SHA256, {data1}, *sig1), false);
+    BOOST_CHECK_EQUAL(sKey->verify(DigestAlgorithm::SHA256, bufs,
+                                   make_span(*sig1).first(sig1->size() - 1)), false);
+  }
+  BOOST_CHECK(result);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ConcurrentSign, T, KeyGenParams)
+{
+  typename T::Params params;
+  auto sKey = generatePrivateKey(params);
+  const uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
+
+  // the signing context is created on first use, which all threads race for
+  std::array<ConstBufferPtr, 4> sigs;
+  std::vector<std::thread> threads;
+  for (auto& sig : sigs) {
+    threads.emplace_back([&] { sig = sKey->sign(DigestAlgorithm::SHA256, {data}); });
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  for (const auto& sig : sigs) {
+    BOOST_REQUIRE(sig != nullptr);
+    if (typename T::hasPublicKey()) {
+      PublicKey pKey;
+      pKey.loadPkcs8(*sKey->derivePublicKey());
+      BOOST_CHECK_EQUAL(pKey.verify(DigestAlgorithm::SHA256, {data}, *sig), true);
+    }
+    else {
+      BOOST_CHECK_EQUAL(sKey->verify(DigestAlgorithm::SHA256, {data}, *sig), true);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(GenerateKeyUnsupportedType)
 {
   BOOST_CHECK_THROW(generatePrivateKey(AesKeyParams()), std::invalid_argument);
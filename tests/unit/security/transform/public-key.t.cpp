@@ -73,7 +73,18 @@ struct EcKeyTestData
 constexpr KeyType EcKeyTestData::type;
 constexpr size_t EcKeyTestData::size;
 
-using KeyTestDataSets = boost::mpl::vector<RsaKeyTestData, EcKeyTestData>;
+struct Ed25519KeyTestData
+{
+  static constexpr KeyType type = KeyType::ED25519;
+  static constexpr size_t size = 256;
+  // from RFC 8410, Section 10.1
+  const std::string pkcs8Base64 =
+      "MCowBQYDK2VwAyEAGb9ECWmEzf6FQbrBZ9w7lshQhqowtrbLDFw4rXAxZuE=\n";
+};
+constexpr KeyType Ed25519KeyTestData::type;
+constexpr size_t Ed25519KeyTestData::size;
+
+using KeyTestDataSets = boost::mpl::vector<RsaKeyTestData, EcKeyTestData, Ed25519KeyTestData>;
 
 BOOST_AUTO_TEST_CASE_TEMPLATE(LoadAndSave, T, KeyTestDataSets)
 {
@@ -82,6 +82,10 @@ public:
 
 public:
   std::vector<Name> names;
+  /// signature type accepted by the checker
+  tlv::SignatureTypeValue sigType = tlv::SignatureSha256WithRsa;
+  /// signature type rejected by the checker
+  tlv::SignatureTypeValue otherSigType = tlv::SignatureSha256WithEcdsa;
 };
 
 class NameRelationEqual : public CheckerFixture
@@ -199,6 +203,30 @@ public:
                                              {false, false, false, true}};
 };
 
+class HierarchicalEd25519 : public CheckerFixture
+{
+public:
+  HierarchicalEd25519()
+    : checkerPtr(Checker::create(makeSection(R"CONF(
+          type hierarchical
+          sig-type ed25519
+        )CONF"), "test-config"))
+    , checker(*checkerPtr)
+  {
+    sigType = tlv::SignatureEd25519;
+    otherSigType = tlv::SignatureSha256WithRsa;
+  }
+
+public:
+  std::unique_ptr<Checker> checkerPtr;
+  Checker& checker;
+
+  std::vector<std::vector<bool>> outcomes = {{true,  false, true,  false},
+                                             {true,  true,  true,  false},
+                                             {false, false, true,  false},
+                                             {false, false, false, true}};
+};
+
 class CustomizedNameRelation : public CheckerFixture
 {
 public:
@@ -299,6 +327,7 @@ using CheckerFixtures = boost::mpl::vector<
   HyperRelationIsPrefixOf,
   HyperRelationIsStrictPrefixOf,
   Hierarchical,
+  HierarchicalEd25519,
   CustomizedNameRelation,
   CustomizedRegex,
   CustomizedHyperRelation
@@ -328,13 +357,13 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(Checks, T, Tests, T::second)
       bool expectedOutcome = this->outcomes[i][j];
 
       auto klName = this->makeKeyLocatorKeyName(this->names[j]);
-      this->template testChecker<PktType>(this->checker, tlv::SignatureSha256WithRsa, pktName, klName, expectedOutcome);
-      this->template testChecker<PktType>(this->checker, tlv::SignatureSha256WithEcdsa, pktName, klName, false);
+      this->template testChecker<PktType>(this->checker, this->sigType, pktName, klName, expectedOutcome);
+      this->template testChecker<PktType>(this->checker, this->otherSigType, pktName, klName, false);
 
 
       klName = this->makeKeyLocatorCertName(this->names[j]);
-      this->template testChecker<PktType>(this->checker, tlv::SignatureSha256WithRsa, pktName, klName, expectedOutcome);
-      this->template testChecker<PktType>(this->checker, tlv::SignatureSha256WithEcdsa, pktName, klName, false);
+      this->template testChecker<PktType>(this->checker, this->sigType, pktName, klName, expectedOutcome);
+      this->template testChecker<PktType>(this->checker, this->otherSigType, pktName, klName, false);
     }
   }
 }
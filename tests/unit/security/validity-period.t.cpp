@@ -183,6 +183,16 @@ const uint8_t VP_E6[] = {
       0x54, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30
 };
 
+const uint8_t VP_E7[] = {
+  0xfd, 0x00, 0xfd, 0x26, // ValidityPeriod
+    0xfd, 0x00, 0xfe, 0x0f, // NotBefore
+      0x31, 0x39, 0x37, 0x30, 0x30, 0x32, 0x33, 0x30, // 19700230T000000
+      0x54, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0xfd, 0x00, 0xff, 0x0f, // NotAfter
+      0x31, 0x39, 0x37, 0x30, 0x30, 0x33, 0x30, 0x32, // 19700302T000000
+      0x54, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30
+};
+
 BOOST_AUTO_TEST_CASE(DecodingError)
 {
   BOOST_CHECK_THROW(ValidityPeriod(Block{VP_E1}), ValidityPeriod::Error);
@@ -191,6 +201,7 @@ BOOST_AUTO_TEST_CASE(DecodingError)
   BOOST_CHECK_THROW(ValidityPeriod(Block{VP_E4}), ValidityPeriod::Error);
   BOOST_CHECK_THROW(ValidityPeriod(Block{VP_E5}), ValidityPeriod::Error);
   BOOST_CHECK_THROW(ValidityPeriod(Block{VP_E6}), ValidityPeriod::Error);
+  BOOST_CHECK_THROW(ValidityPeriod(Block{VP_E7}), ValidityPeriod::Error);
 
   Block emptyBlock;
   BOOST_CHECK_THROW(ValidityPeriod{emptyBlock}, ValidityPeriod::Error);
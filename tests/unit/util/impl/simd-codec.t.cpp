@@ -0,0 +1,256 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2022 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/util/impl/simd-codec.hpp"
+#include "ndn-cxx/util/random.hpp"
+#include "ndn-cxx/util/string-helper.hpp"
+
+#include "tests/boost-test.hpp"
+
+#include <boost/mpl/vector.hpp>
+
+namespace ndn {
+namespace util {
+namespace detail {
+namespace tests {
+
+BOOST_AUTO_TEST_SUITE(Util)
+BOOST_AUTO_TEST_SUITE(TestSimdCodec)
+
+template<SimdLevel L>
+struct Level : std::integral_constant<SimdLevel, L>
+{
+};
+
+using Levels = boost::mpl::vector<Level<SimdLevel::NONE>,
+                                  Level<SimdLevel::SSSE3>,
+                                  Level<SimdLevel::AVX2>>;
+
+/** \brief Selects a SimdLevel for the duration of a test case, and the scalar code to compute
+ *         the expected results.
+ */
+class SimdLevelFixture
+{
+protected:
+  SimdLevelFixture()
+    : m_saved(getSimdLevel())
+  {
+  }
+
+  ~SimdLevelFixture()
+  {
+    setSimdLevel(m_saved);
+  }
+
+  bool
+  select(SimdLevel level)
+  {
+    if (setSimdLevel(level) != level) {
+      BOOST_TEST_MESSAGE("SimdLevel " << static_cast<int>(level) << " not supported, skipping");
+      return false;
+    }
+    return true;
+  }
+
+  template<typename F>
+  static auto
+  scalar(const F& f)
+  {
+    SimdLevel level = setSimdLevel(SimdLevel::NONE);
+    auto result = f();
+    setSimdLevel(level);
+    return result;
+  }
+
+  static std::vector<uint8_t>
+  makeInput(size_t size)
+  {
+    std::vector<uint8_t> input(size);
+    random::generateSecureBytes(input);
+    return input;
+  }
+
+private:
+  SimdLevel m_saved;
+};
+
+// sizes around the block sizes of every kernel, and one spanning many lines of base64
+const size_t SIZES[] = {0, 1, 2, 3, 11, 12, 15, 16, 17, 23, 24, 27, 28, 29, 31, 32, 33,
+                        47, 48, 49, 63, 64, 65, 95, 96, 97, 127, 128, 129, 1000, 4099};
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Kernels, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  auto input = makeInput(4096);
+  std::vector<uint8_t> output(8192);
+
+  size_t nBase64 = encodeBase64Blocks(input.data(), input.size(), output.data());
+  BOOST_CHECK_EQUAL(nBase64 % 3, 0);
+  size_t nHex = encodeHexBlocks(input.data(), input.size(),
+                                reinterpret_cast<char*>(output.data()), false);
+  if (L::value == SimdLevel::NONE) {
+    BOOST_CHECK_EQUAL(nBase64, 0);
+    BOOST_CHECK_EQUAL(nHex, 0);
+  }
+  else {
+    // the vector kernels must actually handle the bulk of the input
+    BOOST_CHECK_GT(nBase64, input.size() - 32);
+    BOOST_CHECK_GT(nHex, input.size() - 32);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Hex, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  for (size_t size : SIZES) {
+    BOOST_TEST_CONTEXT("size=" << size) {
+      auto input = makeInput(size);
+      for (bool wantUpperCase : {false, true}) {
+        std::string expected = scalar([&] { return toHex(input, wantUpperCase); });
+        std::string hex = toHex(input, wantUpperCase);
+        BOOST_CHECK_EQUAL(hex, expected);
+
+        auto decoded = fromHex(hex);
+        BOOST_CHECK_EQUAL_COLLECTIONS(decoded->begin(), decoded->end(), input.begin(), input.end());
+      }
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(HexMixedCase, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  std::string hex;
+  for (int i = 0; i < 8; ++i) {
+    hex += "0123456789abcdefABCDEF";
+  }
+  auto expected = scalar([&] { return fromHex(hex); });
+  auto decoded = fromHex(hex);
+  BOOST_CHECK_EQUAL_COLLECTIONS(decoded->begin(), decoded->end(), expected->begin(), expected->end());
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(HexInvalid, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  std::string hex = toHex(makeInput(100));
+  // characters adjacent to the ranges of hex digits, and a byte with the high bit set
+  for (char bad : {'/', ':', '@', 'G', '`', 'g', ' ', '\xA1'}) {
+    for (size_t pos : {0, 1, 15, 16, 31, 32, 63, 64, 100, 199}) {
+      BOOST_TEST_CONTEXT("bad=" << static_cast<int>(bad) << " pos=" << pos) {
+        std::string s = hex;
+        s[pos] = bad;
+        BOOST_CHECK_THROW(fromHex(s), StringHelperError);
+      }
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Base64, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  for (size_t size : SIZES) {
+    BOOST_TEST_CONTEXT("size=" << size) {
+      auto input = makeInput(size);
+      for (bool needBreak : {false, true}) {
+        std::string expected = scalar([&] { return toBase64(input, needBreak); });
+        std::string base64 = toBase64(input, needBreak);
+        BOOST_CHECK_EQUAL(base64, expected);
+
+        auto decoded = fromBase64(base64);
+        BOOST_CHECK_EQUAL_COLLECTIONS(decoded->begin(), decoded->end(), input.begin(), input.end());
+      }
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Base64Alphabet, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  // every character of the alphabet, in every position within a block
+  std::string base64;
+  for (int i = 0; i < 5; ++i) {
+    base64 += "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    base64 += "A";
+  }
+  base64.resize(base64.size() / 4 * 4);
+  auto expected = scalar([&] { return fromBase64(base64); });
+  auto decoded = fromBase64(base64);
+  BOOST_CHECK_EQUAL_COLLECTIONS(decoded->begin(), decoded->end(), expected->begin(), expected->end());
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Base64Invalid, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  std::string base64 = toBase64(makeInput(150), false);
+  BOOST_REQUIRE_EQUAL(base64.size(), 200);
+  for (char bad : {'*', ',', '-', '.', ':', '@', '[', '`', '{', '\x80', '\xFF'}) {
+    for (size_t pos : {0, 3, 15, 16, 31, 32, 47, 64, 150, 199}) {
+      BOOST_TEST_CONTEXT("bad=" << static_cast<int>(bad) << " pos=" << pos) {
+        std::string s = base64;
+        s[pos] = bad;
+        BOOST_CHECK_THROW(fromBase64(s), StringHelperError);
+      }
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(Base64Whitespace, L, Levels, SimdLevelFixture)
+{
+  if (!select(L::value))
+    return;
+
+  auto input = makeInput(150);
+  std::string base64 = toBase64(input, false);
+  // whitespace and padding interrupt the vector kernel, which must resume after them
+  for (size_t pos : {1, 16, 33, 100, 199}) {
+    BOOST_TEST_CONTEXT("pos=" << pos) {
+      std::string s = base64;
+      s.insert(pos, " \n\t");
+      auto decoded = fromBase64(s);
+      BOOST_CHECK_EQUAL_COLLECTIONS(decoded->begin(), decoded->end(), input.begin(), input.end());
+    }
+  }
+
+  std::string padded = toBase64(makeInput(149), false) + "\n" + base64;
+  BOOST_CHECK_THROW(fromBase64(padded), StringHelperError);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // TestSimdCodec
+BOOST_AUTO_TEST_SUITE_END() // Util
+
+} // namespace tests
+} // namespace detail
+} // namespace util
+} // namespace ndn
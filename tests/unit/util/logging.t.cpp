@@ -27,6 +27,10 @@
 
 #include <boost/test/tools/output_test_stream.hpp>
 
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
 namespace ndn {
 namespace util {
 namespace tests {
@@ -699,6 +703,96 @@ BOOST_AUTO_TEST_CASE(NullDestination)
   // The default Boost.Log output is still expected
 }
 
+BOOST_AUTO_TEST_SUITE(Trace)
+
+BOOST_AUTO_TEST_CASE(Destination)
+{
+  auto traceOs = make_shared<std::ostringstream>();
+  Logging::setTraceDestination(traceOs);
+  Logging::setLevel("Module1", LogLevel::INFO);
+  logFromModule1();
+
+  Logging::flush();
+  BOOST_CHECK_EQUAL(traceOs->str(),
+    LOG_SYSTIME_STR + "  INFO: [Module1] info1\n" +
+    LOG_SYSTIME_STR + "  WARN: [Module1] warn1\n" +
+    LOG_SYSTIME_STR + " ERROR: [Module1] error1\n" +
+    LOG_SYSTIME_STR + " FATAL: [Module1] fatal1\n");
+  BOOST_CHECK(os.is_empty());
+
+  traceOs->str("");
+  Logging::setDestination(os, true);
+  logFromModule2();
+
+  Logging::flush();
+  BOOST_CHECK_EQUAL(traceOs->str(), "");
+  BOOST_CHECK(os.is_equal(LOG_SYSTIME_STR + " FATAL: [Module2] fatal2\n"));
+}
+
+BOOST_AUTO_TEST_CASE(Arguments)
+{
+  auto traceOs = make_shared<std::ostringstream>();
+  Logging::setTraceDestination(traceOs);
+  Logging::setLevel("ndn.util.tests.Logging", LogLevel::INFO);
+
+  const char* cstr = "cstr";
+  NDN_LOG_INFO(true << ' ' << -3 << ' ' << 42U << ' ' << uint8_t('u') << ' ' << 1.5 << ' ' <<
+               cstr << ' ' << std::string("str") << ' ' << LogLevel::WARN);
+  NDN_LOG_INFO("hex " << std::hex << 255 << ' ' << std::setw(4) << 10 << std::dec << ' ' << 10);
+  NDN_LOG_INFO("after manipulators " << 255);
+  NDN_LOG_INFO(std::string(1000, 'x'));
+
+  Logging::flush();
+  BOOST_CHECK_EQUAL(traceOs->str(),
+    LOG_SYSTIME_STR + "  INFO: [ndn.util.tests.Logging] 1 -3 42 u 1.5 cstr str WARN\n" +
+    LOG_SYSTIME_STR + "  INFO: [ndn.util.tests.Logging] hex ff    a 10\n" +
+    LOG_SYSTIME_STR + "  INFO: [ndn.util.tests.Logging] after manipulators 255\n" +
+    LOG_SYSTIME_STR + "  INFO: [ndn.util.tests.Logging] " +
+    std::string(detail::TraceRecord::MAX_ARGS_SIZE - 3, 'x') + "...\n");
+}
+
+BOOST_AUTO_TEST_CASE(MultipleThreads)
+{
+  auto traceOs = make_shared<std::ostringstream>();
+  Logging::setTraceDestination(traceOs, 64 * 1024);
+  Logging::setLevel("Module1", LogLevel::INFO);
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 25; ++j) {
+        logFromModule1();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  Logging::flush();
+  std::string output = traceOs->str();
+  BOOST_CHECK_EQUAL(std::count(output.begin(), output.end(), '\n'), 4 * 25 * 4);
+  BOOST_CHECK_EQUAL(output.find("dropped"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(BufferFull)
+{
+  auto traceOs = make_shared<std::ostringstream>();
+  Logging::setTraceDestination(traceOs, 0); // smallest possible buffer
+  Logging::setLevel("Module1", LogLevel::INFO);
+
+  for (int i = 0; i < 1000; ++i) {
+    logFromModule1();
+  }
+
+  Logging::flush();
+  std::string output = traceOs->str();
+  BOOST_CHECK_LT(std::count(output.begin(), output.end(), '\n'), 1000 * 4);
+  BOOST_CHECK_NE(output.find("log records dropped"), std::string::npos);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Trace
+
 BOOST_AUTO_TEST_SUITE_END() // TestLogging
 BOOST_AUTO_TEST_SUITE_END() // Util
 
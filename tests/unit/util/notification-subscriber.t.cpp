@@ -69,6 +69,36 @@ public:
     subscriberFace.receive(data);
   }
 
+  /** \brief Deliver notification with sequence number \p seqNum to subscriber, out of order.
+   */
+  void
+  deliverNotificationAt(uint64_t seqNum, const std::string& msg)
+  {
+    Name dataName = streamPrefix;
+    dataName.appendSequenceNumber(seqNum);
+    Data data(dataName);
+    data.setContent(SimpleNotification(msg).wireEncode());
+    data.setFreshnessPeriod(1_s);
+    m_keyChain.sign(data);
+
+    subscriberFace.receive(data);
+  }
+
+  /** \return sequence numbers of all continuation requests sent from subscriberFace
+   */
+  std::vector<uint64_t>
+  getRequestSeqNums() const
+  {
+    std::vector<uint64_t> seqNums;
+    for (const auto& interest : subscriberFace.sentInterests) {
+      const Name& name = interest.getName();
+      if (streamPrefix.isPrefixOf(name) && name.size() == streamPrefix.size() + 1) {
+        seqNums.push_back(name[-1].toSequenceNumber());
+      }
+    }
+    return seqNums;
+  }
+
   /** \brief Deliver a Nack to subscriber.
    */
   void
@@ -282,6 +312,121 @@ BOOST_AUTO_TEST_CASE(PayloadError)
   BOOST_CHECK(this->hasInitialRequest());
 }
 
+BOOST_AUTO_TEST_CASE(PipelineWindow)
+{
+  BOOST_CHECK_EQUAL(subscriber.getPipelineWindow(), 1);
+  BOOST_CHECK_THROW(subscriber.setPipelineWindow(0), std::invalid_argument);
+  subscriber.setPipelineWindow(4);
+  BOOST_CHECK_EQUAL(subscriber.getPipelineWindow(), 4);
+}
+
+BOOST_AUTO_TEST_CASE(PipelinedNotifications)
+{
+  subscriber.setPipelineWindow(4);
+  std::vector<std::string> received;
+  subscriber.onNotification.connect([&] (const auto& n) { received.push_back(n.getMessage()); });
+  subscriber.start();
+  advanceClocks(1_ms);
+  BOOST_CHECK(this->hasInitialRequest());
+
+  // respond to initial request, which opens the window
+  subscriberFace.sentInterests.clear();
+  this->deliverNotificationAt(10, "n10");
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(received.size(), 1);
+  BOOST_CHECK_EQUAL(received.back(), "n10");
+  std::vector<uint64_t> expectedSeqNums{11, 12, 13, 14};
+  auto seqNums = this->getRequestSeqNums();
+  BOOST_CHECK_EQUAL_COLLECTIONS(seqNums.begin(), seqNums.end(),
+                                expectedSeqNums.begin(), expectedSeqNums.end());
+
+  // out-of-order arrivals are buffered until the preceding notification is received
+  subscriberFace.sentInterests.clear();
+  this->deliverNotificationAt(13, "n13");
+  this->deliverNotificationAt(12, "n12");
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(received.size(), 1);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests.size(), 0);
+
+  this->deliverNotificationAt(11, "n11");
+  advanceClocks(1_ms);
+  std::vector<std::string> expectedMsgs{"n10", "n11", "n12", "n13"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin(), received.end(),
+                                expectedMsgs.begin(), expectedMsgs.end());
+  expectedSeqNums = {15, 16, 17};
+  seqNums = this->getRequestSeqNums();
+  BOOST_CHECK_EQUAL_COLLECTIONS(seqNums.begin(), seqNums.end(),
+                                expectedSeqNums.begin(), expectedSeqNums.end());
+
+  // duplicate is ignored
+  subscriberFace.sentInterests.clear();
+  this->deliverNotificationAt(12, "n12");
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(received.size(), 4);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(PipelinedGap)
+{
+  subscriber.setPipelineWindow(3);
+  std::vector<std::string> received;
+  std::vector<uint64_t> gaps;
+  subscriber.onNotification.connect([&] (const auto& n) { received.push_back(n.getMessage()); });
+  subscriber.onGap.connect([&] (uint64_t seq) { gaps.push_back(seq); });
+  subscriber.onTimeout.connect([this] { hasTimeout = true; });
+  hasTimeout = false;
+  subscriber.start();
+  advanceClocks(1_ms);
+
+  this->deliverNotificationAt(0, "n0");
+  advanceClocks(1_ms);
+  subscriberFace.sentInterests.clear();
+
+  // notification 1 is lost, 2 and 3 arrive
+  this->deliverNotificationAt(3, "n3");
+  this->deliverNotificationAt(2, "n2");
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(received.size(), 1);
+  BOOST_CHECK_EQUAL(subscriberFace.sentInterests.size(), 0);
+
+  // the Interest for 1 times out, so it is reported as a gap and 2 and 3 are delivered
+  advanceClocks(100_ms, 10);
+  BOOST_REQUIRE_EQUAL(gaps.size(), 1);
+  BOOST_CHECK_EQUAL(gaps.front(), 1);
+  std::vector<std::string> expectedMsgs{"n0", "n2", "n3"};
+  BOOST_CHECK_EQUAL_COLLECTIONS(received.begin(), received.end(),
+                                expectedMsgs.begin(), expectedMsgs.end());
+  BOOST_CHECK_EQUAL(hasTimeout, false);
+
+  std::vector<uint64_t> expectedSeqNums{4, 5, 6};
+  auto seqNums = this->getRequestSeqNums();
+  BOOST_CHECK_EQUAL_COLLECTIONS(seqNums.begin(), seqNums.end(),
+                                expectedSeqNums.begin(), expectedSeqNums.end());
+}
+
+BOOST_AUTO_TEST_CASE(PipelinedNack)
+{
+  subscriber.setPipelineWindow(4);
+  this->connectHandlers();
+  subscriber.start();
+  advanceClocks(1_ms);
+
+  this->deliverNotificationAt(0, "n0");
+  advanceClocks(1_ms);
+  BOOST_REQUIRE_EQUAL(subscriberFace.sentInterests.size(), 5);
+  BOOST_CHECK_EQUAL(subscriberFace.getNPendingInterests(), 4);
+
+  // a Nack cancels the whole window and restarts from an initial request
+  Interest interest = subscriberFace.sentInterests.back();
+  subscriberFace.sentInterests.clear();
+  this->deliverNack(interest, lp::NackReason::CONGESTION);
+  advanceClocks(1_ms);
+  BOOST_CHECK_EQUAL(lastNack.getReason(), lp::NackReason::CONGESTION);
+  BOOST_CHECK_EQUAL(subscriberFace.getNPendingInterests(), 0);
+  advanceClocks(300_ms);
+  BOOST_CHECK(this->hasInitialRequest());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestNotificationSubscriber
 BOOST_AUTO_TEST_SUITE_END() // Util
 
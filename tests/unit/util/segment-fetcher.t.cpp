@@ -775,6 +775,39 @@ BOOST_AUTO_TEST_CASE(Stop)
   BOOST_CHECK_EQUAL(fetcher.use_count(), 1);
 }
 
+BOOST_AUTO_TEST_CASE(StopMidBatch)
+{
+  DummyValidator acceptValidator;
+  SegmentFetcher::Options options;
+  options.useConstantCwnd = true;
+  options.initCwnd = 400.0;
+  auto fetcher = SegmentFetcher::start(face, Interest("/hello/world"), acceptValidator, options);
+  connectSignals(fetcher);
+  advanceClocks(10_ms);
+  BOOST_REQUIRE_EQUAL(face.sentInterests.size(), 1);
+
+  // the first segment opens the window, queueing more Interests than the Face sends in one batch
+  face.receive(*makeDataSegment("/hello/world/version0", 0, false));
+  while (face.sentInterests.size() == 1 && m_io.poll_one() > 0) {
+  }
+  BOOST_REQUIRE_GT(face.sentInterests.size(), 1);
+  BOOST_REQUIRE_LT(face.sentInterests.size(), 401);
+  size_t nSent = face.sentInterests.size();
+
+  fetcher->stop();
+  advanceClocks(10_ms);
+  BOOST_CHECK_EQUAL(face.sentInterests.size(), nSent);
+  BOOST_CHECK_EQUAL(face.getNPendingInterests(), 0);
+  BOOST_CHECK_EQUAL(fetcher.use_count(), 1);
+
+  face.receive(*makeDataSegment("/hello/world/version0", 1, false));
+  advanceClocks(1_s, 10);
+  BOOST_CHECK_EQUAL(nErrors, 0);
+  BOOST_CHECK_EQUAL(nCompletions, 0);
+  BOOST_CHECK_EQUAL(nAfterSegmentReceived, 1);
+  BOOST_CHECK_EQUAL(nAfterSegmentTimedOut, 0);
+}
+
 BOOST_AUTO_TEST_CASE(Lifetime)
 {
   // BasicSingleSegment, but with scoped fetcher
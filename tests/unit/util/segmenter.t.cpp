@@ -24,6 +24,9 @@
 #include "tests/boost-test.hpp"
 #include "tests/key-chain-fixture.hpp"
 
+#include <boost/filesystem.hpp>
+#include <fstream>
+
 namespace ndn {
 namespace util {
 namespace tests {
@@ -141,6 +144,101 @@ BOOST_AUTO_TEST_CASE(MultipleSegments)
   check(segmenter.segment(ss, "/many", 42, 30_s));
 }
 
+class FileFixture : public KeyChainFixture
+{
+protected:
+  FileFixture()
+    : filename(boost::filesystem::path(UNIT_TESTS_TMPDIR) / "TestSegmenter" / "blob")
+  {
+    boost::filesystem::create_directories(filename.parent_path());
+  }
+
+  ~FileFixture()
+  {
+    boost::system::error_code ec;
+    boost::filesystem::remove_all(filename.parent_path(), ec); // ignore error
+  }
+
+  void
+  writeFile(span<const uint8_t> content)
+  {
+    std::ofstream os(filename.string(), std::ios::binary | std::ios::trunc);
+    os.write(reinterpret_cast<const char*>(content.data()), content.size());
+  }
+
+protected:
+  const boost::filesystem::path filename;
+};
+
+BOOST_FIXTURE_TEST_CASE(File, FileFixture)
+{
+  Segmenter segmenter(m_keyChain, security::SigningInfo{});
+  writeFile(BLOB);
+
+  auto segments = segmenter.open(filename.string(), "/file", 42, 30_s, tlv::ContentType_Blob, 2);
+  BOOST_TEST(segments.getPrefix() == "/file");
+  BOOST_TEST(segments.size() == 8);
+  BOOST_TEST(segments.getFinalBlockId() == name::Component::fromSegment(7));
+
+  // produces the same segments as the span overload, in any order
+  auto expected = segmenter.segment(BLOB, "/file", 42, 30_s);
+  for (uint64_t segNo : {7, 0, 3, 1, 2, 6, 4, 5}) {
+    auto seg = segments.get(segNo);
+    BOOST_TEST(seg->getName() == expected.at(segNo)->getName());
+    BOOST_TEST(seg->getFinalBlock().value() == name::Component::fromSegment(7));
+    BOOST_TEST(seg->getContent().value_bytes() == expected.at(segNo)->getContent().value_bytes(),
+               boost::test_tools::per_element());
+  }
+  BOOST_CHECK_THROW(segments.get(8), std::out_of_range);
+
+  // recently used segments are cached
+  BOOST_TEST(segments.get(5) == segments.get(5));
+  auto seg4 = segments.get(4);
+  segments.get(3);
+  BOOST_TEST(segments.get(4) == seg4);
+  segments.get(2);
+  segments.get(1);
+  BOOST_TEST(segments.get(4) != seg4);
+
+  BOOST_TEST(segments.get(Interest("/file/seg=6")) == segments.get(6));
+  BOOST_TEST(segments.get(Interest("/file/seg=8")) == nullptr);
+  BOOST_TEST(segments.get(Interest("/file/6")) == nullptr);
+  BOOST_TEST(segments.get(Interest("/other/seg=6")) == nullptr);
+  BOOST_TEST(segments.get(Interest("/file")) == nullptr);
+
+  // segments remain valid after the FileSegments is destructed
+  auto segments2 = segmenter.open(filename.string(), "/file", 42, 30_s);
+  auto seg0 = segments2.get(0);
+  segments2 = segmenter.open(filename.string(), "/other", 300, 30_s);
+  BOOST_TEST(segments2.size() == 1);
+  BOOST_TEST(seg0->getContent().value_bytes() == make_span(BLOB).first(42),
+             boost::test_tools::per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(FileEmptyOrMissing, FileFixture)
+{
+  Segmenter segmenter(m_keyChain, security::SigningInfo{});
+  writeFile({});
+
+  auto segments = segmenter.open(filename.string(), "/empty", 1000, 1_s, tlv::ContentType_Nack);
+  BOOST_TEST(segments.size() == 1);
+  auto seg = segments.get(0);
+  BOOST_TEST(seg->getName() == "/empty/seg=0");
+  BOOST_TEST(seg->getContentType() == tlv::ContentType_Nack);
+  BOOST_TEST(seg->getFinalBlock().value() == name::Component::fromSegment(0));
+  BOOST_TEST(seg->getContent().isValid());
+  BOOST_TEST(seg->getContent().value_size() == 0);
+
+  // same encoding as an empty segment produced from memory
+  auto fromMemory = segmenter.segment(span<uint8_t>{}, "/empty", 1000, 1_s, tlv::ContentType_Nack);
+  BOOST_TEST(seg->getContent() == fromMemory.at(0)->getContent());
+
+  BOOST_CHECK_THROW(auto s = segmenter.open(filename.string(), "/empty", 0, 1_s), std::invalid_argument);
+  BOOST_CHECK_THROW(auto s = segmenter.open(filename.string(), "/empty", 1000, -1_s), std::invalid_argument);
+  BOOST_CHECK_THROW(auto s = segmenter.open((filename.parent_path() / "missing").string(), "/missing", 1000, 1_s),
+                    Segmenter::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // TestSegmenter
 BOOST_AUTO_TEST_SUITE_END() // Util
 
@@ -66,6 +66,32 @@ BOOST_AUTO_TEST_CASE(TwoListeners)
   BOOST_CHECK_EQUAL(hit2, 1);
 }
 
+BOOST_AUTO_TEST_CASE(ManyListeners)
+{
+  SignalOwner0 so;
+
+  // more handlers than the signal stores inline
+  std::vector<int> hits;
+  std::vector<Connection> conns;
+  for (int i = 0; i < 5; ++i) {
+    conns.push_back(so.sig.connect([&hits, i] { hits.push_back(i); }));
+  }
+
+  so.emitSignal(sig);
+  std::vector<int> expected{0, 1, 2, 3, 4};
+  BOOST_CHECK_EQUAL_COLLECTIONS(hits.begin(), hits.end(), expected.begin(), expected.end());
+
+  conns[1].disconnect();
+  conns[3].disconnect();
+  BOOST_CHECK_EQUAL(conns[1].isConnected(), false);
+  BOOST_CHECK_EQUAL(conns[2].isConnected(), true);
+
+  hits.clear();
+  so.emitSignal(sig);
+  expected = {0, 2, 4};
+  BOOST_CHECK_EQUAL_COLLECTIONS(hits.begin(), hits.end(), expected.begin(), expected.end());
+}
+
 class SignalOwner1
 {
 public:
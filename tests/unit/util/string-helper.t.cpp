@@ -108,6 +108,95 @@ BOOST_AUTO_TEST_CASE(FromHex)
   BOOST_CHECK_THROW(fromHex("1234z"), StringHelperError);
 }
 
+BOOST_AUTO_TEST_CASE(ToHexSpan)
+{
+  const uint8_t input[] = {0x01, 0x2a, 0x3b, 0xc4, 0xde, 0xfa};
+  std::array<char, 16> output;
+  output.fill('x');
+  BOOST_CHECK_EQUAL(toHex(input, output), 12);
+  BOOST_CHECK_EQUAL(std::string(output.data(), 14), "012A3BC4DEFAxx");
+  BOOST_CHECK_EQUAL(toHex(input, output, false), 12);
+  BOOST_CHECK_EQUAL(std::string(output.data(), 12), "012a3bc4defa");
+  BOOST_CHECK_EQUAL(toHex({}, output), 0);
+
+  BOOST_CHECK_THROW(toHex(input, make_span(output).first(11)), StringHelperError);
+}
+
+BOOST_AUTO_TEST_CASE(FromHexSpan)
+{
+  const std::string input = "012a3Bc4defA";
+  std::array<uint8_t, 8> output{};
+  BOOST_CHECK_EQUAL(fromHex(input, output), 6);
+  const uint8_t expected[] = {0x01, 0x2a, 0x3b, 0xc4, 0xde, 0xfa, 0x00, 0x00};
+  BOOST_CHECK_EQUAL_COLLECTIONS(output.begin(), output.end(), expected, expected + sizeof(expected));
+  BOOST_CHECK_EQUAL(fromHex(span<const char>{}, output), 0);
+
+  BOOST_CHECK_THROW(fromHex(input, make_span(output).first(5)), StringHelperError);
+  BOOST_CHECK_THROW(fromHex(std::string("123"), output), StringHelperError);
+  BOOST_CHECK_THROW(fromHex(std::string("1x"), output), StringHelperError);
+}
+
+// test vectors from RFC 4648, Section 10
+const std::vector<std::pair<std::string, std::string>> BASE64_VECTORS{
+  {"", ""},
+  {"f", "Zg=="},
+  {"fo", "Zm8="},
+  {"foo", "Zm9v"},
+  {"foob", "Zm9vYg=="},
+  {"fooba", "Zm9vYmE="},
+  {"foobar", "Zm9vYmFy"},
+};
+
+BOOST_AUTO_TEST_CASE(ToBase64)
+{
+  for (const auto& v : BASE64_VECTORS) {
+    auto input = make_span(reinterpret_cast<const uint8_t*>(v.first.data()), v.first.size());
+    BOOST_CHECK_EQUAL(toBase64(input, false), v.second);
+    BOOST_CHECK_EQUAL(toBase64(input), v.second.empty() ? "" : v.second + "\n");
+  }
+
+  // line breaks after every 64 characters
+  Buffer zeros(49);
+  const std::string line(64, 'A');
+  BOOST_CHECK_EQUAL(toBase64(make_span(zeros).first(48)), line + "\n");
+  BOOST_CHECK_EQUAL(toBase64(zeros), line + "\nAA==\n");
+  BOOST_CHECK_EQUAL(toBase64(zeros, false), line + "AA==");
+
+  std::array<char, 8> output;
+  BOOST_CHECK_EQUAL(toBase64(make_span(zeros).first(4), output, false), 8);
+  BOOST_CHECK_EQUAL(std::string(output.data(), 8), "AAAAAA==");
+  BOOST_CHECK_THROW(toBase64(make_span(zeros).first(4), output, true), StringHelperError);
+}
+
+BOOST_AUTO_TEST_CASE(FromBase64)
+{
+  for (const auto& v : BASE64_VECTORS) {
+    auto decoded = fromBase64(v.second);
+    BOOST_CHECK_EQUAL(std::string(decoded->begin(), decoded->end()), v.first);
+  }
+
+  // whitespace is ignored, padding is optional
+  auto decoded = fromBase64(" Zm9v\r\nYmE\n");
+  BOOST_CHECK_EQUAL(std::string(decoded->begin(), decoded->end()), "fooba");
+
+  // round trip with line breaks
+  Buffer input(1000);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = static_cast<uint8_t>(i * 7);
+  }
+  BOOST_TEST(*fromBase64(toBase64(input)) == input, boost::test_tools::per_element());
+
+  std::array<uint8_t, 6> output;
+  BOOST_CHECK_EQUAL(fromBase64(std::string("Zm9vYmFy"), output), 6);
+  BOOST_CHECK_EQUAL(std::string(output.begin(), output.end()), "foobar");
+  BOOST_CHECK_THROW(fromBase64(std::string("Zm9vYmFyYg=="), output), StringHelperError);
+
+  BOOST_CHECK_THROW(fromBase64("Z"), StringHelperError);
+  BOOST_CHECK_THROW(fromBase64("Zm9v!"), StringHelperError);
+  BOOST_CHECK_THROW(fromBase64("Z==="), StringHelperError);
+  BOOST_CHECK_THROW(fromBase64("Zg==Zg=="), StringHelperError);
+}
+
 BOOST_AUTO_TEST_CASE(ToHexChar)
 {
   static const std::vector<std::pair<unsigned int, char>> hexMap{
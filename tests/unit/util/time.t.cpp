@@ -116,6 +116,37 @@ BOOST_AUTO_TEST_CASE(SystemClock)
                     fromUnixTimestamp(1390953600_s));
 }
 
+BOOST_AUTO_TEST_CASE(ParseIsoString)
+{
+  auto parse = [] (const std::string& str) { return parseIsoString(str); };
+
+  BOOST_TEST(parse("20140129T034247").value() == fromUnixTimestamp(1390966967_s));
+  BOOST_TEST(parse("20140129T034247.032000").value() == fromUnixTimestamp(1390966967032_ms));
+  BOOST_TEST(parse("20140129T034247,032").value() == fromUnixTimestamp(1390966967032_ms));
+  BOOST_TEST(parse("20140129T034247.0320009Z").value() == fromUnixTimestamp(1390966967032_ms));
+  BOOST_TEST(parse("19700101T000000").value() == getUnixEpoch());
+  BOOST_TEST(parse("19691231T235959").value() == getUnixEpoch() - 1_s);
+  BOOST_TEST(parse("20000229T120000").value() == fromUnixTimestamp(951825600_s));
+  BOOST_TEST(parse("21140129T034247").value() == fromUnixTimestamp(1390966967_s) + 36524_days);
+
+  for (const auto& str : {"", "20140129", "20140129 034247", "20140129T03424", "2014012T034247",
+                          "2014-01-29T03:42:47", "20140129T034247.", "20140129T034247+0100",
+                          "20141329T034247", "20140100T034247", "20140229T034247", "19000229T000000",
+                          "20140129T244247", "20140129T036047", "20140129T034260", "13990101T000000"}) {
+    BOOST_TEST_CONTEXT(str) {
+      BOOST_TEST(!parse(str));
+    }
+  }
+
+  // agrees with the general-purpose parser
+  for (const auto& str : {"20200805T015040", "19700101T000000.000001", "20420101T000001.042000",
+                          "22000101T000000.999999"}) {
+    BOOST_TEST_CONTEXT(str) {
+      BOOST_TEST(parse(str).value() == fromIsoString(str));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(SteadyClock)
 {
   steady_clock::time_point oldValue = steady_clock::now();
@@ -45,7 +45,7 @@ ndnsec_key_gen(int argc, char** argv)
     ("identity,i",    po::value<Name>(&identityName), "identity name, e.g., /ndn/edu/ucla/alice")
     ("not-default,n", po::bool_switch(&wantNotDefault), "do not set the identity as default")
     ("type,t",        po::value<char>(&keyTypeChoice)->default_value('e'),
-                      "key type: 'r' for RSA, 'e' for ECDSA")
+                      "key type: 'r' for RSA, 'e' for ECDSA, 'd' for Ed25519")
     ("keyid-type,k",  po::value<char>(&keyIdTypeChoice),
                       "key ID type: 'h' for the SHA-256 of the public key, 'r' for a 64-bit "
                       "random number (the default unless --keyid is specified)")
@@ -129,6 +129,14 @@ ndnsec_key_gen(int argc, char** argv)
       params = make_unique<EcKeyParams>(detail::EcKeyParamsInfo::getDefaultSize(), keyIdType);
     }
     break;
+  case 'd':
+    if (keyIdType == KeyIdType::USER_SPECIFIED) {
+      params = make_unique<Ed25519KeyParams>(userKeyIdComponent);
+    }
+    else {
+      params = make_unique<Ed25519KeyParams>(detail::Ed25519KeyParamsInfo::getDefaultSize(), keyIdType);
+    }
+    break;
   default:
     std::cerr << "ERROR: unrecognized key type '" << keyTypeChoice << "'" << std::endl;
     return 2;